@@ -20,6 +20,11 @@ pushd %build_folder%
   cl /MD -DDEBUG=1 /Od -nologo -Zo -Z7 %project_root%\test\window.c /link -subsystem:windows -incremental:no -opt:ref -OUT:window.exe
   IF %errorlevel% NEQ 0 (popd && goto end)
   .\window.exe
+
+  :: Benchmarks are optimized and only run with build.bat bench
+  cl /MD /O2 -nologo -Zo -Z7 %project_root%\test\bench.c /link -subsystem:console -incremental:no -opt:ref -OUT:na_bench.exe
+  IF %errorlevel% NEQ 0 (popd && goto end)
+  if "%1"=="bench" (.\na_bench.exe)
 popd
 
 :end
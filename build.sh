@@ -33,6 +33,12 @@ pushd $project_root
         ./$exe_name
 
         time clang -std=c11 $flags $libs -I$project_root/deps/ -D DEBUG=1 ../test/na_inliner.c -o na_inliner
+
+        # Benchmarks are optimized and only run with ./build.sh bench
+        time clang -O2 $flags $libs -I$project_root/deps/ ../test/bench.c -o na_bench
+        if [[ "$1" == "bench" ]]; then
+            ./na_bench
+        fi
     popd
 
 popd
\ No newline at end of file
@@ -188,6 +188,56 @@ VERSION HISTORY
     #define ARCH_32BIT 0
 #endif
 
+//
+// SIMD
+//
+
+// NOTE(nick): picked at compile time, build with -mavx2 (or /arch:AVX2) to get the wider paths
+#if !defined(ARCH_SSE2)
+    #if defined(__SSE2__) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define ARCH_SSE2 1
+    #else
+        #define ARCH_SSE2 0
+    #endif
+#endif
+#if !defined(ARCH_AVX2)
+    #if defined(__AVX2__)
+        #define ARCH_AVX2 1
+    #else
+        #define ARCH_AVX2 0
+    #endif
+#endif
+#if !defined(ARCH_NEON)
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define ARCH_NEON 1
+    #else
+        #define ARCH_NEON 0
+    #endif
+#endif
+#if !defined(ARCH_SSSE3)
+    #if defined(__SSSE3__) || defined(__AVX__)
+        #define ARCH_SSSE3 1
+    #else
+        #define ARCH_SSSE3 0
+    #endif
+#endif
+
+// NOTE(nick): hardware CRC instructions, SSE4.2 only has CRC32C while ARMv8 has both
+#if !defined(ARCH_SSE42)
+    #if defined(__SSE4_2__) || defined(__AVX__)
+        #define ARCH_SSE42 1
+    #else
+        #define ARCH_SSE42 0
+    #endif
+#endif
+#if !defined(ARCH_ARM_CRC32)
+    #if defined(__ARM_FEATURE_CRC32) || defined(_M_ARM64)
+        #define ARCH_ARM_CRC32 1
+    #else
+        #define ARCH_ARM_CRC32 0
+    #endif
+#endif
+
 //
 // Byte Order
 //
@@ -691,6 +741,52 @@ typedef u64 Arena_Flags;
 enum
 {
     ArenaFlag_NoChain = (1 << 0),
+    // NOTE(nick): shared arenas can be pushed to from many threads at once.
+    // They never chain, and pops/resets must happen while no one else is pushing.
+    ArenaFlag_Shared  = (1 << 1),
+    // NOTE(nick): back the arena with huge pages where the OS supports it and commit in
+    // ARENA_LARGE_COMMIT_SIZE steps. Only takes effect when passed to arena_alloc_with_flags.
+    ArenaFlag_LargePages = (1 << 2),
+    // NOTE(nick): fault pages in as soon as they are committed instead of on first touch.
+    ArenaFlag_Prefault   = (1 << 3),
+    // NOTE(nick): every push ends right before an inaccessible guard page and popped
+    // memory is decommitted/poisoned right away. Costs at least 2 pages per push.
+    ArenaFlag_Debug      = (1 << 4),
+};
+
+// NOTE(nick): turns on ArenaFlag_Debug for every arena that isn't shared or made from a buffer
+#if !defined(ARENA_DEBUG)
+    #define ARENA_DEBUG 0
+#endif
+
+#if !defined(ARENA_STATS)
+    #define ARENA_STATS 0
+#endif
+
+typedef struct Arena_Stats Arena_Stats;
+struct Arena_Stats
+{
+    u64 peak_pos;
+    u64 committed;
+    u64 peak_committed;
+
+    u64 push_count;
+    u64 bytes_zeroed;
+
+    u64 commit_count;
+    u64 decommit_count;
+    f64 commit_time;
+    f64 decommit_time;
+};
+
+typedef struct Arena_Site_Stats Arena_Site_Stats;
+struct Arena_Site_Stats
+{
+    const char *file;
+    u32 volatile line;
+
+    u64 push_count;
+    u64 bytes;
 };
 
 typedef struct Arena Arena;
@@ -707,6 +803,13 @@ struct Arena
     u64 commit_pos;
 
     u64 page_size;
+    u64 base_pos;
+
+    u32 volatile commit_lock;
+
+    #if ARENA_STATS
+    Arena_Stats stats;
+    #endif
 };
 
 typedef struct M_Temp M_Temp;
@@ -722,6 +825,7 @@ struct M_Temp
 
 function Arena *arena_make_from_buffer(u8 *data, u64 size);
 function Arena *arena_alloc(u64 size);
+function Arena *arena_alloc_with_flags(u64 size, Arena_Flags flags);
 function void arena_free(Arena *arena);
 function void arena_pop_to(Arena *arena, u64 pos);
 function void arena_pop(Arena *arena, u64 size);
@@ -729,28 +833,67 @@ function void arena_set_pos(Arena *arena, u64 pos);
 function void arena_reset(Arena *arena);
 function void *arena_push(Arena *arena, u64 size, u64 pow2_align, b32 zero);
 function bool arena_write(Arena *arena, u8 *data, u64 size);
+function u64 arena_pos(Arena *arena);
 
 function M_Temp arena_begin_temp(Arena *arena);
 function void arena_end_temp(M_Temp temp);
 
-#define PushArray(a,T,c)       (T*)arena_push((a), sizeof(T)*(c), AlignOf(T), true)
-#define PushArrayZero(a,T,c)   (T*)arena_push((a), sizeof(T)*(c), AlignOf(T), true)
-#define PushArrayNoZero(a,T,c) (T*)arena_push((a), sizeof(T)*(c), AlignOf(T), false)
+// Stats
+function Arena_Stats arena_get_stats(Arena *arena);
+function void arena_print_stats(Arena *arena);
+function void *arena_push_site(Arena *arena, u64 size, u64 pow2_align, b32 zero, const char *file, u32 line);
+function void arena_print_site_stats(u64 max_count);
+
+#if ARENA_STATS && DEBUG
+    #define ArenaPush(a,size,align,zero) arena_push_site((a), (size), (align), (zero), __FILE__, __LINE__)
+#else
+    #define ArenaPush(a,size,align,zero) arena_push((a), (size), (align), (zero))
+#endif
 
-#define PushStruct(a, T)       (T*)arena_push((a), sizeof(T), AlignOf(T), true)
-#define PushStructZero(a, T)   (T*)arena_push((a), sizeof(T), AlignOf(T), true)
-#define PushStructNoZero(a, T) (T*)arena_push((a), sizeof(T), AlignOf(T), false)
+#define PushArray(a,T,c)       (T*)ArenaPush((a), sizeof(T)*(c), AlignOf(T), true)
+#define PushArrayZero(a,T,c)   (T*)ArenaPush((a), sizeof(T)*(c), AlignOf(T), true)
+#define PushArrayNoZero(a,T,c) (T*)ArenaPush((a), sizeof(T)*(c), AlignOf(T), false)
+
+#define PushStruct(a, T)       (T*)ArenaPush((a), sizeof(T), AlignOf(T), true)
+#define PushStructZero(a, T)   (T*)ArenaPush((a), sizeof(T), AlignOf(T), true)
+#define PushStructNoZero(a, T) (T*)ArenaPush((a), sizeof(T), AlignOf(T), false)
 
 #define PopArray(a, T, c0, c1) if (c1 < c0) arena_pop((a), (c0 - c1) * sizeof(T))
 
+#if !defined(SCRATCH_SLOT_COUNT)
+    #define SCRATCH_SLOT_COUNT 4
+#endif
+
+// NOTE(nick): scratch arenas chain, so this only bounds the first block of each slot
+#if !defined(SCRATCH_RESERVE_SIZE)
+    #define SCRATCH_RESERVE_SIZE Megabytes(64)
+#endif
+
+#if !defined(SCRATCH_MAX_DEPTH)
+    #define SCRATCH_MAX_DEPTH 64
+#endif
+
 function M_Temp arena_get_scratch(Arena **conflicts, u64 conflict_count);
+function void arena_release_scratch(M_Temp temp);
+function u64 arena_scratch_depth();
+function void arena_release_thread_scratch();
 #define GetScratch(conflicts, conflict_count) arena_get_scratch(conflicts, conflict_count)
-#define ReleaseScratch(temp) arena_end_temp(temp)
+#define ReleaseScratch(temp) arena_release_scratch(temp)
 function Arena *temp_arena();
 
 function void *arena_realloc_ptr(Arena *arena, u64 new_size, void *old_memory_pointer, u64 old_size);
 function void arena_free_ptr(Arena *arena, void *old_memory_pointer, u64 old_size);
 
+// Offset Pointers
+// NOTE(nick): self-relative pointers stay valid when the memory they live in moves,
+// use them for structures that go into arena snapshots. 0 means NULL.
+typedef i64 Offset_Ptr;
+#define OffsetPtrSet(field, ptr) ((field) = (ptr) ? (i64)((u8 *)(ptr) - (u8 *)&(field)) : 0)
+#define OffsetPtrGet(T, field)   ((field) ? (T *)((u8 *)&(field) + (field)) : (T *)0)
+
+// NOTE(nick): for plain pointers in a snapshot that didn't land at its old address
+#define RelocatePtr(ptr, relocation) do { if (ptr) { *(u8 **)&(ptr) += (relocation); } } while (0)
+
 // Helpers
 typedef i32 Compare_Proc(void *a, void *b);
 
@@ -800,6 +943,90 @@ function void *allocator_realloc_aligned(Allocator allocator, void *data, u64 ne
 function Allocator os_allocator();
 function Allocator arena_allocator(Arena *arena);
 
+//
+// Pool
+//
+
+#if !defined(POOL_DEFAULT_SLAB_COUNT)
+    #define POOL_DEFAULT_SLAB_COUNT 64
+#endif
+
+typedef struct Pool_Free_Node Pool_Free_Node;
+struct Pool_Free_Node
+{
+    Pool_Free_Node *next;
+};
+
+typedef struct Pool_Slab Pool_Slab;
+struct Pool_Slab
+{
+    Pool_Slab *next;
+    u8 *data;
+};
+
+typedef struct Pool Pool;
+struct Pool
+{
+    Arena *arena;
+
+    u64 item_size;
+    u64 item_align;
+    u64 slab_count;
+
+    Pool_Free_Node *free_list;
+
+    Pool_Slab *first_slab;
+    Pool_Slab *last_slab;
+    Pool_Slab *current_slab;
+    u64 current_index;
+
+    u64 count;
+};
+
+function void pool_init(Pool *pool, Arena *arena, u64 item_size, u64 item_align, u64 slab_count);
+function void *pool_alloc(Pool *pool, b32 zero);
+function void pool_free(Pool *pool, void *ptr);
+function void pool_reset(Pool *pool);
+
+function Allocator pool_allocator(Pool *pool);
+
+#define PoolInit(p, arena, T)   pool_init((p), (arena), sizeof(T), AlignOf(T), POOL_DEFAULT_SLAB_COUNT)
+#define PoolAlloc(p, T)         (T*)pool_alloc((p), true)
+#define PoolAllocNoZero(p, T)   (T*)pool_alloc((p), false)
+#define PoolFree(p, ptr)        pool_free((p), (ptr))
+
+//
+// Heap
+//
+
+// NOTE(nick): ASAN poisons the whole reservation up front, which costs an eighth of it in shadow memory
+#if !defined(HEAP_RESERVE_SIZE)
+    #if ARCH_64BIT && !defined(__SANITIZE_ADDRESS__)
+        #define HEAP_RESERVE_SIZE Gigabytes(64)
+    #else
+        #define HEAP_RESERVE_SIZE Megabytes(512)
+    #endif
+#endif
+
+#define HEAP_PAGE_SIZE   Kilobytes(256)
+#define HEAP_SMALL_MAX   Kilobytes(32)
+#define HEAP_CLASS_COUNT 40
+#define HEAP_HEADER_SIZE 128
+
+function void *heap_alloc(u64 size);
+function void *heap_alloc_aligned(u64 size, u32 alignment);
+function void *heap_realloc(void *ptr, u64 new_size);
+function void *heap_realloc_aligned(void *ptr, u64 new_size, u32 alignment);
+function void heap_free(void *ptr);
+function u64 heap_size_of(void *ptr);
+
+// NOTE(nick): gives empty pages back and parks the rest for the next thread,
+// threads started with os_thread_create call this on the way out.
+function void heap_release_thread_cache();
+
+// NOTE(nick): there's no FreeAll, the heap is shared by everyone using heap_alloc
+function Allocator heap_allocator();
+
 #endif // BASE_MEMORY_H
 #ifndef BASE_STRINGS_H
 #define BASE_STRINGS_H
@@ -885,6 +1112,45 @@ typedef struct String_Builder String_Builder;
 struct String_Builder
 {
     String_List list;
+
+    // NOTE(nick): only used by builders from sb_begin
+    Arena *arena;
+    u8 *data;
+    i64 count;
+    i64 capacity;
+};
+
+enum
+{
+    FmtKind_None,
+    FmtKind_I64,
+    FmtKind_U64,
+    FmtKind_Hex,
+    FmtKind_F64,
+    FmtKind_String,
+};
+
+typedef struct Fmt_Arg Fmt_Arg;
+struct Fmt_Arg
+{
+    u32 kind;
+    i32 min_digits;
+    union
+    {
+        i64 i;
+        u64 u;
+        f64 f;
+        String string;
+    };
+};
+
+#define FMT_MAX_ARGS 9
+
+typedef struct Fmt_Args Fmt_Args;
+struct Fmt_Args
+{
+    i64 count;
+    Fmt_Arg data[FMT_MAX_ARGS];
 };
 
 typedef struct String_Join_Params String_Join_Params;
@@ -912,6 +1178,141 @@ enum
     MatchFlag_FindLast         = 1 << 3,
 };
 
+typedef struct String_Replacement String_Replacement;
+struct String_Replacement
+{
+    String find;
+    String replace;
+};
+
+typedef struct String_Matcher String_Matcher;
+struct String_Matcher
+{
+    Match_Flags flags;
+
+    // NOTE(nick): bytes that don't appear in any pattern all share class 0. When every
+    // byte value appears, the last one to show up gets class 0 to itself.
+    u8 classes[256];
+    u32 class_count;
+
+    // NOTE(nick): full DFA, state_count * class_count entries. Entries are the row offset
+    // of the next state (state * class_count) with STRING_MATCHER_OUTPUT_BIT set if
+    // that state has matches to report.
+    u32 state_count;
+    u32 *next;
+    u32 *pattern_from_state; // the first pattern that ends in this state, or U32_MAX
+    u32 *next_match_state;   // closest suffix state that ends a pattern, or U32_MAX
+
+    i64 pattern_count;
+    i64 *pattern_lengths;
+    u32 *next_same_pattern;  // the next pattern ending in the same state (a duplicate), or U32_MAX
+
+    // NOTE(nick): used to skip ahead with string_find_any while in the root state
+    u8 first_bytes_data[256];
+    String first_bytes;
+};
+
+#define STRING_MATCHER_OUTPUT_BIT 0x80000000
+
+typedef struct String_Match String_Match;
+struct String_Match
+{
+    i64 index;
+    i64 pattern;
+};
+
+typedef struct String_Match_Array String_Match_Array;
+struct String_Match_Array
+{
+    i64 count;
+    i64 capacity;
+    String_Match *data;
+};
+
+typedef struct String_Match_Iter String_Match_Iter;
+struct String_Match_Iter
+{
+    String_Matcher *matcher;
+    String text;
+    i64 at;
+    u32 state;
+    u32 pending;
+    u32 pending_pattern;
+};
+
+// NOTE(nick): internal, declared here so iterators can hold on to one between calls
+enum
+{
+    String__Scan_Byte,
+    String__Scan_Set,
+    String__Scan_Table,
+    String__Scan_NotWhitespace,
+};
+
+typedef struct String__Scanner String__Scanner;
+struct String__Scanner
+{
+    u32 kind;
+    u8 byte;
+    String set;
+    b8 table[256];
+    u8 nibble_rows[32];
+};
+
+typedef u32 Split_Flags;
+enum
+{
+    SplitFlag_SkipEmpty = 1 << 0,
+};
+
+typedef struct String_Split_Iter String_Split_Iter;
+struct String_Split_Iter
+{
+    String text;
+    i64 at;
+    u32 kind;
+    Split_Flags flags;
+    String separator;
+    String__Scanner scanner;
+};
+
+typedef u32 Token_Kind;
+enum
+{
+    Token_None,
+    Token_Word,
+    Token_Quoted,
+    Token_Delimiter,
+};
+
+typedef struct String_Token String_Token;
+struct String_Token
+{
+    Token_Kind kind;
+    i64 index;       // where the token starts in the text, including any opening quote
+    String text;     // quoted tokens exclude the quotes, escapes are left as they are
+    u8 quote;
+    b32 has_escapes;
+};
+
+typedef struct String_Tokenizer_Options String_Tokenizer_Options;
+struct String_Tokenizer_Options
+{
+    String whitespace; // skipped between tokens
+    String delimiters; // each of these bytes is a token on its own
+    String quotes;     // bytes that open and close a quoted token
+    u8 escape;         // escapes the next byte inside quotes, 0 for none
+};
+
+typedef struct String_Tokenizer String_Tokenizer;
+struct String_Tokenizer
+{
+    String text;
+    i64 at;
+    u8 escape;
+    u8 classes[256];
+};
+
 typedef struct String_Time_Options String_Time_Options;
 struct String_Time_Options
 {
@@ -981,11 +1382,26 @@ function b32 string_ends_with(String str, String postfix);
 function i64 string_index(String str, String search, i64 start_index);
 function i64 string_char_index(String str, u8 search, i64 start_index);
 function i64 string_last_index(String str, String search);
+function i64 string_find_byte(String str, u8 byte, i64 start_index, Match_Flags flags);
+function i64 string_find_any(String str, String bytes, i64 start_index, Match_Flags flags);
+function i64 string_find_not_whitespace(String str, i64 start_index, Match_Flags flags);
+function i64 string_count_byte(String str, u8 byte);
 function b32 string_contains(String str, String search);
 function b32 string_in_bounds(String str, i64 at);
 function void string_advance(String *str, i64 count);
 function String string_split_iter(String *text, String search);
 
+// Split Iterators
+function String_Split_Iter string_split_by(String text, String separator, Split_Flags flags);
+function String_Split_Iter string_split_by_any(String text, String bytes, Split_Flags flags);
+function String_Split_Iter string_split_lines(String text, Split_Flags flags);
+function b32 string_split_next(String_Split_Iter *it, String *result);
+
+// Tokenizer
+function String_Tokenizer string_tokenizer_make(String text, String_Tokenizer_Options options);
+function b32 string_tokenizer_next(String_Tokenizer *it, String_Token *token);
+function String string_unescape(Arena *arena, String str, u8 escape);
+
 // Allocation
 function String string_push(Arena *arena, String str);
 function String string_alloc(String str);
@@ -1001,6 +1417,7 @@ function String string_print(Arena *arena, const char *fmt, ...);
 #define sprint(fmt, ...) string_print(temp_arena(), fmt, __VA_ARGS__)
 
 function String string_replace(Arena *arena, String str, String find, String replacer, u64 replace_limit);
+function String string_replace_many(Arena *arena, String str, String_Replacement *replacements, i64 count);
 
 // Unicode Conversions
 function String_Decode string_decode_utf8(u8 *str, u64 capacity);
@@ -1019,12 +1436,40 @@ function String string_from_string32(Arena *arena, String32 str);
 function String16 string16_from_string(Arena *arena, String str);
 function String string_from_string16(Arena *arena, String16 str);
 
+// NOTE(nick): string_validate_utf8 returns the index of the first byte that isn't part of a
+// valid UTF-8 sequence, or str.count if there isn't one (overlongs and surrogates are invalid)
+function b32 string_is_ascii(String str);
+function i64 string_validate_utf8(String str);
+
 // Conversions
 function u64 string_to_u64(String string, u32 radix);
 function i64 string_to_i64(String str, u32 base);
 function f64 string_to_f64(String str);
 function b32 string_to_b32(String str);
 
+// Number Parsing
+// NOTE(nick): these parse a number at the start of str and return how many bytes they used,
+// or 0 if there isn't one (or it doesn't fit). No whitespace is skipped.
+function i64 string_parse_u64(String str, u64 *value);
+function i64 string_parse_i64(String str, i64 *value);
+function i64 string_parse_f64(String str, f64 *value);
+
+// Number Formatting
+// NOTE(nick): string_write_* don't null terminate and return the number of bytes written,
+// dest needs room for STRING_NUMBER_MAX_SIZE bytes. Floats are the shortest digits that
+// round-trip, so string_from_f64(0.1) is "0.1". Hex is zero padded to min_digits, which
+// can't be more than STRING_NUMBER_MAX_SIZE.
+#define STRING_NUMBER_MAX_SIZE 32
+
+function i64 string_write_u64(u8 *dest, u64 value);
+function i64 string_write_i64(u8 *dest, i64 value);
+function i64 string_write_hex(u8 *dest, u64 value, i32 min_digits);
+function i64 string_write_f64(u8 *dest, f64 value);
+function String string_from_u64(Arena *arena, u64 value);
+function String string_from_i64(Arena *arena, i64 value);
+function String string_from_hex(Arena *arena, u64 value, i32 min_digits);
+function String string_from_f64(Arena *arena, f64 value);
+
 // String Lists
 function void string_list_push_node(String_List *list, String_Node *n);
 function void string_list_push(Arena *arena, String_List *list, String str);
@@ -1042,6 +1487,14 @@ function String_Array string_array_from_list(Arena *arena, String_List list);
 function String_Array string_splits(Arena *arena, String string, int split_count, String *splits);
 function String_Array string_split(Arena *arena, String string, String split);
 function String string_join(Arena *arena, String_Array array, String join);
+// NOTE(nick): MSD radix sort, same order as string_compare with no flags
+function void string_array_sort(String_Array *array);
+
+// Multi-Pattern Matching
+function String_Matcher *string_matcher_make(Arena *arena, String_Array patterns, Match_Flags flags);
+function String_Match_Iter string_matcher_iter(String_Matcher *matcher, String text);
+function b32 string_matcher_next(String_Match_Iter *it, String_Match *match);
+function String_Match_Array string_matcher_find_all(Arena *arena, String_Matcher *matcher, String text);
 
 // Misc Helpers
 function String string_concat2(Arena *arena, String a, String b);
@@ -1062,6 +1515,8 @@ function String string_remove(Arena *arena, String str, String remove);
 function String string_strip(Arena *arena, String str, String chars);
 
 function u64 string_hash(String str);
+function u64 string_hash_ignore_case(String str);
+function i32 string_compare(String a, String b, Match_Flags flags);
 
 function void string_to_lower(String *str);
 function void string_to_upper(String *str);
@@ -1069,11 +1524,65 @@ function String string_lower(Arena *arena, String str);
 function String string_upper(Arena *arena, String str);
 
 // String Builder
+// NOTE(nick): a zeroed builder keeps a list of pushed strings. A builder from sb_begin
+// appends into one buffer at the top of its arena instead, and ignores the arena argument.
+function String_Builder sb_begin(Arena *arena, i64 capacity);
+function String sb_end(String_Builder *sb);
+function void sb_reserve(String_Builder *sb, i64 count);
 function void sb_push(Arena *arena, String_Builder *builder, String str);
+function void sb_push_byte(Arena *arena, String_Builder *sb, u8 byte);
+function void sb_push_u64(Arena *arena, String_Builder *sb, u64 value);
+function void sb_push_i64(Arena *arena, String_Builder *sb, i64 value);
+function void sb_push_f64(Arena *arena, String_Builder *sb, f64 value, i32 precision);
+function void sb_push_hex(Arena *arena, String_Builder *sb, u64 value, i32 min_digits);
 function void sb_print(Arena *arena, String_Builder *builder, const char *fmt, ...);
+function void sb_push_arg(Arena *arena, String_Builder *sb, Fmt_Arg arg);
+function void sb_format_args(Arena *arena, String_Builder *sb, String fmt, Fmt_Args args);
 function String sb_to_string(Arena *arena, String_Builder builder);
 function void sb_reset(String_Builder *sb);
 
+// Formatting
+// NOTE(nick): "{}" takes the next argument, "{{" and "}}" are literal braces. Arguments go
+// through the typed fmt_* constructors, so there's no va_list and the compiler checks their
+// types. The placeholder count is checked at compile time in C++ and by an assert in C:
+//     String str = string_format(arena, "{} took {}ms", fmt_str(name), fmt_f64(ms));
+function Fmt_Arg fmt_i64(i64 value);
+function Fmt_Arg fmt_u64(u64 value);
+function Fmt_Arg fmt_hex(u64 value, i32 min_digits);
+function Fmt_Arg fmt_f64(f64 value);
+function Fmt_Arg fmt_str(String value);
+function Fmt_Arg fmt_cstr(const char *value);
+function String string_format_args(Arena *arena, String fmt, Fmt_Args args);
+
+#if LANG_CPP
+    // NOTE(nick): counts placeholders the same way sb_format_args does. Recursive because
+    // C++11 constexpr functions are a single return, so literals are capped by -fconstexpr-depth.
+    constexpr i64 fmt__count_placeholders(const char *at)
+    {
+        return !at[0] ? 0 :
+            (at[0] == '{' && at[1] == '}') ? 1 + fmt__count_placeholders(at + 2) :
+            ((at[0] == '{' || at[0] == '}') && at[1] == at[0]) ? fmt__count_placeholders(at + 2) :
+            fmt__count_placeholders(at + 1);
+    }
+
+    // NOTE(nick): never called, sizeof of the result counts the arguments. Unlike ArgCount
+    // this also gets 0 right in strict -std=c++11, where ", ##__VA_ARGS__" keeps the comma.
+    template <typename... T> char (&fmt__arg_count(T...))[sizeof...(T) + 1];
+    #define Fmt__ArgCount(...) ((i64)sizeof(fmt__arg_count(__VA_ARGS__)) - 1)
+
+    // NOTE(nick): only the true case is defined, so a mismatch fails to compile right here
+    template <bool placeholder_count_matches_argument_count> struct Fmt__Arg_Count_Check;
+    template <> struct Fmt__Arg_Count_Check<true> { enum { value = 0 }; };
+
+    #define Fmt__CheckArgCount(fmt, ...) (void)Fmt__Arg_Count_Check<(fmt__count_placeholders(fmt) == Fmt__ArgCount(__VA_ARGS__))>::value,
+#else
+    #define Fmt__ArgCount(...) ArgCount(__VA_ARGS__)
+    #define Fmt__CheckArgCount(fmt, ...)
+#endif
+
+#define string_format(arena, fmt, ...) (Fmt__CheckArgCount(fmt, __VA_ARGS__) string_format_args(arena, S(fmt), StructLit(Fmt_Args){Fmt__ArgCount(__VA_ARGS__), {__VA_ARGS__}}))
+#define sb_format(arena, sb, fmt, ...) (Fmt__CheckArgCount(fmt, __VA_ARGS__) sb_format_args(arena, sb, S(fmt), StructLit(Fmt_Args){Fmt__ArgCount(__VA_ARGS__), {__VA_ARGS__}}))
+
 // Path Helpers
 function String path_filename(String path);
 function String path_dirname(String path);
@@ -1374,6 +1883,7 @@ typedef struct _FILE_NOTIFY_INFORMATION {
 #define MEM_DECOMMIT              0x00004000
 #define MEM_RELEASE               0x00008000
 #define PAGE_READWRITE            0x04
+#define FILE_MAP_ALL_ACCESS       0x000F001F
 
 // ============================================================
 // Synchronization
@@ -1462,6 +1972,9 @@ __int64       __cdecl _InterlockedExchange64(__int64 volatile *dest, __int64 val
 __int64       __cdecl _InterlockedExchangeAdd64(__int64 volatile *dest, __int64 value);
 unsigned __int64 __cdecl __readgsqword(unsigned long offset);
 unsigned __int64 __cdecl __rdtsc(void);
+unsigned char __cdecl _BitScanForward(unsigned long *index, unsigned long mask);
+unsigned char __cdecl _BitScanForward64(unsigned long *index, unsigned __int64 mask);
+unsigned char __cdecl _BitScanReverse64(unsigned long *index, unsigned __int64 mask);
 
 // ============================================================
 // Kernel32 — memory
@@ -1470,6 +1983,9 @@ unsigned __int64 __cdecl __rdtsc(void);
 WINBASEAPI PVOID  WINAPI VirtualAlloc(LPVOID lpAddress, SIZE_T dwSize, DWORD flAllocationType, DWORD flProtect);
 WINBASEAPI BOOL   WINAPI VirtualFree(LPVOID lpAddress, SIZE_T dwSize, DWORD dwFreeType);
 WINBASEAPI VOID   WINAPI GetSystemInfo(SYSTEM_INFO *lpSystemInfo);
+WINBASEAPI HANDLE WINAPI CreateFileMappingA(HANDLE hFile, LPSECURITY_ATTRIBUTES lpFileMappingAttributes, DWORD flProtect, DWORD dwMaximumSizeHigh, DWORD dwMaximumSizeLow, LPCSTR lpName);
+WINBASEAPI LPVOID WINAPI MapViewOfFileEx(HANDLE hFileMappingObject, DWORD dwDesiredAccess, DWORD dwFileOffsetHigh, DWORD dwFileOffsetLow, SIZE_T dwNumberOfBytesToMap, LPVOID lpBaseAddress);
+WINBASEAPI BOOL   WINAPI UnmapViewOfFile(LPCVOID lpBaseAddress);
 
 // ============================================================
 // Kernel32 — timing / sleep
@@ -1727,6 +2243,46 @@ struct Random_PCG
     u64 selector;
 };
 
+#define RANDOM_XOSHIRO_LANES 8
+
+typedef struct Random_Xoshiro Random_Xoshiro;
+struct Random_Xoshiro
+{
+    // NOTE(nick): word-major, s[k][lane], so one step advances every lane side by side
+    u64 s[4][RANDOM_XOSHIRO_LANES];
+    u64 buffer[RANDOM_XOSHIRO_LANES];
+    i32 buffered;
+};
+
+typedef struct Hash64_State Hash64_State;
+struct Hash64_State
+{
+    u64 seed;
+    u64 see1;
+    u64 see2;
+    u64 total;
+    // NOTE(nick): the first 16 bytes keep the end of the last block, the final read can reach back into it
+    u8 buffer[64];
+    i64 buffered;
+};
+
+typedef struct Base64_Encoder Base64_Encoder;
+struct Base64_Encoder
+{
+    u8 pending[3];
+    i32 pending_count;
+    b32 url_safe;
+};
+
+typedef struct Base64_Decoder Base64_Decoder;
+struct Base64_Decoder
+{
+    u32 bits;
+    i32 pending_count;
+    b32 skip_whitespace;
+    b32 done; // hit padding or a byte outside the alphabet, the rest is ignored
+};
+
 typedef struct Timing_f64 Timing_f64;
 struct Timing_f64
 {
@@ -1758,9 +2314,39 @@ function u64 u64_from_big_endian(u64 i);
 function u32 rotate_left_u32(u32 value, i32 amount);
 function u32 rotate_right_u32(u32 value, i32 amount);
 
+function u64 multiply_u64_wide(u64 a, u64 b, u64 *hi);
+
+function u32 count_leading_zeros_u64(u64 x);
+function u32 count_trailing_zeros_u64(u64 x);
+function u32 count_trailing_zeros_u32(u32 x);
+function u32 count_set_bits_u64(u64 x);
+
 // Comparisons
 function i32 compare_i32(const void *a, const void *b);
-function i64 compare_i64(const void *a, const void *b);
+function i32 compare_i64(const void *a, const void *b);
+function i32 compare_u32(const void *a, const void *b);
+function i32 compare_u64(const void *a, const void *b);
+function i32 compare_f32(const void *a, const void *b);
+function i32 compare_f64(const void *a, const void *b);
+function i32 compare_string(const void *a, const void *b);
+
+// Radix Sort
+// NOTE(nick): stable, and much faster than memory_sort for plain keys. They take a scratch
+// buffer the size of the input. The _pairs versions carry values[i] along with keys[i].
+// Floats order by their bits: -0 before +0, NaNs at the ends depending on their sign.
+function void radix_sort_u32(u32 *keys, i64 count);
+function void radix_sort_i32(i32 *keys, i64 count);
+function void radix_sort_f32(f32 *keys, i64 count);
+function void radix_sort_u64(u64 *keys, i64 count);
+function void radix_sort_i64(i64 *keys, i64 count);
+function void radix_sort_f64(f64 *keys, i64 count);
+
+function void radix_sort_u32_pairs(u32 *keys, u32 *values, i64 count);
+function void radix_sort_i32_pairs(i32 *keys, u32 *values, i64 count);
+function void radix_sort_f32_pairs(f32 *keys, u32 *values, i64 count);
+function void radix_sort_u64_pairs(u64 *keys, u64 *values, i64 count);
+function void radix_sort_i64_pairs(i64 *keys, u64 *values, i64 count);
+function void radix_sort_f64_pairs(f64 *keys, u64 *values, i64 count);
 
 // Hashing
 function u32 murmur32_seed(void const *data, i64 len, u32 seed);
@@ -1773,6 +2359,26 @@ function u64 fnv64a(void const *data, i64 len);
 function u64 murmur64_from_string(String str);
 function u64 fnv64a_from_string(String str);
 
+function u64 hash64_seed(void const *data, i64 len, u64 seed);
+function u64 hash64(void const *data, i64 len);
+function u64 hash64_from_string(String str);
+
+function Hash64_State hash64_begin(u64 seed);
+function void hash64_update(Hash64_State *state, void const *data, i64 len);
+function u64 hash64_end(Hash64_State *state);
+
+// Checksums
+function u32 crc32_update(u32 crc, void const *data, i64 len);
+function u32 crc32(void const *data, i64 len);
+function u32 crc32c_update(u32 crc, void const *data, i64 len);
+function u32 crc32c(void const *data, i64 len);
+function u32 adler32_update(u32 adler, void const *data, i64 len);
+function u32 adler32(void const *data, i64 len);
+
+function u32 crc32_from_string(String str);
+function u32 crc32c_from_string(String str);
+function u32 adler32_from_string(String str);
+
 // Random
 function Random_LCG random_make_lcg();
 function void random_lcg_set_seed(Random_LCG *series, u32 state);
@@ -1790,6 +2396,25 @@ function f32 random_pcg_between_f32(Random_PCG *series, f32 min, f32 max);
 function i32 random_pcg_between_i32(Random_PCG *series, i32 min, i32 max);
 function void random_pcg_shuffle(Random_PCG *it, void *base, u64 count, u64 size);
 
+function Random_Xoshiro random_make_xoshiro();
+function void random_xoshiro_set_seed(Random_Xoshiro *it, u64 seed);
+function void random_xoshiro_long_jump(Random_Xoshiro *it);
+function Random_Xoshiro random_xoshiro_split(Random_Xoshiro *it);
+function u64 random_xoshiro_u64(Random_Xoshiro *it);
+function u32 random_xoshiro_u32(Random_Xoshiro *it);
+function f32 random_xoshiro_f32(Random_Xoshiro *it);
+function f64 random_xoshiro_f64(Random_Xoshiro *it);
+function u64 random_xoshiro_below(Random_Xoshiro *it, u64 bound);
+function void random_xoshiro_shuffle(Random_Xoshiro *it, void *base, u64 count, u64 size);
+function void random_xoshiro_fill_u64(Random_Xoshiro *it, u64 *dest, i64 count);
+function void random_xoshiro_fill_u32(Random_Xoshiro *it, u32 *dest, i64 count);
+function void random_xoshiro_fill_f32(Random_Xoshiro *it, f32 *dest, i64 count);
+function void random_xoshiro_fill_f64(Random_Xoshiro *it, f64 *dest, i64 count);
+function void random_xoshiro_fill_normal_f32(Random_Xoshiro *it, f32 *dest, i64 count, f32 mean, f32 stddev);
+function void random_xoshiro_fill_normal_f64(Random_Xoshiro *it, f64 *dest, i64 count, f64 mean, f64 stddev);
+function void random_xoshiro_fill_exponential_f32(Random_Xoshiro *it, f32 *dest, i64 count, f32 rate);
+function void random_xoshiro_fill_exponential_f64(Random_Xoshiro *it, f64 *dest, i64 count, f64 rate);
+
 function void random_init();
 function void random_set_seed(u64 seed);
 function u32 random_next_u32();
@@ -1805,8 +2430,20 @@ function void timing_reset(Timing_f64 *it, f64 current);
 function void timing_update(Timing_f64 *it, f64 current, u64 fps);
 
 // Base64
+function i64 base64_encoded_size(i64 count, bool url_safe);
+function i64 base64_decoded_size(String input, bool skip_whitespace);
+function i64 base64_write_encoded(u8 *dest, String input, bool url_safe);
+function i64 base64_write_decoded(u8 *dest, String input, bool skip_whitespace);
 function String base64_encode(Arena *arena, String input, bool url_safe);
 function String base64_decode(Arena *arena, String input);
+function String base64_decode_skip_whitespace(Arena *arena, String input);
+
+function Base64_Encoder base64_encoder_make(bool url_safe);
+function i64 base64_encoder_push(Base64_Encoder *it, String input, u8 *dest);
+function i64 base64_encoder_finish(Base64_Encoder *it, u8 *dest);
+function Base64_Decoder base64_decoder_make(bool skip_whitespace);
+function i64 base64_decoder_push(Base64_Decoder *it, String input, u8 *dest);
+function i64 base64_decoder_finish(Base64_Decoder *it, u8 *dest);
 
 #endif // BASE_FUNCTIONS_H
 #ifndef OS_H
@@ -1945,9 +2582,15 @@ function void os_set_high_process_priority(bool enable);
 // Memory
 function u64  os_memory_page_size();
 function void *os_memory_reserve(u64 size);
+function void *os_memory_reserve_at(void *address, u64 size);
 function bool os_memory_commit(void *ptr, u64 size);
 function bool os_memory_decommit(void *ptr, u64 size);
 function bool os_memory_release(void *ptr, u64 size);
+function u64  os_memory_large_page_size();
+function void *os_memory_reserve_large(u64 size);
+function void os_memory_prefault(void *ptr, u64 size);
+function void *os_memory_mirror_alloc(u64 size);
+function void os_memory_mirror_release(void *ptr, u64 size);
 function void *os_alloc(u64 size);
 function void os_free(void *ptr);
 #define New(T, count) (T *)os_alloc((count) * sizeof(T))
@@ -1983,6 +2626,11 @@ function bool os_make_directory_recursive(String path);
 #define os_mkdir os_make_directory
 #define os_mkdirp os_make_directory_recursive
 
+// Arena Snapshots
+// NOTE(nick): saving fails for chained, shared and debug arenas
+function bool arena_save_snapshot(Arena *arena, String path);
+function Arena *arena_load_snapshot(String path, u64 reserve_size, i64 *relocation);
+
 // File Lister
 function File_Lister *os_file_iter_begin(Arena *arena, String path);
 function bool os_file_iter_next(Arena *arena, File_Lister *iter, File_Info *info);
@@ -2056,6 +2704,7 @@ struct Mutex {
 
 // Atomics
 function u32 atomic_compare_exchange_u32(u32 volatile *value, u32 New, u32 Expected);
+function u64 atomic_compare_exchange_u64(u64 volatile *value, u64 New, u64 Expected);
 function u64 atomic_exchange_u64(u64 volatile *value, u64 New);
 function u64 atomic_add_u64(u64 volatile *value, u64 Addend);
 
@@ -2115,6 +2764,39 @@ struct Worker_Params
 function void work_queue_init(Work_Queue *queue, u64 thread_count);
 function void work_queue_add_entry(Work_Queue *queue, Worker_Proc *callback, void *data);
 
+//
+// Ring Buffer
+//
+
+// NOTE(nick): the same pages are mapped twice back to back, so both the readable and
+// the writable region are always one contiguous span, even when they wrap around.
+
+typedef struct Ring_Buffer Ring_Buffer;
+struct Ring_Buffer
+{
+    u8 *data;
+    u64 capacity;
+
+    // NOTE(nick): these only ever grow, the offset into data is pos & (capacity - 1)
+    u64 read_pos;
+    u64 write_pos;
+};
+
+function Ring_Buffer ring_buffer_alloc(u64 min_capacity);
+function void ring_buffer_release(Ring_Buffer *ring);
+function void ring_buffer_reset(Ring_Buffer *ring);
+
+function u64 ring_buffer_count(Ring_Buffer *ring);
+function u64 ring_buffer_space(Ring_Buffer *ring);
+
+function String ring_buffer_readable(Ring_Buffer *ring);
+function String ring_buffer_writable(Ring_Buffer *ring);
+function void ring_buffer_consume(Ring_Buffer *ring, u64 size);
+function void ring_buffer_commit(Ring_Buffer *ring, u64 size);
+
+function u64 ring_buffer_write(Ring_Buffer *ring, String data);
+function u64 ring_buffer_read(Ring_Buffer *ring, u8 *data, u64 size);
+
 //
 // Platform-Specific Headers:
 //
@@ -2145,86 +2827,480 @@ function void work_queue_add_entry(Work_Queue *queue, Worker_Proc *callback, voi
 #ifndef NA_H_IMPL
 #define NA_H_IMPL
 
+#if ARCH_AVX2
+    #include <immintrin.h>
+#elif ARCH_SSE2
+    #include <emmintrin.h>
+#elif ARCH_NEON
+    #include <arm_neon.h>
+#endif
+
+#if ARCH_SSSE3 && !ARCH_AVX2
+    #include <tmmintrin.h>
+#endif
+#if ARCH_SSE42 && !ARCH_AVX2
+    #include <nmmintrin.h>
+#endif
+#if ARCH_ARM_CRC32
+    #include <arm_acle.h>
+#endif
 
 //
-// Arena
+// SIMD
 //
 
-#if !defined(ARENA_DEFAULT_ALIGNMENT)
-    #define ARENA_DEFAULT_ALIGNMENT 8
-#endif
+//
+// NOTE(nick): a tiny byte-vector layer so the string scanners can be written once.
+// Comparisons produce 0xff/0x00 lanes, and simd__mask turns them into a bitmask with
+// SIMD_LANE_BITS bits per lane (NEON has no movemask, so it gets 4 bits per lane).
+//
 
-#if !defined(ARENA_COMMIT_SIZE)
-    #define ARENA_COMMIT_SIZE Kilobytes(4)
+#if ARCH_AVX2
+    typedef __m256i Simd_U8;
+    #define SIMD_WIDTH 32
+    #define SIMD_LANE_BITS 1
+#elif ARCH_SSE2
+    typedef __m128i Simd_U8;
+    #define SIMD_WIDTH 16
+    #define SIMD_LANE_BITS 1
+#elif ARCH_NEON
+    typedef uint8x16_t Simd_U8;
+    #define SIMD_WIDTH 16
+    #define SIMD_LANE_BITS 4
+#else
+    typedef struct Simd_U8 Simd_U8;
+    struct Simd_U8
+    {
+        u8 e[8];
+    };
+    #define SIMD_WIDTH 8
+    #define SIMD_LANE_BITS 1
 #endif
 
-#if !defined(ARENA_DECOMMIT_THRESHOLD)
-    #define ARENA_DECOMMIT_THRESHOLD Kilobytes(256)
-#endif
+#define SIMD_LANE_MASK (((u64)1 << SIMD_LANE_BITS) - 1)
 
-#define arena_has_virtual_backing(arena) ((arena)->commit_pos < U64_MAX)
+// NOTE(nick): a 16 entry byte table lookup per lane (pshufb / tbl), 32-bit ARM doesn't have tbl on q registers
+#if ARCH_AVX2 || (ARCH_SSE2 && ARCH_SSSE3) || (ARCH_NEON && (defined(__aarch64__) || defined(_M_ARM64)))
+    #define SIMD_HAS_SHUFFLE 1
+#else
+    #define SIMD_HAS_SHUFFLE 0
+#endif
 
-function Arena *arena_make_from_buffer(u8 *data, u64 size)
+force_inline function Simd_U8 simd__load(u8 *data)
 {
-    Arena *result = NULL;
-    if (data)
-    {
-        result = cast(Arena *)data;
-        result->data = data + AlignUpPow2(sizeof(Arena), 64);
-        result->size = size;
-        result->pos  = 0;
-        result->commit_pos = U64_MAX;
-        result->page_size = 0;
-    }
-    assert(result != 0);
+    #if ARCH_AVX2
+    return _mm256_loadu_si256((__m256i *)data);
+    #elif ARCH_SSE2
+    return _mm_loadu_si128((__m128i *)data);
+    #elif ARCH_NEON
+    return vld1q_u8(data);
+    #else
+    Simd_U8 result;
+    MemoryCopy(result.e, data, sizeof(result.e));
     return result;
+    #endif
 }
 
-function Arena *arena_alloc(u64 size)
+force_inline function Simd_U8 simd__set1(u8 value)
 {
-    u64 page_size = os_memory_page_size();
-    u64 initial_commit_size = Max(page_size, ARENA_COMMIT_SIZE);
-
-    size = Max(size, initial_commit_size);
+    #if ARCH_AVX2
+    return _mm256_set1_epi8((char)value);
+    #elif ARCH_SSE2
+    return _mm_set1_epi8((char)value);
+    #elif ARCH_NEON
+    return vdupq_n_u8(value);
+    #else
+    Simd_U8 result;
+    for (u32 i = 0; i < SIMD_WIDTH; i += 1) result.e[i] = value;
+    return result;
+    #endif
+}
 
-    Arena *result = NULL;
-    u8 *data = cast(u8 *)os_memory_reserve(size);
+force_inline function Simd_U8 simd__eq(Simd_U8 a, Simd_U8 b)
+{
+    #if ARCH_AVX2
+    return _mm256_cmpeq_epi8(a, b);
+    #elif ARCH_SSE2
+    return _mm_cmpeq_epi8(a, b);
+    #elif ARCH_NEON
+    return vceqq_u8(a, b);
+    #else
+    Simd_U8 result;
+    for (u32 i = 0; i < SIMD_WIDTH; i += 1) result.e[i] = a.e[i] == b.e[i] ? 0xff : 0;
+    return result;
+    #endif
+}
 
-    if (data && os_memory_commit(data, initial_commit_size))
+force_inline function Simd_U8 simd__or(Simd_U8 a, Simd_U8 b)
+{
+    #if ARCH_AVX2
+    return _mm256_or_si256(a, b);
+    #elif ARCH_SSE2
+    return _mm_or_si128(a, b);
+    #elif ARCH_NEON
+    return vorrq_u8(a, b);
+    #else
+    Simd_U8 result;
+    for (u32 i = 0; i < SIMD_WIDTH; i += 1) result.e[i] = a.e[i] | b.e[i];
+    return result;
+    #endif
+}
+
+force_inline function Simd_U8 simd__and(Simd_U8 a, Simd_U8 b)
+{
+    #if ARCH_AVX2
+    return _mm256_and_si256(a, b);
+    #elif ARCH_SSE2
+    return _mm_and_si128(a, b);
+    #elif ARCH_NEON
+    return vandq_u8(a, b);
+    #else
+    Simd_U8 result;
+    for (u32 i = 0; i < SIMD_WIDTH; i += 1) result.e[i] = a.e[i] & b.e[i];
+    return result;
+    #endif
+}
+
+force_inline function void simd__store(u8 *data, Simd_U8 x)
+{
+    #if ARCH_AVX2
+    _mm256_storeu_si256((__m256i *)data, x);
+    #elif ARCH_SSE2
+    _mm_storeu_si128((__m128i *)data, x);
+    #elif ARCH_NEON
+    vst1q_u8(data, x);
+    #else
+    MemoryCopy(data, x.e, sizeof(x.e));
+    #endif
+}
+
+force_inline function Simd_U8 simd__xor(Simd_U8 a, Simd_U8 b)
+{
+    #if ARCH_AVX2
+    return _mm256_xor_si256(a, b);
+    #elif ARCH_SSE2
+    return _mm_xor_si128(a, b);
+    #elif ARCH_NEON
+    return veorq_u8(a, b);
+    #else
+    Simd_U8 result;
+    for (u32 i = 0; i < SIMD_WIDTH; i += 1) result.e[i] = a.e[i] ^ b.e[i];
+    return result;
+    #endif
+}
+
+force_inline function Simd_U8 simd__add(Simd_U8 a, Simd_U8 b)
+{
+    #if ARCH_AVX2
+    return _mm256_add_epi8(a, b);
+    #elif ARCH_SSE2
+    return _mm_add_epi8(a, b);
+    #elif ARCH_NEON
+    return vaddq_u8(a, b);
+    #else
+    Simd_U8 result;
+    for (u32 i = 0; i < SIMD_WIDTH; i += 1) result.e[i] = (u8)(a.e[i] + b.e[i]);
+    return result;
+    #endif
+}
+
+// NOTE(nick): lanes where min <= x <= max, unsigned
+force_inline function Simd_U8 simd__in_range(Simd_U8 x, u8 min, u8 max)
+{
+    #if ARCH_AVX2
+    __m256i d = _mm256_sub_epi8(x, _mm256_set1_epi8((char)min));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8((char)(max - min))), d);
+    #elif ARCH_SSE2
+    __m128i d = _mm_sub_epi8(x, _mm_set1_epi8((char)min));
+    return _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)(max - min))), d);
+    #elif ARCH_NEON
+    return vcleq_u8(vsubq_u8(x, vdupq_n_u8(min)), vdupq_n_u8(max - min));
+    #else
+    Simd_U8 result;
+    for (u32 i = 0; i < SIMD_WIDTH; i += 1) result.e[i] = (u8)(x.e[i] - min) <= (u8)(max - min) ? 0xff : 0;
+    return result;
+    #endif
+}
+
+// NOTE(nick): ASCII only, same as char_to_lower
+force_inline function Simd_U8 simd__to_lower(Simd_U8 x)
+{
+    return simd__or(x, simd__and(simd__in_range(x, 'A', 'Z'), simd__set1(0x20)));
+}
+
+// NOTE(nick): ASCII only, same as char_to_upper
+force_inline function Simd_U8 simd__to_upper(Simd_U8 x)
+{
+    return simd__xor(x, simd__and(simd__in_range(x, 'a', 'z'), simd__set1(0x20)));
+}
+
+// NOTE(nick): simd__mask of a vector with every lane set
+#if SIMD_WIDTH * SIMD_LANE_BITS == 64
+    #define SIMD_MASK_ALL U64_MAX
+#else
+    #define SIMD_MASK_ALL ((((u64)1) << (SIMD_WIDTH * SIMD_LANE_BITS)) - 1)
+#endif
+
+#if SIMD_HAS_SHUFFLE
+//
+// NOTE(nick): byte set membership from two nibble lookups. rows[lo] has bit (hi & 7) set
+// for every byte (hi << 4 | lo) in the set, rows[0..15] cover hi < 8 and rows[16..31] the rest.
+//
+force_inline function Simd_U8 simd__in_nibble_set(Simd_U8 x, u8 *rows)
+{
+    #if ARCH_AVX2
+    __m256i rows_lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i *)rows));
+    __m256i rows_hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i *)(rows + 16)));
+    __m256i bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                    1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    __m256i nibble = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_and_si256(x, nibble);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+    __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(rows_lo, lo), _mm256_shuffle_epi8(rows_hi, lo),
+                                     _mm256_slli_epi16(hi, 4));
+    __m256i bit = _mm256_shuffle_epi8(bits, hi);
+    return _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit);
+    #elif ARCH_SSE2
+    __m128i rows_lo = _mm_loadu_si128((__m128i *)rows);
+    __m128i rows_hi = _mm_loadu_si128((__m128i *)(rows + 16));
+    __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    __m128i nibble = _mm_set1_epi8(0x0f);
+    __m128i lo = _mm_and_si128(x, nibble);
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+    __m128i use_hi = _mm_cmpgt_epi8(hi, _mm_set1_epi8(7));
+    __m128i row = _mm_or_si128(_mm_andnot_si128(use_hi, _mm_shuffle_epi8(rows_lo, lo)),
+                               _mm_and_si128(use_hi, _mm_shuffle_epi8(rows_hi, lo)));
+    __m128i bit = _mm_shuffle_epi8(bits, hi);
+    return _mm_cmpeq_epi8(_mm_and_si128(row, bit), bit);
+    #elif ARCH_NEON
+    // NOTE(nick): tbl on 32 bytes indexes both halves at once, so the high nibble just picks the half
+    uint8x16x2_t table = {{vld1q_u8(rows), vld1q_u8(rows + 16)}};
+    uint8x16_t hi = vshrq_n_u8(x, 4);
+    uint8x16_t index = vorrq_u8(vandq_u8(x, vdupq_n_u8(0x0f)), vshlq_n_u8(vandq_u8(hi, vdupq_n_u8(0x08)), 1));
+    uint8x16_t row = vqtbl2q_u8(table, index);
+    uint8x16_t bit = vshlq_u8(vdupq_n_u8(1), vreinterpretq_s8_u8(vandq_u8(hi, vdupq_n_u8(0x07))));
+    return vtstq_u8(row, bit);
+    #endif
+}
+#endif
+
+force_inline function u64 simd__mask(Simd_U8 x)
+{
+    #if ARCH_AVX2
+    return (u32)_mm256_movemask_epi8(x);
+    #elif ARCH_SSE2
+    return (u32)_mm_movemask_epi8(x);
+    #elif ARCH_NEON
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(x), 4)), 0);
+    #else
+    u64 result = 0;
+    for (u32 i = 0; i < SIMD_WIDTH; i += 1) result |= (u64)(x.e[i] & 1) << i;
+    return result;
+    #endif
+}
+
+//
+// Arena
+//
+
+#if !defined(ARENA_DEFAULT_ALIGNMENT)
+    #define ARENA_DEFAULT_ALIGNMENT 8
+#endif
+
+#if !defined(ARENA_COMMIT_SIZE)
+    #define ARENA_COMMIT_SIZE Kilobytes(4)
+#endif
+
+#if !defined(ARENA_DECOMMIT_THRESHOLD)
+    #define ARENA_DECOMMIT_THRESHOLD Kilobytes(256)
+#endif
+
+#if !defined(ARENA_LARGE_COMMIT_SIZE)
+    #define ARENA_LARGE_COMMIT_SIZE Megabytes(2)
+#endif
+
+#define arena_has_virtual_backing(arena) ((arena)->commit_pos < U64_MAX)
+
+#define ARENA_HEADER_SIZE AlignUpPow2(sizeof(Arena), 64)
+
+function Arena *arena_make_from_buffer(u8 *data, u64 size)
+{
+    Arena *result = NULL;
+    if (data)
+    {
+        result = cast(Arena *)data;
+        result->flags = ArenaFlag_NoChain;
+        result->current = result;
+        result->prev = NULL;
+        result->data = data + ARENA_HEADER_SIZE;
+        result->size = size;
+        result->pos  = 0;
+        result->commit_pos = U64_MAX;
+        result->page_size = 0;
+        result->base_pos = 0;
+        result->commit_lock = 0;
+
+        #if ARENA_STATS
+        MemoryZeroStruct(&result->stats);
+        #endif
+    }
+    assert(result != 0);
+    return result;
+}
+
+function Arena *arena_alloc_with_flags(u64 size, Arena_Flags flags)
+{
+    #if ARENA_DEBUG
+    if (!(flags & ArenaFlag_Shared)) flags |= ArenaFlag_Debug;
+    #endif
+
+    // NOTE(nick): guard pages can't be carved out of a huge page
+    if (flags & ArenaFlag_Debug) flags &= ~ArenaFlag_LargePages;
+
+    u64 page_size = os_memory_page_size();
+    u64 commit_size = ARENA_COMMIT_SIZE;
+
+    if (flags & ArenaFlag_LargePages)
+    {
+        commit_size = Max(ARENA_LARGE_COMMIT_SIZE, os_memory_large_page_size());
+        size = AlignUpPow2(size, commit_size);
+    }
+
+    u64 initial_commit_size = Max(page_size, commit_size);
+
+    size = Max(size, initial_commit_size);
+
+    Arena *result = NULL;
+    u8 *data = NULL;
+    if (flags & ArenaFlag_LargePages)
+    {
+        data = cast(u8 *)os_memory_reserve_large(size);
+    }
+    else
+    {
+        data = cast(u8 *)os_memory_reserve(size);
+    }
+
+    #if ARENA_STATS
+    f64 start_time = os_clock();
+    #endif
+
+    if (data && os_memory_commit(data, initial_commit_size))
     {
+        if (flags & ArenaFlag_Prefault)
+        {
+            os_memory_prefault(data, initial_commit_size);
+        }
+
         result = cast(Arena *)data;
-        result->data = data + AlignUpPow2(sizeof(Arena), 64);
+        result->flags = flags;
+        result->current = result;
+        result->prev = NULL;
+        result->data = data + ARENA_HEADER_SIZE;
         result->size = size;
         result->pos  = 0;
         result->commit_pos = initial_commit_size;
-        result->page_size  = Max(page_size, ARENA_COMMIT_SIZE);
+        result->page_size  = initial_commit_size;
+        result->base_pos = 0;
+        result->commit_lock = 0;
+
+        #if ARENA_STATS
+        MemoryZeroStruct(&result->stats);
+        result->stats.committed = initial_commit_size;
+        result->stats.peak_committed = initial_commit_size;
+        result->stats.commit_count = 1;
+        result->stats.commit_time = os_clock() - start_time;
+        #endif
     }
 
     assert(result != 0);
     return result;
 }
 
+function Arena *arena_alloc(u64 size)
+{
+    return arena_alloc_with_flags(size, 0);
+}
+
+function bool arena__commit(Arena *arena, void *ptr, u64 size)
+{
+    #if ARENA_STATS
+    f64 start_time = os_clock();
+    #endif
+
+    bool result = os_memory_commit(ptr, size);
+    if (result && (arena->flags & ArenaFlag_Prefault))
+    {
+        os_memory_prefault(ptr, size);
+    }
+
+    #if ARENA_STATS
+    if (result)
+    {
+        arena->stats.commit_count += 1;
+        arena->stats.commit_time += os_clock() - start_time;
+        arena->stats.committed += size;
+        arena->stats.peak_committed = Max(arena->stats.peak_committed, arena->stats.committed);
+    }
+    #endif
+
+    return result;
+}
+
+function bool arena__decommit(Arena *arena, void *ptr, u64 size)
+{
+    #if ARENA_STATS
+    f64 start_time = os_clock();
+    #endif
+
+    bool result = os_memory_decommit(ptr, size);
+
+    #if ARENA_STATS
+    if (result)
+    {
+        arena->stats.decommit_count += 1;
+        arena->stats.decommit_time += os_clock() - start_time;
+        arena->stats.committed -= size;
+    }
+    #endif
+
+    return result;
+}
+
+function void arena__release_block(Arena *block)
+{
+    if (arena_has_virtual_backing(block))
+    {
+        os_memory_release(block, block->size);
+    }
+}
+
 function void arena_free(Arena *arena)
 {
     if (arena->data)
     {
-        arena->data = NULL;
-
-        if (arena_has_virtual_backing(arena))
+        Arena *current = arena->current;
+        while (current && current != arena)
         {
-            os_memory_release(arena, arena->size);
+            Arena *prev = current->prev;
+            arena__release_block(current);
+            current = prev;
         }
+
+        arena->data = NULL;
+        arena->current = arena;
+        arena__release_block(arena);
     }
 }
 
-function void *arena_push(Arena *arena, u64 size, u64 align_pow2, b32 zero)
+function void *arena__push_in_block(Arena *arena, Arena *block, u64 size, u64 align_pow2, b32 zero)
 {
     void *result = NULL;
 
     u64 align_offset = 0;
     if (align_pow2 > 1)
     {
-        u64 p = arena->pos;
+        u64 p = block->pos;
         u64 p_aligned = AlignUpPow2(p, align_pow2);
         u64 z = p_aligned - p;
         if (z > 0)
@@ -2233,33 +3309,34 @@ function void *arena_push(Arena *arena, u64 size, u64 align_pow2, b32 zero)
         }
     }
 
-    if (arena->pos + size + align_offset <= arena->size)
+    if (ARENA_HEADER_SIZE + block->pos + size + align_offset <= block->size)
     {
-        void *result_on_success = arena->data + arena->pos + align_offset;
-        u64 p = arena->pos + size + align_offset;
-        u64 commit_p = arena->commit_pos;
+        void *result_on_success = block->data + block->pos + align_offset;
+        u64 p = block->pos + size + align_offset;
+        u64 commit_p = block->commit_pos;
 
-        if (arena_has_virtual_backing(arena))
+        if (arena_has_virtual_backing(block))
         {
-            u64 base_p = p + AlignUpPow2(sizeof(Arena), 64);
+            u64 base_p = p + ARENA_HEADER_SIZE;
             if (base_p > commit_p)
             {
-                u64 p_aligned = AlignUpPow2(base_p, arena->page_size);
-                u64 next_commit_position = ClampTop(p_aligned, arena->size);
+                u64 p_aligned = AlignUpPow2(base_p, block->page_size);
+                u64 next_commit_position = ClampTop(p_aligned, block->size);
                 u64 commit_size = next_commit_position - commit_p;
 
-                if (os_memory_commit((u8 *)arena + arena->commit_pos, commit_size))
+                if (arena__commit(arena, (u8 *)block + block->commit_pos, commit_size))
                 {
-                    commit_p = next_commit_position;
-                    arena->commit_pos = next_commit_position;
+                    block->commit_pos = next_commit_position;
                 }
             }
+
+            commit_p = block->commit_pos - ARENA_HEADER_SIZE;
         }
 
         if (p <= commit_p)
         {
             result = result_on_success;
-            arena->pos = p;
+            block->pos = p;
 
             if (zero)
             {
@@ -2271,2576 +3348,8477 @@ function void *arena_push(Arena *arena, u64 size, u64 align_pow2, b32 zero)
     return result;
 }
 
-function void arena_pop_to(Arena *arena, u64 pos)
+function void *arena__push_shared(Arena *arena, u64 size, u64 align_pow2, b32 zero)
 {
-    if (arena->pos > pos)
+    void *result = NULL;
+
+    if (align_pow2 < 1) align_pow2 = 1;
+
+    // NOTE(nick): the aligned range is worked out from the position we saw and only taken if
+    // pos is still there, so a push never bumps past space it then has to abandon. A push that
+    // doesn't fit leaves pos alone.
+    u64 start = atomic_add_u64((u64 volatile *)&arena->pos, 0);
+    u64 aligned_start = 0;
+    u64 end = 0;
+    b32 fits = false;
+    for (;;)
+    {
+        aligned_start = AlignUpPow2(start, align_pow2);
+        end = aligned_start + size;
+
+        if (ARENA_HEADER_SIZE + end > arena->size) break;
+
+        u64 seen = atomic_compare_exchange_u64((u64 volatile *)&arena->pos, end, start);
+        if (seen == start)
+        {
+            fits = true;
+            break;
+        }
+        start = seen;
+    }
+
+    if (fits)
     {
-        arena->pos = pos;
+        b32 committed = true;
 
-        if (arena_has_virtual_backing(arena))
+        // NOTE(nick): commit_pos only changes under commit_lock, outside of it it's read atomically
+        u64 commit_pos = atomic_add_u64((u64 volatile *)&arena->commit_pos, 0);
+        if (commit_pos < U64_MAX)
         {
-            u64 base_p = pos + AlignUpPow2(sizeof(Arena), 64);
-            u64 decommit_pos = AlignUpPow2(base_p, arena->page_size);
-            u64 over_committed = arena->commit_pos - decommit_pos;
+            u64 base_p = end + ARENA_HEADER_SIZE;
 
-            if (decommit_pos < arena->commit_pos && over_committed >= ARENA_DECOMMIT_THRESHOLD)
+            // NOTE(nick): only one thread at a time grows the committed range,
+            // everyone else waits until their range has been committed for them.
+            while (commit_pos < base_p)
             {
-                if (os_memory_decommit((u8 *)arena + decommit_pos, over_committed))
+                if (atomic_compare_exchange_u32(&arena->commit_lock, 1, 0) == 0)
                 {
-                    arena->commit_pos -= over_committed;
+                    u64 commit_p = arena->commit_pos;
+                    if (commit_p < base_p)
+                    {
+                        u64 p_aligned = AlignUpPow2(base_p, arena->page_size);
+                        u64 next_commit_position = ClampTop(p_aligned, arena->size);
+
+                        if (arena__commit(arena, (u8 *)arena + commit_p, next_commit_position - commit_p))
+                        {
+                            atomic_exchange_u64((u64 volatile *)&arena->commit_pos, next_commit_position);
+                        }
+                        else
+                        {
+                            committed = false;
+                        }
+                    }
+
+                    atomic_write_barrier();
+                    arena->commit_lock = 0;
+
+                    if (!committed) break;
                 }
+
+                atomic_read_barrier();
+                commit_pos = atomic_add_u64((u64 volatile *)&arena->commit_pos, 0);
             }
         }
-    }
-}
-
-function void arena_pop(Arena *arena, u64 size)
-{
-    arena_pop_to(arena, arena->pos - size);
-}
 
-function void arena_set_pos(Arena *arena, u64 pos)
-{
-    if (pos < arena->size)
-    {
-        if (pos < arena->pos)
+        if (committed)
         {
-            arena_pop_to(arena, pos);
+            result = arena->data + aligned_start;
+
+            if (zero)
+            {
+                MemoryZero(result, size);
+            }
         }
-        else if (pos > arena->pos)
+        else
         {
-            u64 d = pos - arena->pos;
-            arena_push(arena, d, 0, false);
+            // NOTE(nick): only undo the bump if nobody pushed after us, their range is fine
+            atomic_compare_exchange_u64((u64 volatile *)&arena->pos, start, end);
         }
     }
-}
-
-function void arena_reset(Arena *arena)
-{
-    arena_pop_to(arena, 0);
-}
-
-function bool arena_write(Arena *arena, u8 *data, u64 size)
-{
-    bool result = false;
-    u8 *buffer = (u8 *)arena_push(arena, size, 0, false);
-    if (buffer)
-    {
-        MemoryCopy(buffer, data, size);
-        result = true;
-    }
-    return result;
-}
 
-function M_Temp arena_begin_temp(Arena *arena)
-{
-    M_Temp result = {arena, arena->pos};
     return result;
 }
 
-function void arena_end_temp(M_Temp temp)
+function void *arena__push_debug(Arena *arena, Arena *block, u64 size, u64 align_pow2, b32 zero)
 {
-    arena_pop_to(temp.arena, temp.pos);
-}
-
-thread_local Arena *m__scratch_pool[2] = {0, 0};
+    void *result = NULL;
 
-function M_Temp arena_get_scratch(Arena **conflicts, u64 conflict_count)
-{
-    if (m__scratch_pool[0] == NULL)
+    u64 page_size = os_memory_page_size();
+    u64 align = Max(align_pow2, 1);
+    assert(align <= page_size);
+
+    // NOTE(nick): place the allocation so it ends as close to a page boundary as the
+    // alignment allows, the page after that is left uncommitted as a guard. Starting
+    // on a fresh page means popping it never leaves part of it accessible.
+    u64 start_p = AlignUpPow2(ARENA_HEADER_SIZE + block->pos, page_size);
+    u64 end_p = AlignUpPow2(start_p + size, page_size);
+    u64 data_p = AlignDownPow2(end_p - size, align);
+    if (data_p < start_p)
     {
-        m__scratch_pool[0] = arena_alloc(Gigabytes(1));
-        m__scratch_pool[1] = arena_alloc(Gigabytes(1));
-        assert(m__scratch_pool[0]);
-        assert(m__scratch_pool[1]);
+        end_p += page_size;
+        data_p = AlignDownPow2(end_p - size, align);
     }
 
-    M_Temp result = {0};
-    for (u64 i = 0; i < count_of(m__scratch_pool); i += 1)
+    u64 guard_p = end_p + page_size;
+    if (guard_p <= block->size)
     {
-        b32 is_conflict = false;
-        for (Arena **conflict = conflicts; conflict < conflicts+conflict_count; conflict += 1)
+        b32 committed = true;
+        if (end_p > block->commit_pos)
         {
-            if (*conflict == m__scratch_pool[i]) {
-                is_conflict = true;
-                break;
-            }
+            committed = arena__commit(arena, (u8 *)block + block->commit_pos, end_p - block->commit_pos);
         }
 
-        if (!is_conflict) {
-            result = arena_begin_temp(m__scratch_pool[i]);
-            break;
+        if (committed)
+        {
+            // NOTE(nick): catch the bytes between the allocation and the guard page with ASAN
+            AsanPoisonMemoryRegion((u8 *)block + start_p, data_p - start_p);
+            AsanPoisonMemoryRegion((u8 *)block + data_p + size, end_p - (data_p + size));
+
+            block->commit_pos = guard_p;
+            block->pos = guard_p - ARENA_HEADER_SIZE;
+
+            #if ARENA_STATS
+            // NOTE(nick): guard pages are counted as committed so that pops balance out
+            arena->stats.committed += page_size;
+            arena->stats.peak_committed = Max(arena->stats.peak_committed, arena->stats.committed);
+            #endif
+
+            result = (u8 *)block + data_p;
+            if (zero)
+            {
+                MemoryZero(result, size);
+            }
         }
     }
-    return result;
-}
 
-function Arena *temp_arena()
-{
-    return arena_get_scratch(0, 0).arena;
+    return result;
 }
 
-function void *arena_realloc_ptr(Arena *arena, u64 new_size, void *old_memory_pointer, u64 old_size)
+function void *arena_push(Arena *arena, u64 size, u64 align_pow2, b32 zero)
 {
     void *result = NULL;
+    Arena *current = arena->current;
 
-    if (old_memory_pointer && old_size > 0)
+    if (arena->flags & ArenaFlag_Shared)
     {
-        u64 old_memory_offset = (u8 *)(old_memory_pointer) - arena->data;
-        if (old_memory_offset == arena->pos - old_size)
-        {
-            arena_set_pos(arena, old_memory_offset + new_size);
-            result = old_memory_pointer;
-        }
+        result = arena__push_shared(arena, size, align_pow2, zero);
     }
-
-    if (!result)
+    else if (arena->flags & ArenaFlag_Debug)
     {
-        result = arena_push(arena, new_size, 0, false);
-
-        if (result && old_memory_pointer)
-        {
-            MemoryCopy(result, old_memory_pointer, Min(new_size, old_size));
-        }
+        result = arena__push_debug(arena, current, size, align_pow2, zero);
+    }
+    else
+    {
+        result = arena__push_in_block(arena, current, size, align_pow2, zero);
     }
 
-    return result;
-}
+    if (!result && !(arena->flags & (ArenaFlag_NoChain|ArenaFlag_Shared)) && arena_has_virtual_backing(arena))
+    {
+        // NOTE(nick): new blocks are at least as big as the first reservation,
+        // or big enough to hold this allocation if it's larger than that.
+        u64 block_size = arena->size;
+        u64 needed_size = ARENA_HEADER_SIZE + size + align_pow2;
+        if (arena->flags & ArenaFlag_Debug)
+        {
+            needed_size += 2 * os_memory_page_size();
+        }
+        if (needed_size > block_size)
+        {
+            block_size = AlignUpPow2(needed_size, arena->page_size);
+        }
 
-function void arena_free_ptr(Arena *arena, void *old_memory_pointer, u64 old_size)
-{
-    if (old_memory_pointer && old_size > 0)
+        Arena *block = arena_alloc_with_flags(block_size, arena->flags);
+        if (block)
+        {
+            block->base_pos = current->base_pos + current->size;
+            block->prev = current;
+            arena->current = block;
+
+            #if ARENA_STATS
+            arena->stats.commit_count += block->stats.commit_count;
+            arena->stats.commit_time += block->stats.commit_time;
+            arena->stats.committed += block->commit_pos;
+            arena->stats.peak_committed = Max(arena->stats.peak_committed, arena->stats.committed);
+            #endif
+
+            if (arena->flags & ArenaFlag_Debug)
+            {
+                result = arena__push_debug(arena, block, size, align_pow2, zero);
+            }
+            else
+            {
+                result = arena__push_in_block(arena, block, size, align_pow2, zero);
+            }
+        }
+    }
+
+    #if ARENA_STATS
+    if (result)
     {
-        u64 old_memory_offset = (u8 *)(old_memory_pointer) - arena->data;
-        if (old_memory_offset == arena->pos - old_size)
+        if (arena->flags & ArenaFlag_Shared)
         {
-            arena_pop(arena, old_size);
+            atomic_add_u64(&arena->stats.push_count, 1);
+            if (zero) atomic_add_u64(&arena->stats.bytes_zeroed, size);
+        }
+        else
+        {
+            arena->stats.push_count += 1;
+            if (zero) arena->stats.bytes_zeroed += size;
         }
+        arena->stats.peak_pos = Max(arena->stats.peak_pos, arena_pos(arena));
     }
+    #endif
+
+    return result;
 }
 
-//
-// Memory
-//
+function u64 arena_pos(Arena *arena)
+{
+    Arena *current = arena->current;
+    return current->base_pos + current->pos;
+}
 
-function u64 m_align_offset(void *ptr, u64 alignment)
+function void arena_pop_to(Arena *arena, u64 pos)
 {
-    u64 base_address = (u64)ptr;
+    Arena *current = arena->current;
+    while (current != arena && current->base_pos >= pos)
+    {
+        Arena *prev = current->prev;
+        #if ARENA_STATS
+        arena->stats.decommit_count += 1;
+        arena->stats.committed -= current->commit_pos;
+        #endif
+        arena__release_block(current);
+        current = prev;
+    }
+    arena->current = current;
 
-    assert(alignment >= 1);
-    assert(IsPow2(alignment));
+    u64 local_pos = pos - current->base_pos;
+    if (current->pos > local_pos)
+    {
+        current->pos = local_pos;
 
-    u64 align_offset = alignment - (base_address & (alignment - 1));
-    align_offset &= (alignment - 1);
+        if (arena_has_virtual_backing(current))
+        {
+            u64 base_p = local_pos + ARENA_HEADER_SIZE;
+            u64 decommit_pos = AlignUpPow2(base_p, current->page_size);
+            u64 over_committed = current->commit_pos - decommit_pos;
+            u64 threshold = ARENA_DECOMMIT_THRESHOLD;
 
-    return align_offset;
-}
+            if (arena->flags & ArenaFlag_Debug)
+            {
+                // NOTE(nick): hand popped pages back right away so stale pointers fault
+                decommit_pos = AlignUpPow2(base_p, os_memory_page_size());
+                over_committed = current->commit_pos - decommit_pos;
+                threshold = 0;
 
-function void memory_swap(void *i, void *j, u64 size)
-{
-    if (size == 4) {
-        Swap(u32, *(u32 *)i, *(u32 *)j);
-    } else if (size == 8) {
-        Swap(u64, *(u64 *)i, *(u64 *)j);
-    } else if (size < 8) {
-        u8 *a = (u8 *)i;
-        u8 *b = (u8 *)j;
+                if (decommit_pos > base_p)
+                {
+                    AsanPoisonMemoryRegion((u8 *)current + base_p, decommit_pos - base_p);
+                }
+            }
 
-        if (a != b) {
-            while (size--) {
-                Swap(u8, *a, *b);
-                a++, b++;
+            if (decommit_pos < current->commit_pos && over_committed >= threshold)
+            {
+                if (arena__decommit(arena, (u8 *)current + decommit_pos, over_committed))
+                {
+                    current->commit_pos -= over_committed;
+                }
             }
         }
-    } else {
-        char buffer[256];
+    }
+}
 
-        // TODO(bill): Is the recursion ever a problem?
-        while (size > sizeof(buffer))
-        {
-            memory_swap(i, j, sizeof(buffer));
-            i = (void *)((u8 *)i + sizeof(buffer));
-            j = (void *)((u8 *)j + sizeof(buffer));
-            size -= sizeof(buffer);
-        }
+function void arena_pop(Arena *arena, u64 size)
+{
+    u64 pos = arena_pos(arena);
+    arena_pop_to(arena, pos - ClampTop(size, pos));
+}
 
-        MemoryCopy(buffer, i, size);
-        MemoryCopy(i, j, size);
-        MemoryCopy(j, buffer, size);
+function void arena_set_pos(Arena *arena, u64 pos)
+{
+    u64 current_pos = arena_pos(arena);
+    if (pos < current_pos)
+    {
+        arena_pop_to(arena, pos);
+    }
+    else if (pos > current_pos)
+    {
+        u64 d = pos - current_pos;
+        arena_push(arena, d, 0, false);
     }
 }
 
-function void memory_sort(void *base_, u64 count, u64 size, Compare_Proc cmp)
+function void arena_reset(Arena *arena)
 {
-    // TODO(bill): Make user definable?
-    #define GB__SORT_STACK_SIZE            64
-    #define GB__SORT_INSERT_SORT_THRESHOLD  8
+    arena_pop_to(arena, 0);
+}
 
-    #define GB__SORT_PUSH(_base, _limit) do { \
-        stack_ptr[0] = (_base); \
-        stack_ptr[1] = (_limit); \
-        stack_ptr += 2; \
-    } while (0)
+function bool arena_write(Arena *arena, u8 *data, u64 size)
+{
+    bool result = false;
+    u8 *buffer = (u8 *)arena_push(arena, size, 0, false);
+    if (buffer)
+    {
+        MemoryCopy(buffer, data, size);
+        result = true;
+    }
+    return result;
+}
 
-    #define GB__SORT_POP(_base, _limit) do { \
-        stack_ptr -= 2; \
-        (_base)  = stack_ptr[0]; \
-        (_limit) = stack_ptr[1]; \
-    } while (0)
+function M_Temp arena_begin_temp(Arena *arena)
+{
+    M_Temp result = {arena, arena_pos(arena)};
+    return result;
+}
 
-    u8 *i, *j;
-    u8 *base = (u8 *)base_;
-    u8 *limit = base + count*size;
-    u64 threshold = GB__SORT_INSERT_SORT_THRESHOLD * size;
+function void arena_end_temp(M_Temp temp)
+{
+    arena_pop_to(temp.arena, temp.pos);
+}
 
-    // NOTE(bill): Prepare the stack
-    u8 *stack[GB__SORT_STACK_SIZE] = {0};
-    u8 **stack_ptr = stack;
+//
+// Arena Stats
+//
 
-    for (;;) {
-        if ((limit-base) > (i64)threshold) {
-            // NOTE(bill): Quick sort
-            i = base + size;
-            j = limit - size;
+#if !defined(ARENA_STATS_MAX_SITES)
+    #define ARENA_STATS_MAX_SITES 1024
+#endif
 
-            memory_swap(((limit-base)/size/2) * size + base, base, size);
-            if (cmp(i, j) > 0)    memory_swap(i, j, size);
-            if (cmp(base, j) > 0) memory_swap(base, j, size);
-            if (cmp(i, base) > 0) memory_swap(i, base, size);
+#if ARENA_STATS
+static Arena_Site_Stats arena__site_stats[ARENA_STATS_MAX_SITES];
+#endif
 
-            for (;;) {
-                do i += size; while (cmp(i, base) < 0);
-                do j -= size; while (cmp(j, base) > 0);
-                if (i > j) break;
-                memory_swap(i, j, size);
-            }
+function Arena_Stats arena_get_stats(Arena *arena)
+{
+    Arena_Stats result = {0};
+    #if ARENA_STATS
+    result = arena->stats;
+    #endif
+    return result;
+}
 
-            memory_swap(base, j, size);
+function void arena_print_stats(Arena *arena)
+{
+    #if ARENA_STATS
+    Arena_Stats stats = arena->stats;
+    print("Arena %p:\n", arena);
+    print("    pos:       %llu (peak %llu)\n", arena_pos(arena), stats.peak_pos);
+    print("    committed: %llu (peak %llu)\n", stats.committed, stats.peak_committed);
+    print("    pushes:    %llu (%llu bytes zeroed)\n", stats.push_count, stats.bytes_zeroed);
+    print("    commits:   %llu (%.3fms)\n", stats.commit_count, stats.commit_time * 1000.0);
+    print("    decommits: %llu (%.3fms)\n", stats.decommit_count, stats.decommit_time * 1000.0);
+    #else
+    print("Arena %p: compile with ARENA_STATS=1 to collect stats\n", arena);
+    #endif
+}
 
-            if (j - base > limit - i) {
-                GB__SORT_PUSH(base, j);
-                base = i;
-            } else {
-                GB__SORT_PUSH(i, limit);
-                limit = j;
+function void *arena_push_site(Arena *arena, u64 size, u64 pow2_align, b32 zero, const char *file, u32 line)
+{
+    void *result = arena_push(arena, size, pow2_align, zero);
+
+    #if ARENA_STATS
+    if (result && line > 0)
+    {
+        // NOTE(nick): the same file can come in through different __FILE__ pointers (one
+        // per translation unit, or with string pooling off), so hash the contents.
+        // Slots are claimed by swapping in the line number.
+        u64 hash = 14695981039346656037ull;
+        for (const char *at = file; *at; at += 1)
+        {
+            hash = (hash ^ (u8)*at) * 1099511628211ull;
+        }
+        hash = (hash ^ line) * 1099511628211ull;
+        for (u64 probe = 0; probe < ARENA_STATS_MAX_SITES; probe += 1)
+        {
+            Arena_Site_Stats *site = &arena__site_stats[(hash + probe) % ARENA_STATS_MAX_SITES];
+
+            if (site->line == 0 && atomic_compare_exchange_u32(&site->line, line, 0) == 0)
+            {
+                site->file = file;
+                atomic_write_barrier();
             }
-        } else {
-            // NOTE(bill): Insertion sort
-            for (j = base, i = j+size;
-                     i < limit;
-                     j = i, i += size) {
-                for (; cmp(j, j+size) > 0; j -= size) {
-                    memory_swap(j, j+size, size);
-                    if (j == base) break;
+
+            if (site->line == line)
+            {
+                while (*(const char * volatile *)&site->file == NULL) atomic_read_barrier();
+
+                if (site->file == file || string_equals(string_from_cstr(site->file), string_from_cstr(file)))
+                {
+                    atomic_add_u64(&site->push_count, 1);
+                    atomic_add_u64(&site->bytes, size);
+                    break;
                 }
             }
-
-            if (stack_ptr == stack) break; // NOTE(bill): Sorting is done!
-            GB__SORT_POP(base, limit);
         }
     }
+    #endif
 
-    #undef GB__SORT_PUSH
-    #undef GB__SORT_POP
+    return result;
 }
 
-function i64 memory_binary_search(void *base, u64 count, u64 size, void *key, Compare_Proc cmp)
+function i32 arena__compare_site_bytes(void *a, void *b)
 {
-    u64 start = 0;
-    u64 end = count;
+    Arena_Site_Stats *a0 = *(Arena_Site_Stats **)a;
+    Arena_Site_Stats *b0 = *(Arena_Site_Stats **)b;
+    return (a0->bytes < b0->bytes) - (a0->bytes > b0->bytes);
+}
 
-    while (start < end) {
-        u64 mid = start + (end-start)/2;
-        i64 result = cmp(key, cast(u8 *)base + mid*size);
+function void arena_print_site_stats(u64 max_count)
+{
+    #if ARENA_STATS
+    Arena_Site_Stats *sorted[ARENA_STATS_MAX_SITES];
+    u64 count = 0;
 
-        if (result < 0) {
-            end = mid;
-        } else if (result > 0) {
-            start = mid+1;
-        } else {
-            return mid;
+    for (u64 i = 0; i < ARENA_STATS_MAX_SITES; i += 1)
+    {
+        if (arena__site_stats[i].line > 0 && arena__site_stats[i].file)
+        {
+            sorted[count] = &arena__site_stats[i];
+            count += 1;
         }
     }
 
-    return -1;
-}
+    memory_sort(sorted, count, sizeof(sorted[0]), arena__compare_site_bytes);
 
-//
-// Allocator
-//
+    if (max_count == 0) max_count = count;
 
-function void *allocator_alloc(Allocator allocator, u64 size)
-{
-    if (allocator.proc)
+    print("Arena allocation sites:\n");
+    for (u64 i = 0; i < Min(count, max_count); i += 1)
     {
-        void *result = allocator.proc(AllocatorMode_Alloc, size, 0, NULL, allocator.data, ALLOCATOR_DEFAULT_ALIGNMENT);
-        return result;
+        Arena_Site_Stats *it = sorted[i];
+        print("    %s:%u: %llu bytes in %llu pushes\n", it->file, it->line, it->bytes, it->push_count);
     }
-
-    return NULL;
+    #else
+    print("Arena allocation sites: compile with ARENA_STATS=1 and DEBUG=1 to collect them\n");
+    #endif
 }
 
-function void *allocator_alloc_aligned(Allocator allocator, u64 size, u32 alignment)
+// NOTE(nick): slots are only reserved the first time they are handed out, and threads
+// that exit through os_thread_create give their slots back to a global free list.
+
+thread_local Arena *m__scratch_pool[SCRATCH_SLOT_COUNT] = {0};
+thread_local u64 m__scratch_depth = 0;
+
+typedef struct Scratch_Free_Node Scratch_Free_Node;
+struct Scratch_Free_Node
 {
-    if (allocator.proc)
-    {
-        void *result = allocator.proc(AllocatorMode_Alloc, size, 0, NULL, allocator.data, alignment);
-        return result;
-    }
+    Scratch_Free_Node *next;
+    Arena *arena;
+};
 
-    return NULL;
-}
+static Scratch_Free_Node *m__scratch_free_list = NULL;
+static u32 volatile m__scratch_free_lock = 0;
 
-function void allocator_free(Allocator allocator, void *data, u64 old_size)
+function void arena__scratch_lock()
 {
-    if (allocator.proc)
+    while (atomic_compare_exchange_u32(&m__scratch_free_lock, 1, 0) != 0)
     {
-        if (data != NULL)
-        {
-            allocator.proc(AllocatorMode_Free, 0, old_size, data, allocator.data, 0);
-        }
+        // spin
     }
 }
 
-function void *allocator_realloc(Allocator allocator, void *data, u64 new_size, u64 old_size)
+function void arena__scratch_unlock()
 {
-    if (allocator.proc)
-    {
-        return allocator.proc(AllocatorMode_Resize, new_size, old_size, data, allocator.data, ALLOCATOR_DEFAULT_ALIGNMENT);
-    }
-
-    return NULL;
+    atomic_compare_exchange_u32(&m__scratch_free_lock, 0, 1);
 }
 
-function void *allocator_realloc_aligned(Allocator allocator, void *data, u64 new_size, u64 old_size, u32 alignment)
+function Arena *arena__scratch_acquire()
 {
-    if (allocator.proc)
+    Arena *result = NULL;
+
+    // NOTE(nick): the free list is only ever read under the lock, this runs once per slot per thread
+    arena__scratch_lock();
+    Scratch_Free_Node *node = m__scratch_free_list;
+    if (node)
     {
-        return allocator.proc(AllocatorMode_Resize, new_size, old_size, data, allocator.data, alignment);
+        m__scratch_free_list = node->next;
+        result = node->arena;
     }
+    arena__scratch_unlock();
 
-    return NULL;
+    if (result) arena_reset(result);
+
+    if (!result)
+    {
+        result = arena_alloc(SCRATCH_RESERVE_SIZE);
+    }
+
+    assert(result);
+    return result;
 }
 
-function ALLOCATOR_PROC(os_allocator_proc)
+function M_Temp arena_get_scratch(Arena **conflicts, u64 conflict_count)
 {
-    switch (mode) {
-        case AllocatorMode_Alloc:
-        {
-            u64 actual_size = requested_size + m_align_offset(0, alignment);
-            void *result = os_alloc(actual_size);
-            return result;
-        } break;
-
-        case AllocatorMode_Resize:
+    M_Temp result = {0};
+    for (u64 i = 0; i < count_of(m__scratch_pool); i += 1)
+    {
+        b32 is_conflict = false;
+        for (Arena **conflict = conflicts; conflict < conflicts+conflict_count; conflict += 1)
         {
-            u64 actual_size = requested_size + m_align_offset(0, alignment);
-
-            void *result = os_alloc(actual_size);
+            if (*conflict && *conflict == m__scratch_pool[i]) {
+                is_conflict = true;
+                break;
+            }
+        }
 
-            if (result && old_memory_pointer) {
-                // @Incomplete: provide os-level realloc function
-                MemoryCopy(result, old_memory_pointer, Min(requested_size, old_size));
-                os_free(old_memory_pointer);
+        if (!is_conflict) {
+            if (m__scratch_pool[i] == NULL)
+            {
+                m__scratch_pool[i] = arena__scratch_acquire();
             }
 
-            return result;
-        } break;
-        
-        case AllocatorMode_Free:
-        {
-            os_free(old_memory_pointer);
-            return NULL;
-        } break;
+            result = arena_begin_temp(m__scratch_pool[i]);
+            break;
+        }
+    }
 
-        case AllocatorMode_FreeAll:
-        {
-            // @Incomplete
-            return NULL;
-        } break;
+    // NOTE(nick): every slot conflicted, bump SCRATCH_SLOT_COUNT
+    assert(result.arena);
 
-        default:
-        {
-            return NULL;
-        } break;
-    }
-}
+    m__scratch_depth += 1;
+    // NOTE(nick): probably a GetScratch without a matching ReleaseScratch
+    assert(m__scratch_depth <= SCRATCH_MAX_DEPTH);
 
-function Allocator os_allocator()
-{
-    Allocator result = {os_allocator_proc, 0};
     return result;
 }
 
-function ALLOCATOR_PROC(arena_allocator_proc)
+function void arena_release_scratch(M_Temp temp)
 {
-    Arena *arena = cast(Arena *)allocator_data; 
+    // NOTE(nick): released more scratches than were taken
+    assert(m__scratch_depth > 0);
+    // NOTE(nick): an outer scratch was released before an inner one on the same arena
+    assert(arena_pos(temp.arena) >= temp.pos);
 
-    switch (mode) {
-        case AllocatorMode_Alloc:
-        {
-            return arena_push(arena, requested_size, alignment, true);
-        } break;
+    m__scratch_depth -= 1;
+    arena_end_temp(temp);
+}
 
-        case AllocatorMode_Resize:
-        {
-            arena_push(arena, 0, alignment, 0);
-            void *result = arena_realloc_ptr(arena, requested_size, old_memory_pointer, old_size);
-            return result;
-        } break;
+function u64 arena_scratch_depth()
+{
+    return m__scratch_depth;
+}
 
-        case AllocatorMode_Free:
-        {
-            arena_free_ptr(arena, old_memory_pointer, old_size);
-            return NULL;
-        } break;
+function void arena_release_thread_scratch()
+{
+    assert(m__scratch_depth == 0);
 
-        case AllocatorMode_FreeAll:
+    // NOTE(nick): pushed in reverse so the next thread gets them back in the same slot order
+    for (i64 i = count_of(m__scratch_pool) - 1; i >= 0; i -= 1)
+    {
+        Arena *arena = m__scratch_pool[i];
+        if (arena)
         {
             arena_reset(arena);
-            return NULL;
-        } break;
 
-        default:
-        {
-            return NULL;
-        } break;
+            // NOTE(nick): the free list node lives inside the arena it points to
+            Scratch_Free_Node *node = PushStruct(arena, Scratch_Free_Node);
+            node->arena = arena;
+
+            arena__scratch_lock();
+            node->next = m__scratch_free_list;
+            m__scratch_free_list = node;
+            arena__scratch_unlock();
+
+            m__scratch_pool[i] = NULL;
+        }
     }
 }
 
-function Allocator arena_allocator(Arena *arena)
+function Arena *temp_arena()
 {
-    assert(arena);
-    Allocator result = {arena_allocator_proc, arena};
-    return result;
+    // NOTE(nick): temp_arena allocations are never released, so they don't count towards the depth
+    if (m__scratch_pool[0] == NULL)
+    {
+        m__scratch_pool[0] = arena__scratch_acquire();
+    }
+    return m__scratch_pool[0];
 }
 
 //
-// Strings
+// Snapshots
 //
 
-#include <stdarg.h>
-
-#if OS_WINDOWS
-    #define PATH_SEP '\\'
-    #define PATH_SEPARATOR S("\\")
-#else
-    #define PATH_SEP '/'
-    #define PATH_SEPARATOR S("/")
-#endif
-
-
-//
-// Char Functions
-//
+#define ARENA_SNAPSHOT_MAGIC   0x50414e53 // "SNAP"
+#define ARENA_SNAPSHOT_VERSION 1
 
-function b32 char_is_alpha(u8 c) {
-    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
-}
+typedef struct Arena_Snapshot_Header Arena_Snapshot_Header;
+struct Arena_Snapshot_Header
+{
+    u32 magic;
+    u32 version;
+    u64 base_address;
+    u64 pos;
+    u64 size;
+};
 
-function b32 char_is_lower(u8 c) {
-    return c >= 'a' && c <= 'z';
-}
+function bool arena_save_snapshot(Arena *arena, String path)
+{
+    // NOTE(nick): pointers can only survive a round trip inside one contiguous block.
+    // Debug arenas are full of guard pages and decommitted pops, so there's no used
+    // range to write out (ARENA_DEBUG turns this on for every arena that isn't shared).
+    if (arena->current != arena || (arena->flags & (ArenaFlag_Shared|ArenaFlag_Debug)))
+    {
+        return false;
+    }
 
-function b32 char_is_upper(u8 c) {
-    return c >= 'A' && c <= 'Z';
-}
+    Arena_Snapshot_Header header = {0};
+    header.magic = ARENA_SNAPSHOT_MAGIC;
+    header.version = ARENA_SNAPSHOT_VERSION;
+    header.base_address = (u64)arena;
+    header.pos = arena->pos;
+    header.size = arena->size;
 
-function b32 char_is_digit(u8 c) {
-    return c >= '0' && c <= '9';
-}
+    File file = os_file_open(path, FileMode_Write);
+    if (file.has_errors)
+    {
+        return false;
+    }
 
-function b32 char_is_space(u8 c) {
-    return c == ' ' || c == '\t' || c == '\f' || c == '\v';
-}
+    os_file_write_struct(&file, 0, &header);
+    os_file_write(&file, sizeof(header), arena->pos, arena->data);
+    os_file_close(&file);
 
-function b32 char_is_whitespace(u8 c) {
-    return char_is_space(c) || c == '\r' || c == '\n';
+    return !file.has_errors;
 }
 
-function b32 char_is_symbol(u8 c)
+function Arena *arena_load_snapshot(String path, u64 reserve_size, i64 *relocation)
 {
-    return (c == '~' || c == '!'  || c == '$' || c == '%' || c == '^' ||
-            c == '&' || c == '*'  || c == '-' || c == '=' || c == '+' ||
-            c == '<' || c == '.'  || c == '>' || c == '/' || c == '?' ||
-            c == '|' || c == '\\' || c == '{' || c == '}' || c == '(' ||
-            c == ')' || c == '['  || c == ']' || c == '#' || c == ',' ||
-            c == ';'  || c == ':' || c == '@');
-}
+    Arena *result = NULL;
 
-function b32 char_is_separator(u8 c)
-{
-    return char_is_space(c) || char_is_symbol(c);
-}
+    File file = os_file_open(path, FileMode_Read);
+    if (file.has_errors)
+    {
+        return NULL;
+    }
 
-function b32 char_is_slash(u8 c)
-{
-    return c == '\\' || c == '/';
-}
+    Arena_Snapshot_Header header = {0};
+    u64 file_size = os_file_get_size(file);
+    if (file_size >= sizeof(header))
+    {
+        os_file_read_struct(&file, 0, &header);
+    }
 
-function u8 char_to_upper(u8 c) {
-    return c >= 'a' && c <= 'z' ? c - ('a' - 'A') : c;
-}
+    if (
+        header.magic == ARENA_SNAPSHOT_MAGIC &&
+        header.version == ARENA_SNAPSHOT_VERSION &&
+        file_size >= sizeof(header) + header.pos
+    )
+    {
+        u64 page_size = os_memory_page_size();
+        u64 size = AlignUpPow2(Max(Max(reserve_size, header.size), ARENA_HEADER_SIZE + header.pos), page_size);
+        u64 commit_size = AlignUpPow2(ARENA_HEADER_SIZE + header.pos, page_size);
 
-function u8 char_to_lower(u8 c) {
-    return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
-}
+        // NOTE(nick): try to land at the same address first so raw pointers stay valid
+        u8 *data = cast(u8 *)os_memory_reserve_at((void *)header.base_address, size);
+        if (!data)
+        {
+            data = cast(u8 *)os_memory_reserve(size);
+        }
 
-function u8 char_to_forward_slash(u8 c) {
-    return c == '\\' ? '/' : c;
-}
+        if (data && os_memory_commit(data, commit_size))
+        {
+            result = arena_make_from_buffer(data, size);
+            os_file_read(&file, sizeof(header), header.pos, result->data);
+
+            // NOTE(nick): unlike a plain buffer arena this one owns its reservation
+            result->flags = 0;
+            result->pos = header.pos;
+            result->commit_pos = commit_size;
+            result->page_size = Max(page_size, ARENA_COMMIT_SIZE);
+
+            #if ARENA_STATS
+            result->stats.peak_pos = header.pos;
+            result->stats.committed = commit_size;
+            result->stats.peak_committed = commit_size;
+            result->stats.commit_count = 1;
+            #endif
+
+            if (file.has_errors)
+            {
+                arena_free(result);
+                result = NULL;
+            }
+        }
+        else if (data)
+        {
+            os_memory_release(data, size);
+        }
+    }
 
-function b32 codepoint_is_whitespace(u32 codepoint)
-{
-    return (codepoint == ' '
-            || (0x09 <= codepoint && codepoint <= 0x0d) // HT, LF, VT, FF, CR
-            || codepoint == 0x85                        // NEXT LINE (NEL)
-            || codepoint == 0xa0                        // ↓ Unicode Separator, Space (Zs)
-            || (0x2000 <= codepoint && codepoint <= 0x200a)
-            || codepoint == 0x202f
-            || codepoint == 0x205f
-            || codepoint == 0x3000);
-}
+    os_file_close(&file);
 
-//
-// Constructors
-//
+    if (result && relocation)
+    {
+        *relocation = (i64)((u64)result - header.base_address);
+    }
 
-function String string_make(u8 *data, i64 count) {
-    String result;
-    result.data = data;
-    result.count = count;
     return result;
 }
 
-function String string_from_u8(u8 data)
+function void *arena_realloc_ptr(Arena *arena, u64 new_size, void *old_memory_pointer, u64 old_size)
 {
-    static thread_local u8 storage = 0;
-    storage = data;
-    return Str8(&storage, 1);
-}
-
-function String string_range(u8 *at, u8 *end) {
-    assert(end >= at);
-    return string_make(at, (end - at));
-}
-
-function i64 cstr_length(const char *cstr) {
-    char *at = (char *)cstr;
+    void *result = NULL;
 
-    // @Speed: this can be made wide
-    if (at != NULL) {
-        while (*at != 0) {
-            at ++;
+    if (old_memory_pointer && old_size > 0 && !(arena->flags & ArenaFlag_Shared))
+    {
+        // NOTE(nick): we can only resize in place if the pointer is the last thing
+        // pushed onto the current block and the new size still fits in that block.
+        Arena *current = arena->current;
+        u64 old_memory_offset = (u8 *)(old_memory_pointer) - current->data;
+        if (old_memory_offset == current->pos - old_size &&
+            ARENA_HEADER_SIZE + old_memory_offset + new_size <= current->size)
+        {
+            u64 next_pos = current->base_pos + old_memory_offset + new_size;
+            arena_set_pos(arena, next_pos);
+            if (arena_pos(arena) == next_pos)
+            {
+                result = old_memory_pointer;
+            }
         }
     }
 
-    return at - cstr;
-}
-
-function String string_from_cstr(const char *cstr) {
-    return string_make((u8 *)cstr, cstr_length(cstr));
-}
+    if (!result)
+    {
+        result = arena_push(arena, new_size, 0, false);
 
-function char *string_to_cstr(Arena *arena, String str) {
-    if (!str.count || !str.data) {
-        return NULL;
+        if (result && old_memory_pointer)
+        {
+            MemoryCopy(result, old_memory_pointer, Min(new_size, old_size));
+        }
     }
 
-    char *result = PushArray(arena, char, str.count + 1); // size for null character
-    MemoryCopy(result, str.data, str.count);
-    result[str.count] = 0;
     return result;
 }
 
-function String16 string16_make(u16 *data, i64 count) {
-    String16 result;
-    result.data = data;
-    result.count = count;
-    return result;
-}
-
-function String16 string16_from_cstr(u16 *data) {
-    u16 *at = data;
-    while (*at != 0) at += 1;
-    String16 result = Str16(data, at - data);
-    return result;
-}
-
-function String32 string32_make(u32 *data, i64 count) {
-    String32 result;
-    result.data = data;
-    result.count = count;
-    return result;
+function void arena_free_ptr(Arena *arena, void *old_memory_pointer, u64 old_size)
+{
+    if (old_memory_pointer && old_size > 0 && !(arena->flags & ArenaFlag_Shared))
+    {
+        Arena *current = arena->current;
+        u64 old_memory_offset = (u8 *)(old_memory_pointer) - current->data;
+        if (old_memory_offset == current->pos - old_size)
+        {
+            arena_pop(arena, old_size);
+        }
+    }
 }
 
 //
-// Substrings
+// Memory
 //
 
-function String string_slice(String str, i64 start_index, i64 end_index) {
-    start_index = Clamp(start_index, 0, str.count);
-    end_index   = Clamp(end_index, 0, str.count);
+function u64 m_align_offset(void *ptr, u64 alignment)
+{
+    u64 base_address = (u64)ptr;
 
-    if (start_index > end_index)
-    {
-        i64 tmp = start_index;
-        start_index = end_index;
-        end_index = tmp;
-    }
+    assert(alignment >= 1);
+    assert(IsPow2(alignment));
 
-    return string_make(str.data + start_index, end_index - start_index);
+    u64 align_offset = alignment - (base_address & (alignment - 1));
+    align_offset &= (alignment - 1);
+
+    return align_offset;
 }
 
-function String string_substr(String str, i64 offset, i64 count)
+function void memory_swap(void *i, void *j, u64 size)
 {
-    return string_slice(str, offset, offset + count);
-}
+    if (size == 4) {
+        Swap(u32, *(u32 *)i, *(u32 *)j);
+    } else if (size == 8) {
+        Swap(u64, *(u64 *)i, *(u64 *)j);
+    } else if (size < 8) {
+        u8 *a = (u8 *)i;
+        u8 *b = (u8 *)j;
 
-function String string_skip(String str, i64 offset) {
-    return string_slice(str, offset, str.count);
-}
+        if (a != b) {
+            while (size--) {
+                Swap(u8, *a, *b);
+                a++, b++;
+            }
+        }
+    } else {
+        char buffer[256];
 
-function String string_chop(String str, i64 offset) {
-    return string_slice(str, 0, str.count - offset);
-}
+        // TODO(bill): Is the recursion ever a problem?
+        while (size > sizeof(buffer))
+        {
+            memory_swap(i, j, sizeof(buffer));
+            i = (void *)((u8 *)i + sizeof(buffer));
+            j = (void *)((u8 *)j + sizeof(buffer));
+            size -= sizeof(buffer);
+        }
 
-function String string_prefix(String str, i64 count) {
-    return string_slice(str, 0, count);
+        MemoryCopy(buffer, i, size);
+        MemoryCopy(i, j, size);
+        MemoryCopy(j, buffer, size);
+    }
 }
 
-function String string_suffix(String str, i64 count) {
-    return string_slice(str, str.count - count, str.count);
-}
+function void memory_sort(void *base_, u64 count, u64 size, Compare_Proc cmp)
+{
+    // TODO(bill): Make user definable?
+    #define GB__SORT_STACK_SIZE            64
+    #define GB__SORT_INSERT_SORT_THRESHOLD  8
 
-//
-// Matching
-//
+    #define GB__SORT_PUSH(_base, _limit) do { \
+        stack_ptr[0] = (_base); \
+        stack_ptr[1] = (_limit); \
+        stack_ptr += 2; \
+    } while (0)
 
-function b32 string_equals(String a, String b)
-{
-    return a.count == b.count && MemoryEquals(a.data, b.data, a.count);
-}
+    #define GB__SORT_POP(_base, _limit) do { \
+        stack_ptr -= 2; \
+        (_base)  = stack_ptr[0]; \
+        (_limit) = stack_ptr[1]; \
+    } while (0)
 
-function b32 string_match(String a, String b, Match_Flags flags)
-{
-    b32 result = false;
+    u8 *i, *j;
+    u8 *base = (u8 *)base_;
+    u8 *limit = base + count*size;
+    u64 threshold = GB__SORT_INSERT_SORT_THRESHOLD * size;
 
-    if (a.count == b.count || ((flags & MatchFlag_RightSideSloppy) && a.count >= b.count))
-    {
-        result = true;
+    // NOTE(bill): Prepare the stack
+    u8 *stack[GB__SORT_STACK_SIZE] = {0};
+    u8 **stack_ptr = stack;
 
-        for (i64 i = 0; i < b.count; i += 1)
-        {
-            b32 match = a.data[i] == b.data[i];
-            if (flags & MatchFlag_IgnoreCase)
-            {
-                match |= (char_to_lower(a.data[i]) == char_to_lower(b.data[i]));
-            }
-            if (flags & MatchFlag_SlashInsensitive)
-            {
-                match |= (char_to_forward_slash(a.data[i]) == char_to_forward_slash(b.data[i]));
+    for (;;) {
+        if ((limit-base) > (i64)threshold) {
+            // NOTE(bill): Quick sort
+            i = base + size;
+            j = limit - size;
+
+            memory_swap(((limit-base)/size/2) * size + base, base, size);
+            if (cmp(i, j) > 0)    memory_swap(i, j, size);
+            if (cmp(base, j) > 0) memory_swap(base, j, size);
+            if (cmp(i, base) > 0) memory_swap(i, base, size);
+
+            for (;;) {
+                do i += size; while (cmp(i, base) < 0);
+                do j -= size; while (cmp(j, base) > 0);
+                if (i > j) break;
+                memory_swap(i, j, size);
             }
 
-            if (!match)
-            {
-                result = false;
-                break;
+            memory_swap(base, j, size);
+
+            if (j - base > limit - i) {
+                GB__SORT_PUSH(base, j);
+                base = i;
+            } else {
+                GB__SORT_PUSH(i, limit);
+                limit = j;
+            }
+        } else {
+            // NOTE(bill): Insertion sort
+            for (j = base, i = j+size;
+                     i < limit;
+                     j = i, i += size) {
+                for (; cmp(j, j+size) > 0; j -= size) {
+                    memory_swap(j, j+size, size);
+                    if (j == base) break;
+                }
             }
+
+            if (stack_ptr == stack) break; // NOTE(bill): Sorting is done!
+            GB__SORT_POP(base, limit);
         }
     }
 
-    return result;
+    #undef GB__SORT_PUSH
+    #undef GB__SORT_POP
 }
 
-function i64 string_find(String str, String search, i64 start_index, Match_Flags flags)
+function i64 memory_binary_search(void *base, u64 count, u64 size, void *key, Compare_Proc cmp)
 {
-    i64 result = str.count;
+    u64 start = 0;
+    u64 end = count;
 
-    for (i64 i = start_index; i < str.count; i += 1)
-    {
-        if (i + search.count > str.count) break;
+    while (start < end) {
+        u64 mid = start + (end-start)/2;
+        i64 result = cmp(key, cast(u8 *)base + mid*size);
 
-        String substr = string_slice(str, i, i+search.count);
-        if (string_match(substr, search, flags))
-        {
-            result = i;
-            if (!(flags & MatchFlag_FindLast))
-            {
-                break;
-            }
+        if (result < 0) {
+            end = mid;
+        } else if (result > 0) {
+            start = mid+1;
+        } else {
+            return mid;
         }
     }
 
-    return result;
+    return -1;
 }
 
-function b32 string_includes(String str, String search)
+//
+// Allocator
+//
+
+function void *allocator_alloc(Allocator allocator, u64 size)
 {
-    return string_find(str, search, 0, 0) < str.count;
-}
+    if (allocator.proc)
+    {
+        void *result = allocator.proc(AllocatorMode_Alloc, size, 0, NULL, allocator.data, ALLOCATOR_DEFAULT_ALIGNMENT);
+        return result;
+    }
 
-function b32 string_starts_with(String str, String prefix) {
-    return str.count >= prefix.count && MemoryEquals(str.data, prefix.data, prefix.count);
+    return NULL;
 }
 
-function b32 string_ends_with(String str, String postfix) {
-    return (
-        str.count >= postfix.count &&
-        MemoryEquals(str.data + (str.count - postfix.count), postfix.data, postfix.count)
-    );
-}
+function void *allocator_alloc_aligned(Allocator allocator, u64 size, u32 alignment)
+{
+    if (allocator.proc)
+    {
+        void *result = allocator.proc(AllocatorMode_Alloc, size, 0, NULL, allocator.data, alignment);
+        return result;
+    }
 
-function i64 string_index(String str, String search, i64 start_index) {
-    i64 result = string_find(str, search, start_index, 0);
-    return result < str.count ? result : -1;
+    return NULL;
 }
 
-function i64 string_char_index(String str, u8 search, i64 start_index) {
-    return string_index(str, string_make(&search, 1), start_index);
+function void allocator_free(Allocator allocator, void *data, u64 old_size)
+{
+    if (allocator.proc)
+    {
+        if (data != NULL)
+        {
+            allocator.proc(AllocatorMode_Free, 0, old_size, data, allocator.data, 0);
+        }
+    }
 }
 
-function i64 string_last_index(String str, String search) {
-    i64 result = string_find(str, search, 0, MatchFlag_FindLast);
-    return result < str.count ? result : -1;
+function void *allocator_realloc(Allocator allocator, void *data, u64 new_size, u64 old_size)
+{
+    if (allocator.proc)
+    {
+        return allocator.proc(AllocatorMode_Resize, new_size, old_size, data, allocator.data, ALLOCATOR_DEFAULT_ALIGNMENT);
+    }
+
+    return NULL;
 }
 
-function b32 string_contains(String str, String search) {
-    return string_find(str, search, 0, 0) < str.count;
+function void *allocator_realloc_aligned(Allocator allocator, void *data, u64 new_size, u64 old_size, u32 alignment)
+{
+    if (allocator.proc)
+    {
+        return allocator.proc(AllocatorMode_Resize, new_size, old_size, data, allocator.data, alignment);
+    }
+
+    return NULL;
 }
 
-function b32 string_in_bounds(String str, i64 at) {
-    return at < str.count;
+function ALLOCATOR_PROC(os_allocator_proc)
+{
+    switch (mode) {
+        case AllocatorMode_Alloc:
+        {
+            u64 actual_size = requested_size + m_align_offset(0, alignment);
+            void *result = os_alloc(actual_size);
+            return result;
+        } break;
+
+        case AllocatorMode_Resize:
+        {
+            u64 actual_size = requested_size + m_align_offset(0, alignment);
+
+            void *result = os_alloc(actual_size);
+
+            if (result && old_memory_pointer) {
+                // @Incomplete: provide os-level realloc function
+                MemoryCopy(result, old_memory_pointer, Min(requested_size, old_size));
+                os_free(old_memory_pointer);
+            }
+
+            return result;
+        } break;
+        
+        case AllocatorMode_Free:
+        {
+            os_free(old_memory_pointer);
+            return NULL;
+        } break;
+
+        case AllocatorMode_FreeAll:
+        {
+            // @Incomplete
+            return NULL;
+        } break;
+
+        default:
+        {
+            return NULL;
+        } break;
+    }
 }
 
-function void string_advance(String *str, i64 count)
+function Allocator os_allocator()
 {
-    str->count -= count;
-    str->data += count;
+    Allocator result = {os_allocator_proc, 0};
+    return result;
 }
 
-function String string_split_iter(String *text, String search)
+function ALLOCATOR_PROC(arena_allocator_proc)
 {
-    i64 i = 0;
-    while (i < text->count - search.count + 1)
-    {
-        if (MemoryEquals(text->data + i, search.data, search.count)) break;
-        i += 1;
+    Arena *arena = cast(Arena *)allocator_data; 
+
+    switch (mode) {
+        case AllocatorMode_Alloc:
+        {
+            return arena_push(arena, requested_size, alignment, true);
+        } break;
+
+        case AllocatorMode_Resize:
+        {
+            arena_push(arena, 0, alignment, 0);
+            void *result = arena_realloc_ptr(arena, requested_size, old_memory_pointer, old_size);
+            return result;
+        } break;
+
+        case AllocatorMode_Free:
+        {
+            arena_free_ptr(arena, old_memory_pointer, old_size);
+            return NULL;
+        } break;
+
+        case AllocatorMode_FreeAll:
+        {
+            arena_reset(arena);
+            return NULL;
+        } break;
+
+        default:
+        {
+            return NULL;
+        } break;
     }
+}
 
-    String result = string_slice(*text, 0, i);
-    *text = string_slice(*text, i + search.count, text->count);
+function Allocator arena_allocator(Arena *arena)
+{
+    assert(arena);
+    Allocator result = {arena_allocator_proc, arena};
     return result;
 }
 
-
 //
-// Allocation
+// Pool
 //
 
-function String string_push(Arena *arena, String str)
+function void pool_init(Pool *pool, Arena *arena, u64 item_size, u64 item_align, u64 slab_count)
 {
-    String copy = {0};
-    u8 *data = PushArray(arena, u8, str.count+1);
+    assert(arena);
+    assert(item_size > 0);
 
-    if (data)
-    {
-        copy = string_make(data, str.count);
-        MemoryCopy(copy.data, str.data, str.count);
-        data[str.count] = '\0';
-    }
+    MemoryZeroStruct(pool);
 
-    return copy;
-}
+    // NOTE(nick): free slots hold the free list link, so items have to be able to fit a pointer
+    item_align = Max(item_align, AlignOf(Pool_Free_Node));
+    assert(IsPow2(item_align));
 
-function String string_alloc(String str)
-{
-    u8 *data = (u8 *)os_alloc(str.count);
-    MemoryCopy(data, str.data, str.count);
-    return string_make(data, str.count);
+    pool->arena = arena;
+    pool->item_align = item_align;
+    pool->item_size = AlignUpPow2(Max(item_size, sizeof(Pool_Free_Node)), item_align);
+    pool->slab_count = slab_count ? slab_count : POOL_DEFAULT_SLAB_COUNT;
 }
 
-function void string_free(String *str)
+function void *pool_alloc(Pool *pool, b32 zero)
 {
-    if (str->data)
+    void *result = NULL;
+
+    if (pool->free_list)
     {
-        os_free(str->data);
-        str->data = NULL;
-        str->count = 0;
+        result = pool->free_list;
+        pool->free_list = pool->free_list->next;
     }
-}
-
-__PrintFunction(2,0)
-function String string_printv(Arena *arena, __FormatString const char *fmt, va_list args)
-{
-    String result = {0};
-    
-    // in case we need to try a second time
-    va_list args2;
-    va_copy(args2, args);
-
-    i64 buffer_size = 1024;
-    u8 *buffer = PushArray(arena, u8, buffer_size);
-
-    if (buffer != NULL)
+    else
     {
-        // NOTE(nick): print_to_buffer returns size excluding the null terminator
-        i64 actual_size = PrintToBuffer((char *)buffer, (int)buffer_size, fmt, args);
+        if (pool->current_slab && pool->current_index >= pool->slab_count)
+        {
+            pool->current_slab = pool->current_slab->next;
+            pool->current_index = 0;
+        }
 
-        if (actual_size > 0)
+        if (!pool->current_slab)
         {
-            if (actual_size < buffer_size)
-            {
-                // NOTE(nick): happy path
-                arena_pop(arena, buffer_size - actual_size);
-                result = string_make(buffer, actual_size);
-            }
-            else
+            Pool_Slab *slab = PushStructNoZero(pool->arena, Pool_Slab);
+            u8 *data = (u8 *)arena_push(pool->arena, pool->item_size * pool->slab_count, pool->item_align, false);
+
+            if (slab && data)
             {
-                arena_pop(arena, buffer_size);
-                u8 *fixed_buffer = PushArray(arena, u8, actual_size);
+                slab->next = NULL;
+                slab->data = data;
+                QueuePush(pool->first_slab, pool->last_slab, slab);
 
-                if (fixed_buffer != NULL)
-                {
-                    i64 final_size = PrintToBuffer((char *)fixed_buffer, (int)(actual_size + 1), fmt, args2);
-                    result = string_make(fixed_buffer, final_size);
-                }
+                pool->current_slab = slab;
+                pool->current_index = 0;
             }
         }
+
+        if (pool->current_slab)
+        {
+            result = pool->current_slab->data + pool->item_size * pool->current_index;
+            pool->current_index += 1;
+        }
     }
 
-    va_end(args2);
+    if (result)
+    {
+        pool->count += 1;
+
+        if (zero)
+        {
+            MemoryZero(result, pool->item_size);
+        }
+    }
 
     return result;
 }
 
-__PrintFunction(2,3)
-function String string_print(Arena *arena, __FormatString const char *fmt, ...)
+function void pool_free(Pool *pool, void *ptr)
 {
-    String result = {0};
+    if (ptr)
+    {
+        assert(pool->count > 0);
 
-    va_list args;
-    va_start(args, fmt);
-    result = string_printv(arena, fmt, args);
-    va_end(args);
+        Pool_Free_Node *node = (Pool_Free_Node *)ptr;
+        node->next = pool->free_list;
+        pool->free_list = node;
+        pool->count -= 1;
+    }
+}
 
-    return result;
+function void pool_reset(Pool *pool)
+{
+    // NOTE(nick): slabs stay allocated in the arena and get reused from the start
+    pool->free_list = NULL;
+    pool->current_slab = pool->first_slab;
+    pool->current_index = 0;
+    pool->count = 0;
 }
 
-function String string_replace(Arena *arena, String str, String find, String replacer, u64 replace_limit)
+function ALLOCATOR_PROC(pool_allocator_proc)
 {
-    String result = str;
-    if (replace_limit == 0) replace_limit = U64_MAX;
+    Pool *pool = cast(Pool *)allocator_data;
 
-    u64 match_count = 0;
-    u64 replace_count = replace_limit;
-    if (replace_count > 0 && find.count > 0)
-    {
-        i64 index = -1;
-        while (index < str.count)
+    switch (mode) {
+        case AllocatorMode_Alloc:
         {
-            index = string_find(str, find, index + 1, 0);
-            if (index < str.count)
-            {
-                replace_count -= 1;
-                if (replace_count == 0) break;
+            // NOTE(nick): slots are aligned to the item_align given to pool_init
+            assert(requested_size <= pool->item_size);
+            return pool_alloc(pool, true);
+        } break;
 
-                match_count += 1;
+        case AllocatorMode_Resize:
+        {
+            // NOTE(nick): every slot is the same size, so resizing never has to move anything
+            assert(requested_size <= pool->item_size);
+            if (old_memory_pointer)
+            {
+                return old_memory_pointer;
             }
-        }
-    }
-
-    if (match_count > 0)
-    {
-        u64 count = str.count - (replacer.count - find.count) * match_count;
-        u8 *data = PushArray(arena, u8, count);
-        u8 *at = data;
+            return pool_alloc(pool, true);
+        } break;
 
-        i64 index = -1;
-        while (index < str.count)
+        case AllocatorMode_Free:
         {
-            i64 start_index = Max(index, 0);
-            index = string_find(str, find, index, 0);
-
-            MemoryCopy(at, str.data + start_index, (index - start_index));
-            at += (index - start_index);
-
-            if (index < str.count)
-            {
-                MemoryCopy(at, replacer.data, replacer.count);
-                at += replacer.count;
-                index += find.count;
+            pool_free(pool, old_memory_pointer);
+            return NULL;
+        } break;
 
-                if (match_count == 0)
-                {
-                    MemoryCopy(at, str.data + index, str.count - index);
-                    at += str.count - index;
-                    break;
-                }
-                match_count -= 1;
-            }
-        }
+        case AllocatorMode_FreeAll:
+        {
+            pool_reset(pool);
+            return NULL;
+        } break;
 
-        result = Str8(data, at - data);
+        default:
+        {
+            return NULL;
+        } break;
     }
+}
 
+function Allocator pool_allocator(Pool *pool)
+{
+    assert(pool);
+    Allocator result = {pool_allocator_proc, pool};
     return result;
 }
 
 //
-// Unicode Conversions
+// Heap
 //
 
-function String_Decode string_decode_utf8(u8 *str, u64 capacity) {
-    String_Decode result = {S_UTF8_INVALID, 1};
+//
+// NOTE(nick): small allocations are carved out of HEAP_PAGE_SIZE pages inside one big
+// reservation, every page holds a single size class and belongs to one thread cache.
+// The owner allocates and frees without any atomics. Other threads push what they free
+// onto the owner's remote list, which the owner takes back whenever it runs out of room.
+// Pages that empty out are decommitted and go onto a shared list for any thread to reuse.
+// Anything bigger than HEAP_SMALL_MAX (or with a big alignment) gets its own mapping.
+//
 
-    static u8 utf8_class[] = {
-        1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        2, 2, 2, 2, 3, 3, 4, 5,
-    };
+typedef struct Heap_Thread_Cache Heap_Thread_Cache;
+typedef struct Heap_Free_Node Heap_Free_Node;
+
+typedef struct Heap_Header Heap_Header;
+struct Heap_Header
+{
+    u64 size;       // bytes per item for pages, committed bytes after the pointer for large blocks
+    u32 size_class;
+    u32 is_large;
+
+    // NOTE(nick): only used by pages, and only touched by the owner
+    Heap_Thread_Cache *owner;
+    Heap_Header *prev;
+    Heap_Header *next;
+    Heap_Free_Node *free_list;
+    u32 used;
+    u32 bumped;
+    u32 capacity;
+
+    // NOTE(nick): only used by large blocks, committed counts from base
+    u8 *base;
+    u64 reserved;
+    u64 committed;
+};
 
-    u8 byte = str[0];
-    u8 count = utf8_class[byte >> 3];
-    // print("byte: 0x%x, count: %d\n", byte, count);
+struct Heap_Free_Node
+{
+    Heap_Free_Node *next;
+};
 
-    if (capacity >= count) {
-        switch (count) {
-            case 1:
-            {
-                // NOTE(nick): don't need the extra check because of the utf8_class check
-                result.advance = 1;
-                result.codepoint = str[0] & 0x7F;
-            } break;
+struct Heap_Thread_Cache
+{
+    // NOTE(nick): pages with room are kept apart from full ones, allocations come from the first
+    Heap_Header *pages[HEAP_CLASS_COUNT];
+    Heap_Header *full_pages[HEAP_CLASS_COUNT];
 
-            case 2:
-            {
-                if (utf8_class[str[1] >> 3] == 0)
-                {
-                    u32 codepoint = ((str[0] & 0x1F) << 6) | (str[1] & 0x3F);
-                    if (codepoint >= 0x80 && codepoint <= 0x7FF)
-                    {
-                        result.codepoint = codepoint;
-                        result.advance = 2;
-                    }
-                }
-            } break;
+    // NOTE(nick): a stack of items freed by other threads, the owner takes it all at once
+    u64 volatile remote_free;
 
-            case 3:
-            {
-                if (utf8_class[str[1] >> 3] == 0 && utf8_class[str[2] >> 3] == 0)
-                {
-                    u32 codepoint = (
-                        ((str[0] & 0x0F) << 12) |
-                        ((str[1] & 0x3F) << 6) |
-                        ((str[2] & 0x3F))
-                    );
-                    if (codepoint >= 0x800 && codepoint <= 0xFFFF)
-                    {
-                        result.codepoint = codepoint;
-                        result.advance = 3;
-                    }
-                }
-            } break;
+    Heap_Thread_Cache *next;
+};
 
-            case 4:
-            {
-                if (utf8_class[str[1] >> 3] == 0 && utf8_class[str[2] >> 3] == 0 && utf8_class[str[3] >> 3] == 0)
-                {
-                    u32 codepoint = (
-                        ((str[0] & 0x07) << 18) |
-                        ((str[1] & 0x3F) << 12) |
-                        ((str[2] & 0x3F) << 6) |
-                        ((str[3] & 0x3F))
-                    );
-                    if (codepoint >= 0x10000 && codepoint <= 0x10FFFF)
-                    {
-                        result.codepoint = codepoint;
-                        result.advance = 4;
-                    }
-                }
-            } break;
-        }
-    }
+typedef struct Heap_State Heap_State;
+struct Heap_State
+{
+    u32 volatile init_state;
+    u8 *base;
+    u64 page_count;
+    u64 volatile next_page;
 
-    return result;
-}
+    u32 volatile lock;
+    Heap_Header *free_pages;
+    Heap_Thread_Cache *parked_caches;
+};
 
-function u32 string_encode_utf8(u8 *dest, u32 codepoint) {
-    u32 advance = 0;
+static Heap_State heap__state = {0};
+thread_local Heap_Thread_Cache *heap__cache = NULL;
 
-    if (codepoint <= 0x7F)
+function u32 heap__class_from_size(u64 size)
+{
+    if (size <= 128)
     {
-        advance = 1;
-        dest[0] = (u8)codepoint;
+        return size > 0 ? (u32)((size + 15) / 16 - 1) : 0;
     }
-    else if (codepoint <= 0x7FF)
+
+    // NOTE(nick): 4 classes for every power of two above 128
+    u32 log = 63 - count_leading_zeros_u64(size - 1);
+    u32 sub = (u32)(((size - 1) >> (log - 2)) & 3);
+    return 8 + (log - 7) * 4 + sub;
+}
+
+function u64 heap__size_from_class(u32 size_class)
+{
+    if (size_class < 8)
     {
-        advance = 2;
-        dest[0] = 0xC0 | (u8)((codepoint >> 6) & 0x1F);
-        dest[1] = 0x80 | (u8)(codepoint & 0x3F);
+        return (size_class + 1) * 16;
     }
-    else if (codepoint <= 0xFFFF)
+
+    size_class -= 8;
+    u32 log = 7 + size_class / 4;
+    u32 sub = size_class % 4;
+    return ((u64)1 << log) + (sub + 1) * ((u64)1 << (log - 2));
+}
+
+function void heap__init()
+{
+    Heap_State *heap = &heap__state;
+
+    if (heap->init_state != 2)
     {
-        if (InRange(codepoint, 0xD800, 0xDFFF))
+        if (atomic_compare_exchange_u32(&heap->init_state, 1, 0) == 0)
         {
-            codepoint = S_UTF8_INVALID;
+            heap->base = (u8 *)os_memory_reserve(HEAP_RESERVE_SIZE);
+            heap->page_count = heap->base ? HEAP_RESERVE_SIZE / HEAP_PAGE_SIZE : 0;
+            heap->next_page = 0;
+
+            atomic_write_barrier();
+            heap->init_state = 2;
+        }
+        else
+        {
+            while (heap->init_state != 2) atomic_read_barrier();
         }
+    }
+}
 
-        advance = 3;
-        dest[0] = 0xE0 | (u8)((codepoint >> 12) & 0x0F);
-        dest[1] = 0x80 | (u8)((codepoint >> 6) & 0x3F);
-        dest[2] = 0x80 | (u8)(codepoint & 0x3F);
+function void heap__lock()
+{
+    while (atomic_compare_exchange_u32(&heap__state.lock, 1, 0) != 0)
+    {
+        // spin
     }
-    else if (codepoint <= 0x10FFFF)
+}
+
+function void heap__unlock()
+{
+    atomic_compare_exchange_u32(&heap__state.lock, 0, 1);
+}
+
+function b32 heap__is_small(void *ptr)
+{
+    Heap_State *heap = &heap__state;
+    return heap->base && (u8 *)ptr >= heap->base && (u8 *)ptr < heap->base + heap->page_count * HEAP_PAGE_SIZE;
+}
+
+function Heap_Header *heap__header_from_ptr(void *ptr)
+{
+    Heap_Header *result = NULL;
+    if (heap__is_small(ptr))
     {
-        advance = 4;
-        dest[0] = 0xF0 | (u8)((codepoint >> 18) & 0x07);
-        dest[1] = 0x80 | (u8)((codepoint >> 12) & 0x3F);
-        dest[2] = 0x80 | (u8)((codepoint >> 6) & 0x3F);
-        dest[3] = 0x80 | (u8)(codepoint & 0x3F);
+        u64 offset = (u8 *)ptr - heap__state.base;
+        result = (Heap_Header *)(heap__state.base + AlignDownPow2(offset, HEAP_PAGE_SIZE));
     }
     else
     {
-        dest[0] = '?';
-        advance = 1;
+        result = (Heap_Header *)((u8 *)ptr - HEAP_HEADER_SIZE);
     }
-
-    return advance;
+    return result;
 }
 
-function u32 string_seek_right_utf8(u8 *data, u64 capacity) {
-    String_Decode decode = string_decode_utf8(data, capacity);
-    return decode.advance;
-}
+function void *heap__alloc_large(u64 size, u32 alignment)
+{
+    void *result = NULL;
 
-function u32 string_seek_left_utf8(u8 *data, u64 capacity) {
-    u32 advance = 0;
+    alignment = Max(alignment, 16);
+    u64 page_size = os_memory_page_size();
 
-    if (capacity >= 1)
+    // NOTE(nick): the reservation is only page aligned, bigger alignments need room to slide the block up
+    u64 max_offset = AlignUpPow2(HEAP_HEADER_SIZE, alignment);
+    if (alignment > page_size) max_offset = HEAP_HEADER_SIZE + alignment;
+
+    // NOTE(nick): reserve some headroom so heap_realloc can usually grow in place
+    u64 reserve_size = AlignUpPow2(u64_next_power_of_two(max_offset + size), page_size);
+
+    u8 *base = (u8 *)os_memory_reserve(reserve_size);
+    if (base)
     {
-        u8 at = *(data - 1);
+        u64 offset = AlignUpPow2((usize)base + HEAP_HEADER_SIZE, (usize)alignment) - (usize)base;
+        u64 commit_start = AlignDownPow2(offset - HEAP_HEADER_SIZE, page_size);
+        u64 commit_end = AlignUpPow2(offset + size, page_size);
 
-        if (at < 128)
+        if (os_memory_commit(base + commit_start, commit_end - commit_start))
         {
-            advance = 1;
+            result = base + offset;
+
+            Heap_Header *header = (Heap_Header *)((u8 *)result - HEAP_HEADER_SIZE);
+            header->size = commit_end - offset;
+            header->size_class = 0;
+            header->is_large = true;
+            header->base = base;
+            header->reserved = reserve_size;
+            header->committed = commit_end;
         }
-        else if (capacity >= 2)
+        else
         {
-            advance = 2;
-            at = *(data - 2);
-
-            // scan for 10xxxxxx
-            if (capacity >= 3 && (at & 0xC0) == 0x80)
-            {
-                advance += 1;
-                at = *(data - 3);
-
-                if (capacity >= 4 && (at & 0xC0) == 0x80)
-                {
-                    advance += 1;
-                }
-            }
+            os_memory_release(base, reserve_size);
         }
     }
 
-    return advance;
+    return result;
 }
 
-function i64 string_seek_utf8(String text, i64 cursor, i64 amount)
+function Heap_Thread_Cache *heap__get_cache()
 {
-    i64 result = 0;
-    if (amount < 0)
+    Heap_Thread_Cache *cache = heap__cache;
+
+    if (!cache)
     {
-        amount = -amount;
+        // NOTE(nick): adopt a cache (and the pages it still owns) from a thread that exited
+        heap__lock();
+        cache = heap__state.parked_caches;
+        if (cache) heap__state.parked_caches = cache->next;
+        heap__unlock();
 
-        i64 i = cursor;
-        while (i > 0 && amount > 0)
+        if (!cache)
         {
-            i -= string_seek_left_utf8(text.data+i, i);
-            amount -= 1;
+            cache = (Heap_Thread_Cache *)os_alloc(sizeof(Heap_Thread_Cache));
         }
 
-        result = i;
-    }
-    else if (amount > 0)
-    {
-        i64 i = cursor;
-        while (i < text.count && amount > 0)
+        if (cache)
         {
-            i += string_seek_right_utf8(text.data+i, text.count-i);
-            amount -= 1;
+            cache->next = NULL;
         }
 
-        result = i;
+        heap__cache = cache;
     }
-    return result;
+
+    return cache;
 }
 
-function i64 string_move_word(String text, i64 cursor, i32 direction)
+function void heap__list_remove(Heap_Header **list, Heap_Header *page)
 {
-    i64 result = 0;
-    if (direction < 0)
-    {
-        i64 i = cursor;
-        while (i > 0)
-        {
-            i -= string_seek_left_utf8(text.data + i, i);
-            if (!char_is_separator(text.data[i])) break;
-        }
-
-        while (i > 0)
-        {
-            i -= string_seek_left_utf8(text.data + i, i);
-            if (char_is_separator(text.data[i])) break;
-        }
-
-        result = i;
-    }
-    else if (direction > 0)
-    {
-        i64 i = cursor;
-        while (i < text.count)
-        {
-            i += string_seek_right_utf8(text.data + i, text.count-i);
-            if (!char_is_separator(text.data[i])) break;
-        }
+    if (page->prev) page->prev->next = page->next;
+    else *list = page->next;
+    if (page->next) page->next->prev = page->prev;
+    page->prev = NULL;
+    page->next = NULL;
+}
 
-        while (i < text.count)
-        {
-            i += string_seek_right_utf8(text.data + i, text.count-i);
-            if (char_is_separator(text.data[i])) break;
-        }
-        result = i;
-    }
-    return result;
+function void heap__list_push(Heap_Header **list, Heap_Header *page)
+{
+    page->prev = NULL;
+    page->next = *list;
+    if (*list) (*list)->prev = page;
+    *list = page;
 }
 
-function void string_select_word(String text, i64 cursor, i64 *left, i64 *right)
+function u64 heap__page_keep_size()
 {
-    i64 i = 0;
-    if (char_is_separator(text.data[i]))
-    {
-        i = cursor;
-        while (i > 0)
-        {
-            if (!char_is_separator(text.data[i])) break;
-            i -= string_seek_left_utf8(text.data+i, i);
-        }
+    // NOTE(nick): the header stays committed while a page is on the free list
+    return AlignUpPow2(HEAP_HEADER_SIZE, os_memory_page_size());
+}
 
-        if (i > 0) i += string_seek_right_utf8(text.data+i, text.count-i);
+function Heap_Header *heap__page_acquire(Heap_Thread_Cache *cache, u32 size_class)
+{
+    Heap_State *heap = &heap__state;
+    Heap_Header *page = NULL;
 
-        *left = i;
+    heap__lock();
+    page = heap->free_pages;
+    if (page) heap->free_pages = page->next;
+    heap__unlock();
 
-        i = cursor;
-        while (i < text.count)
+    if (page)
+    {
+        u64 keep = heap__page_keep_size();
+        if (keep < HEAP_PAGE_SIZE && !os_memory_commit((u8 *)page + keep, HEAP_PAGE_SIZE - keep))
         {
-            if (!char_is_separator(text.data[i])) break;
-            i += string_seek_right_utf8(text.data+i, text.count-i);
+            heap__lock();
+            page->next = heap->free_pages;
+            heap->free_pages = page;
+            heap__unlock();
+            page = NULL;
         }
-
-        *right = i;
     }
     else
     {
-        i = cursor;
-        while (i > 0)
+        heap__init();
+
+        u64 page_index = atomic_add_u64(&heap->next_page, 1);
+        if (page_index < heap->page_count)
         {
-            if (char_is_separator(text.data[i])) break;
-            i -= string_seek_left_utf8(text.data+i, i);
+            u8 *at = heap->base + page_index * HEAP_PAGE_SIZE;
+            if (os_memory_commit(at, HEAP_PAGE_SIZE))
+            {
+                page = (Heap_Header *)at;
+            }
         }
+    }
 
-        if (i > 0) i += string_seek_right_utf8(text.data+i, text.count-i);
-
-        *left = i;
+    if (page)
+    {
+        u64 item_size = heap__size_from_class(size_class);
 
-        i = cursor;
-        while (i < text.count)
-        {
-            if (char_is_separator(text.data[i])) break;
-            i += string_seek_right_utf8(text.data+i, text.count-i);
-        }
+        MemoryZeroStruct(page);
+        page->size = item_size;
+        page->size_class = size_class;
+        page->is_large = false;
+        page->owner = cache;
+        page->capacity = (u32)((HEAP_PAGE_SIZE - HEAP_HEADER_SIZE) / item_size);
 
-        *right = i;
+        heap__list_push(&cache->pages[size_class], page);
     }
-}
 
-function String_Decode string_decode_utf16(u16 *str, u64 capacity) {
-    String_Decode result = {'?', 1};
+    return page;
+}
 
-    u16 x = str[0];
+function void heap__page_release(Heap_Thread_Cache *cache, Heap_Header *page)
+{
+    Heap_State *heap = &heap__state;
 
-    if (x < 0xD800 || 0xDFFF < x) {
-        result.codepoint = x;
-        result.advance = 1;
-    } else if (capacity >= 2) {
-        u16 y = str[1];
+    heap__list_remove(&cache->pages[page->size_class], page);
+    page->owner = NULL;
 
-        if (0xD800 <= x && x < 0xDC00 && 0xDC00 <= y && y < 0xE000) {
-            result.codepoint = (((x - 0xD800) << 10) | (y - 0xDC00)) + 0x10000;
-            result.advance = 2;
-        }
+    u64 keep = heap__page_keep_size();
+    if (keep < HEAP_PAGE_SIZE)
+    {
+        os_memory_decommit((u8 *)page + keep, HEAP_PAGE_SIZE - keep);
     }
 
-    return result;
+    heap__lock();
+    page->next = heap->free_pages;
+    heap->free_pages = page;
+    heap__unlock();
 }
 
-function u32 string_encode_utf16(u16 *dest, u32 codepoint)
+function void heap__free_local(Heap_Thread_Cache *cache, Heap_Header *page, void *ptr)
 {
-    u32 advance = 1;
-    if (codepoint == ~((u32)0))
+    Heap_Free_Node *node = (Heap_Free_Node *)ptr;
+    node->next = page->free_list;
+    page->free_list = node;
+
+    if (page->used == page->capacity)
     {
-        dest[0] = (u16)'?';
+        heap__list_remove(&cache->full_pages[page->size_class], page);
+        heap__list_push(&cache->pages[page->size_class], page);
     }
-    else if (codepoint < 0x10000)
+
+    page->used -= 1;
+
+    // NOTE(nick): the first page is kept so alloc/free in a loop doesn't commit and decommit every time
+    if (page->used == 0 && page != cache->pages[page->size_class])
     {
-        dest[0] = (u16)codepoint;
+        heap__page_release(cache, page);
     }
-    else
-    {
-        u32 v = codepoint - 0x10000;
-        dest[0] = 0xD800 + (u16)(v >> 10);
-        dest[1] = 0xDC00 + (u16)(v & 0x3FF);
-        advance = 2;
-    }
-    return advance;
 }
 
-function String32 string32_from_string(Arena *arena, String str) {
-    u32 *data = PushArray(arena, u32, str.count);
-
-    u32 *at = data;
-    u8 *p0 = str.data;
-    u8 *p1 = str.data + str.count;
-
-    while (p0 < p1) {
-        String_Decode decode = string_decode_utf8(p0, cast(u64)(p1 - p0));
-
-        *at = decode.codepoint;
-        p0 += decode.advance;
-        at += 1;
+function void heap__drain_remote(Heap_Thread_Cache *cache)
+{
+    Heap_Free_Node *node = (Heap_Free_Node *)(usize)atomic_exchange_u64(&cache->remote_free, 0);
+    while (node)
+    {
+        Heap_Free_Node *next = node->next;
+        heap__free_local(cache, heap__header_from_ptr(node), node);
+        node = next;
     }
-
-    i64 alloc_count = str.count;
-    i64 string_count = cast(u64)(at - data);
-    i64 unused_count = alloc_count - string_count;
-
-    arena_pop(arena, unused_count * sizeof(u32));
-
-    return string32_make(data, string_count);
 }
 
-function String string_from_string32(Arena *arena, String32 str) {
-    u8 *data = PushArray(arena, u8, str.count * 4);
-
-    u32 *p0 = str.data;
-    u32 *p1 = str.data + str.count;
-    u8 *at = data;
-
-    while (p0 < p1) {
-        u32 advance = string_encode_utf8(at, *p0);
-
-        p0 += 1;
-        at += advance;
-    }
-
-    i64 alloc_count = str.count * 4;
-    i64 string_count = cast(u64)(at - data);
-    i64 unused_count = alloc_count - string_count;
-
-    arena_pop(arena, unused_count);
-
-    return Str8(data, string_count);
-}
+function void *heap__alloc_small(u32 size_class)
+{
+    Heap_Thread_Cache *cache = heap__get_cache();
+    void *result = NULL;
 
-function String16 string16_from_string(Arena *arena, String str) {
-    u16 *data = PushArray(arena, u16, str.count * 2 + 1);
+    if (cache)
+    {
+        Heap_Header *page = cache->pages[size_class];
+        if (!page)
+        {
+            // NOTE(nick): see what other threads gave back before taking a new page
+            heap__drain_remote(cache);
 
-    u16 *at = data;
-    u8 *p0 = str.data;
-    u8 *p1 = str.data + str.count;
+            page = cache->pages[size_class];
+            if (!page) page = heap__page_acquire(cache, size_class);
+        }
 
-    while (p0 < p1) {
-        String_Decode decode = string_decode_utf8(p0, (u64)(p1 - p0));
-        u32 encode_size = string_encode_utf16(at, decode.codepoint);
+        if (page)
+        {
+            if (page->free_list)
+            {
+                result = page->free_list;
+                page->free_list = page->free_list->next;
+            }
+            else
+            {
+                result = (u8 *)page + HEAP_HEADER_SIZE + (u64)page->bumped * page->size;
+                page->bumped += 1;
+            }
 
-        p0 += decode.advance;
-        at += encode_size;
+            page->used += 1;
+            if (page->used == page->capacity)
+            {
+                heap__list_remove(&cache->pages[size_class], page);
+                heap__list_push(&cache->full_pages[size_class], page);
+            }
+        }
     }
 
-    *at = 0;
-
-    i64 alloc_count = str.count * 2 + 1;
-    i64 string_count = cast(u64)(at - data);
-    i64 unused_count = alloc_count - string_count - 1;
-
-    arena_pop(arena, unused_count * sizeof(u16));
-
-    return Str16(data, string_count);
+    return result;
 }
 
-function String string_from_string16(Arena *arena, String16 str) {
-    String result = {0};
-    result.data = PushArray(arena, u8, str.count * 3 + 1);
-
-    u16 *p0 = str.data;
-    u16 *p1 = str.data + str.count;
-    u8 *at = result.data;
-
-    while (p0 < p1) {
-        String_Decode decode = string_decode_utf16(p0, cast(u64)(p1 - p0));
-        u32 encode_size = string_encode_utf8(at, decode.codepoint);
+function void *heap_alloc_aligned(u64 size, u32 alignment)
+{
+    void *result = NULL;
 
-        p0 += decode.advance;
-        at += encode_size;
+    if (size <= HEAP_SMALL_MAX && alignment <= 16)
+    {
+        result = heap__alloc_small(heap__class_from_size(size));
     }
 
-    result.count = at - result.data;
-
-    u64 alloc_count = str.count * 3 + 1;
-    u64 string_count = result.count;
-    u64 unused_count = alloc_count - string_count;
-    arena_pop(arena, unused_count);
+    if (!result)
+    {
+        result = heap__alloc_large(size, alignment);
+    }
 
     return result;
 }
 
-//
-// Conversions
-//
-
-function u64 string_to_u64(String str, u32 radix)
+function void *heap_alloc(u64 size)
 {
-    str = string_trim_whitespace(str);
-
-    assert(2 <= radix && radix <= 16);
-    local_persist u8 char_to_value[] =
-    {
-        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
-        0x08,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-        0xFF,0x0A,0x0B,0x0C,0x0D,0x0E,0x0F,0xFF,
-        0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-    u64 value = 0;
-    for (i64 i = 0; i < str.count; i += 1) {
-        value *= radix;
-        u8 c = str.data[i];
-        value += char_to_value[(c - 0x30)&0x1F];
-    }
-    return value;
+    return heap_alloc_aligned(size, 16);
 }
 
-function i64 string_to_i64(String str, u32 base)
+function void heap_free(void *ptr)
 {
-    str = string_trim_whitespace(str);
-
-    u64 p = 0;
-    
-    // consume sign
-    i64 sign = +1;
-    if (p < (u64)str.count)
+    if (ptr)
     {
-        u8 c = str.data[p];
-        if (c == '-')
+        Heap_Header *header = heap__header_from_ptr(ptr);
+
+        if (header->is_large)
         {
-            sign = -1;
-            p += 1;
+            os_memory_release(header->base, header->reserved);
         }
-        else if (c == '+')
+        else if (header->owner == heap__cache)
         {
-            p += 1;
+            heap__free_local(heap__cache, header, ptr);
         }
-    }
-    
-    // radix from prefix
-    u32 radix = 10;
-    if (p < (u64)str.count)
-    {
-        u8 c0 = str.data[p];
-        if (c0 == '0')
+        else
         {
-            p += 1;
-            radix = 8;
-            if (p < (u64)str.count)
+            Heap_Thread_Cache *owner = header->owner;
+            Heap_Free_Node *node = (Heap_Free_Node *)ptr;
+            u64 head = 0;
+            for (;;)
             {
-                u8 c1 = str.data[p];
-                if (c1 == 'x')
-                {
-                    p += 1;
-                    radix = 16;
-                }
-                else if (c1 == 'b')
-                {
-                    p += 1;
-                    radix = 2;
-                }
+                node->next = (Heap_Free_Node *)(usize)head;
+                u64 prev = atomic_compare_exchange_u64(&owner->remote_free, (u64)(usize)node, head);
+                if (prev == head) break;
+                head = prev;
             }
         }
     }
-    
-    // consume integer "digits"
-    String digits_substr = string_skip(str, p);
-    u64 n = string_to_u64(digits_substr, radix);
-    
-    // combine result
-    i64 result = sign*n;
-    return result;
 }
 
-function f64 string_to_f64(String string)
+function void heap_release_thread_cache()
 {
-    string = string_trim_whitespace(string);
+    Heap_Thread_Cache *cache = heap__cache;
 
-    char str[64];
-    u64 count = string.count;
-    if (count > sizeof(str) - 1)
+    if (cache)
     {
-        count = sizeof(str) - 1;
-    }
-    MemoryCopy(str, string.data, count);
-    str[count] = 0;
-    return (atof(str));
-}
-
-function b32 string_to_b32(String str)
-{
-    str = string_trim_whitespace(str);
+        heap__drain_remote(cache);
 
-    return (
-        string_match(str, S("true"), MatchFlag_IgnoreCase) ||
-        string_match(str, S("yes"), MatchFlag_IgnoreCase) ||
-        string_equals(str, S("1"))
-    );
-}
+        for (u32 size_class = 0; size_class < HEAP_CLASS_COUNT; size_class += 1)
+        {
+            Heap_Header *page = cache->pages[size_class];
+            while (page)
+            {
+                Heap_Header *next = page->next;
+                if (page->used == 0)
+                {
+                    heap__page_release(cache, page);
+                }
+                page = next;
+            }
+        }
 
-//
-// String Lists
-//
+        // NOTE(nick): pages with live items stay with the cache, the next thread adopts both.
+        // Frees in the mean time pile up on the remote list until then.
+        heap__lock();
+        cache->next = heap__state.parked_caches;
+        heap__state.parked_caches = cache;
+        heap__unlock();
 
-function void string_list_push_node(String_List *list, String_Node *n)
-{
-    QueuePush(list->first, list->last, n);
-    list->node_count += 1;
-    list->total_size += n->string.count;
+        heap__cache = NULL;
+    }
 }
 
-function void string_list_push(Arena *arena, String_List *list, String str)
+function u64 heap_size_of(void *ptr)
 {
-    String_Node *n = PushArrayZero(arena, String_Node, 1);
-    n->string = str;
-    string_list_push_node(list, n);
+    u64 result = 0;
+    if (ptr)
+    {
+        Heap_Header *header = heap__header_from_ptr(ptr);
+        result = header->size;
+    }
+    return result;
 }
 
-function void string_concat_list(String_List *list, String_List *to_push)
+function void *heap_realloc_aligned(void *ptr, u64 new_size, u32 alignment)
 {
-    if (to_push->first)
+    if (!ptr)
     {
-        list->node_count += to_push->node_count;
-        list->total_size += to_push->total_size;
-        if (list->last == 0)
-        {
-            *list = *to_push;
-        }
-        else
-        {
-            list->last->next = to_push->first;
-            list->last = to_push->last;
-        }
+        return heap_alloc_aligned(new_size, alignment);
     }
-    MemoryZero(to_push, sizeof(*to_push));
-}
 
-function String_List string_list_splits(Arena *arena, String string, int split_count, String *splits)
-{
-    String_List list = {0};
-    
-    u64 split_start = 0;
-    for (i64 i = 0; i < string.count; i += 1)
+    void *result = NULL;
+    Heap_Header *header = heap__header_from_ptr(ptr);
+
+    // NOTE(nick): staying in place keeps the old alignment, so that only works when it's enough
+    if (((usize)ptr & (Max(alignment, 16) - 1)) == 0)
     {
-        b32 was_split = 0;
-        for (int split_idx = 0; split_idx < split_count; split_idx += 1)
+        if (new_size <= header->size)
+        {
+            result = ptr;
+        }
+        else if (header->is_large)
         {
-            b32 match = 0;
-            if (i + splits[split_idx].count <= string.count)
+            u64 offset = (u8 *)ptr - header->base;
+            if (offset + new_size <= header->reserved)
             {
-                match = 1;
-                for (i64 split_i = 0; split_i < splits[split_idx].count && i + split_i < string.count; split_i += 1)
+                u64 commit_end = AlignUpPow2(offset + new_size, os_memory_page_size());
+                if (os_memory_commit(header->base + header->committed, commit_end - header->committed))
                 {
-                    if (splits[split_idx].data[split_i] != string.data[i + split_i])
-                    {
-                        match = 0;
-                        break;
-                    }
+                    header->committed = commit_end;
+                    header->size = commit_end - offset;
+                    result = ptr;
                 }
             }
-            if (match)
-            {
-                String split_string = Str8(string.data + split_start, i - split_start);
-                string_list_push(arena, &list, split_string);
-                split_start = i + splits[split_idx].count;
-                i += splits[split_idx].count - 1;
-                was_split = 1;
-                break;
-            }
         }
-        
-        if (was_split == 0 && i == string.count - 1)
+    }
+
+    if (!result)
+    {
+        result = heap_alloc_aligned(new_size, alignment);
+        if (result)
         {
-            String split_string = Str8(string.data + split_start, i+1 - split_start);
-            string_list_push(arena, &list, split_string);
-            break;
+            MemoryCopy(result, ptr, Min(header->size, new_size));
+            heap_free(ptr);
         }
     }
-    
-    return list;
+
+    return result;
+}
+
+function void *heap_realloc(void *ptr, u64 new_size)
+{
+    return heap_realloc_aligned(ptr, new_size, 16);
+}
+
+function ALLOCATOR_PROC(heap_allocator_proc)
+{
+    switch (mode) {
+        case AllocatorMode_Alloc:
+        {
+            void *result = heap_alloc_aligned(requested_size, alignment);
+            if (result)
+            {
+                MemoryZero(result, requested_size);
+            }
+            return result;
+        } break;
+
+        case AllocatorMode_Resize:
+        {
+            void *result = heap_realloc_aligned(old_memory_pointer, requested_size, alignment);
+            if (result && requested_size > old_size)
+            {
+                MemoryZero((u8 *)result + old_size, requested_size - old_size);
+            }
+            return result;
+        } break;
+
+        case AllocatorMode_Free:
+        {
+            heap_free(old_memory_pointer);
+            return NULL;
+        } break;
+
+        default:
+        {
+            return NULL;
+        } break;
+    }
+}
+
+function Allocator heap_allocator()
+{
+    Allocator result = {heap_allocator_proc, 0};
+    return result;
+}
+
+//
+// Strings
+//
+
+#include <stdarg.h>
+
+#if OS_WINDOWS
+    #define PATH_SEP '\\'
+    #define PATH_SEPARATOR S("\\")
+#else
+    #define PATH_SEP '/'
+    #define PATH_SEPARATOR S("/")
+#endif
+
+
+//
+// Char Functions
+//
+
+function b32 char_is_alpha(u8 c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+function b32 char_is_lower(u8 c) {
+    return c >= 'a' && c <= 'z';
+}
+
+function b32 char_is_upper(u8 c) {
+    return c >= 'A' && c <= 'Z';
+}
+
+function b32 char_is_digit(u8 c) {
+    return c >= '0' && c <= '9';
+}
+
+function b32 char_is_space(u8 c) {
+    return c == ' ' || c == '\t' || c == '\f' || c == '\v';
+}
+
+function b32 char_is_whitespace(u8 c) {
+    return char_is_space(c) || c == '\r' || c == '\n';
+}
+
+function b32 char_is_symbol(u8 c)
+{
+    return (c == '~' || c == '!'  || c == '$' || c == '%' || c == '^' ||
+            c == '&' || c == '*'  || c == '-' || c == '=' || c == '+' ||
+            c == '<' || c == '.'  || c == '>' || c == '/' || c == '?' ||
+            c == '|' || c == '\\' || c == '{' || c == '}' || c == '(' ||
+            c == ')' || c == '['  || c == ']' || c == '#' || c == ',' ||
+            c == ';'  || c == ':' || c == '@');
+}
+
+function b32 char_is_separator(u8 c)
+{
+    return char_is_space(c) || char_is_symbol(c);
+}
+
+function b32 char_is_slash(u8 c)
+{
+    return c == '\\' || c == '/';
+}
+
+function u8 char_to_upper(u8 c) {
+    return c >= 'a' && c <= 'z' ? c - ('a' - 'A') : c;
+}
+
+function u8 char_to_lower(u8 c) {
+    return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+function u8 char_to_forward_slash(u8 c) {
+    return c == '\\' ? '/' : c;
+}
+
+function b32 codepoint_is_whitespace(u32 codepoint)
+{
+    return (codepoint == ' '
+            || (0x09 <= codepoint && codepoint <= 0x0d) // HT, LF, VT, FF, CR
+            || codepoint == 0x85                        // NEXT LINE (NEL)
+            || codepoint == 0xa0                        // ↓ Unicode Separator, Space (Zs)
+            || (0x2000 <= codepoint && codepoint <= 0x200a)
+            || codepoint == 0x202f
+            || codepoint == 0x205f
+            || codepoint == 0x3000);
+}
+
+//
+// Constructors
+//
+
+function String string_make(u8 *data, i64 count) {
+    String result;
+    result.data = data;
+    result.count = count;
+    return result;
+}
+
+function String string_from_u8(u8 data)
+{
+    static thread_local u8 storage = 0;
+    storage = data;
+    return Str8(&storage, 1);
+}
+
+function String string_range(u8 *at, u8 *end) {
+    assert(end >= at);
+    return string_make(at, (end - at));
+}
+
+function i64 cstr_length(const char *cstr) {
+    char *at = (char *)cstr;
+
+    // @Speed: this can be made wide
+    if (at != NULL) {
+        while (*at != 0) {
+            at ++;
+        }
+    }
+
+    return at - cstr;
+}
+
+function String string_from_cstr(const char *cstr) {
+    return string_make((u8 *)cstr, cstr_length(cstr));
+}
+
+function char *string_to_cstr(Arena *arena, String str) {
+    if (!str.count || !str.data) {
+        return NULL;
+    }
+
+    char *result = PushArray(arena, char, str.count + 1); // size for null character
+    MemoryCopy(result, str.data, str.count);
+    result[str.count] = 0;
+    return result;
+}
+
+function String16 string16_make(u16 *data, i64 count) {
+    String16 result;
+    result.data = data;
+    result.count = count;
+    return result;
+}
+
+function String16 string16_from_cstr(u16 *data) {
+    u16 *at = data;
+    while (*at != 0) at += 1;
+    String16 result = Str16(data, at - data);
+    return result;
+}
+
+function String32 string32_make(u32 *data, i64 count) {
+    String32 result;
+    result.data = data;
+    result.count = count;
+    return result;
+}
+
+//
+// Substrings
+//
+
+function String string_slice(String str, i64 start_index, i64 end_index) {
+    start_index = Clamp(start_index, 0, str.count);
+    end_index   = Clamp(end_index, 0, str.count);
+
+    if (start_index > end_index)
+    {
+        i64 tmp = start_index;
+        start_index = end_index;
+        end_index = tmp;
+    }
+
+    return string_make(str.data + start_index, end_index - start_index);
+}
+
+function String string_substr(String str, i64 offset, i64 count)
+{
+    return string_slice(str, offset, offset + count);
+}
+
+function String string_skip(String str, i64 offset) {
+    return string_slice(str, offset, str.count);
+}
+
+function String string_chop(String str, i64 offset) {
+    return string_slice(str, 0, str.count - offset);
+}
+
+function String string_prefix(String str, i64 count) {
+    return string_slice(str, 0, count);
+}
+
+function String string_suffix(String str, i64 count) {
+    return string_slice(str, str.count - count, str.count);
+}
+
+//
+// Matching
+//
+
+function b32 string_equals(String a, String b)
+{
+    return a.count == b.count && MemoryEquals(a.data, b.data, a.count);
+}
+
+// NOTE(nick): index of the first byte where a and b differ (after ASCII lowercasing if fold
+// is set), or count if they don't
+function i64 string__mismatch(u8 *a, u8 *b, i64 count, b32 fold)
+{
+    i64 i = 0;
+    for (; i + SIMD_WIDTH <= count; i += SIMD_WIDTH)
+    {
+        Simd_U8 x = simd__load(a + i);
+        Simd_U8 y = simd__load(b + i);
+        if (fold)
+        {
+            x = simd__to_lower(x);
+            y = simd__to_lower(y);
+        }
+
+        u64 mask = simd__mask(simd__eq(x, y));
+        if (mask != SIMD_MASK_ALL)
+        {
+            return i + count_trailing_zeros_u64(~mask) / SIMD_LANE_BITS;
+        }
+    }
+
+    if (fold)
+    {
+        while (i < count && char_to_lower(a[i]) == char_to_lower(b[i])) i += 1;
+    }
+    else
+    {
+        while (i < count && a[i] == b[i]) i += 1;
+    }
+    return i;
+}
+
+function b32 string_match(String a, String b, Match_Flags flags)
+{
+    b32 result = false;
+
+    if (a.count == b.count || ((flags & MatchFlag_RightSideSloppy) && a.count >= b.count))
+    {
+        if (!(flags & MatchFlag_SlashInsensitive))
+        {
+            return string__mismatch(a.data, b.data, b.count, flags & MatchFlag_IgnoreCase) == b.count;
+        }
+
+        result = true;
+
+        for (i64 i = 0; i < b.count; i += 1)
+        {
+            b32 match = a.data[i] == b.data[i];
+            if (flags & MatchFlag_IgnoreCase)
+            {
+                match |= (char_to_lower(a.data[i]) == char_to_lower(b.data[i]));
+            }
+            if (flags & MatchFlag_SlashInsensitive)
+            {
+                match |= (char_to_forward_slash(a.data[i]) == char_to_forward_slash(b.data[i]));
+            }
+
+            if (!match)
+            {
+                result = false;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+function i64 string__find_slow(String str, String search, i64 start_index, Match_Flags flags)
+{
+    i64 result = str.count;
+
+    for (i64 i = start_index; i < str.count; i += 1)
+    {
+        if (i + search.count > str.count) break;
+
+        String substr = string_slice(str, i, i+search.count);
+        if (string_match(substr, search, flags))
+        {
+            result = i;
+            if (!(flags & MatchFlag_FindLast))
+            {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+//
+// NOTE(nick): the fast path checks the first and last byte of the pattern against a whole
+// block of candidate positions at once and only compares the middle for positions where
+// both of them match.
+//
+
+// NOTE(nick): returns SIMD_LANE_BITS set bits for every position i where
+// first_at[i] == first && last_at[i] == last (after ASCII lowercasing if fold is set)
+force_inline function u64 string__probe(u8 *first_at, u8 *last_at, u8 first, u8 last, b32 fold)
+{
+    Simd_U8 a = simd__load(first_at);
+    Simd_U8 b = simd__load(last_at);
+    if (fold)
+    {
+        a = simd__to_lower(a);
+        b = simd__to_lower(b);
+    }
+    return simd__mask(simd__and(simd__eq(a, simd__set1(first)), simd__eq(b, simd__set1(last))));
+}
+
+force_inline function b32 string__match_middle(u8 *at, String search, b32 fold)
+{
+    if (search.count <= 2) return true;
+
+    if (fold)
+    {
+        return string_match(string_make(at + 1, search.count - 2), string_make(search.data + 1, search.count - 2), MatchFlag_IgnoreCase);
+    }
+
+    return MemoryEquals(at + 1, search.data + 1, search.count - 2);
+}
+
+function i64 string_find(String str, String search, i64 start_index, Match_Flags flags)
+{
+    start_index = Max(start_index, 0);
+
+    if (search.count == 0 || (flags & MatchFlag_SlashInsensitive))
+    {
+        return string__find_slow(str, search, start_index, flags);
+    }
+
+    i64 result = str.count;
+    i64 end = str.count - search.count;
+
+    if (start_index > end)
+    {
+        return result;
+    }
+
+    b32 fold = (flags & MatchFlag_IgnoreCase) != 0;
+    u8 first = search.data[0];
+    u8 last  = search.data[search.count - 1];
+    if (fold)
+    {
+        first = char_to_lower(first);
+        last  = char_to_lower(last);
+    }
+
+    u8 *first_at = str.data;
+    u8 *last_at  = str.data + search.count - 1;
+    const i64 width = SIMD_WIDTH;
+
+    if (!(flags & MatchFlag_FindLast))
+    {
+        i64 i = start_index;
+        for (; i + width - 1 <= end; i += width)
+        {
+            u64 mask = string__probe(first_at + i, last_at + i, first, last, fold);
+            while (mask)
+            {
+                i64 lane = count_trailing_zeros_u64(mask) / SIMD_LANE_BITS;
+                if (string__match_middle(str.data + i + lane, search, fold)) return i + lane;
+                mask &= ~(SIMD_LANE_MASK << (lane * SIMD_LANE_BITS));
+            }
+        }
+
+        for (; i <= end; i += 1)
+        {
+            u8 a = first_at[i];
+            u8 b = last_at[i];
+            if (fold)
+            {
+                a = char_to_lower(a);
+                b = char_to_lower(b);
+            }
+
+            if (a == first && b == last && string__match_middle(str.data + i, search, fold)) return i;
+        }
+    }
+    else
+    {
+        i64 i = end;
+        for (; i - width + 1 >= start_index; i -= width)
+        {
+            i64 block = i - width + 1;
+            u64 mask = string__probe(first_at + block, last_at + block, first, last, fold);
+            while (mask)
+            {
+                i64 lane = (63 - count_leading_zeros_u64(mask)) / SIMD_LANE_BITS;
+                if (string__match_middle(str.data + block + lane, search, fold)) return block + lane;
+                mask &= ~(SIMD_LANE_MASK << (lane * SIMD_LANE_BITS));
+            }
+        }
+
+        for (; i >= start_index; i -= 1)
+        {
+            u8 a = first_at[i];
+            u8 b = last_at[i];
+            if (fold)
+            {
+                a = char_to_lower(a);
+                b = char_to_lower(b);
+            }
+
+            if (a == first && b == last && string__match_middle(str.data + i, search, fold)) return i;
+        }
+    }
+
+    return result;
+}
+
+function b32 string_includes(String str, String search)
+{
+    return string_find(str, search, 0, 0) < str.count;
+}
+
+function b32 string_starts_with(String str, String prefix) {
+    return str.count >= prefix.count && MemoryEquals(str.data, prefix.data, prefix.count);
+}
+
+function b32 string_ends_with(String str, String postfix) {
+    return (
+        str.count >= postfix.count &&
+        MemoryEquals(str.data + (str.count - postfix.count), postfix.data, postfix.count)
+    );
+}
+
+function i64 string_index(String str, String search, i64 start_index) {
+    i64 result = string_find(str, search, start_index, 0);
+    return result < str.count ? result : -1;
+}
+
+function i64 string_char_index(String str, u8 search, i64 start_index) {
+    i64 result = string_find_byte(str, search, start_index, 0);
+    return result < str.count ? result : -1;
+}
+
+function i64 string_last_index(String str, String search) {
+    i64 result = string_find(str, search, 0, MatchFlag_FindLast);
+    return result < str.count ? result : -1;
+}
+
+function b32 string_contains(String str, String search) {
+    return string_find(str, search, 0, 0) < str.count;
+}
+
+function b32 string_in_bounds(String str, i64 at) {
+    return at < str.count;
+}
+
+function void string_advance(String *str, i64 count)
+{
+    str->count -= count;
+    str->data += count;
+}
+
+function String string_split_iter(String *text, String search)
+{
+    i64 i = 0;
+    if (search.count == 1)
+    {
+        i = string_find_byte(*text, search.data[0], 0, 0);
+    }
+    else if (search.count > 1)
+    {
+        i = string_find(*text, search, 0, 0);
+    }
+
+    String result = string_slice(*text, 0, i);
+    *text = string_slice(*text, i + search.count, text->count);
+    return result;
+}
+
+//
+// Byte Scanning
+//
+
+//
+// NOTE(nick): these all return str.count when nothing is found, like string_find.
+// The only flag they look at is MatchFlag_FindLast.
+//
+
+// NOTE(nick): with a shuffle the nibble lookup costs the same as comparing against 3 bytes
+#if SIMD_HAS_SHUFFLE
+    #define STRING__SCAN_SET_MAX 3
+#else
+    #define STRING__SCAN_SET_MAX 8
+#endif
+
+force_inline function b32 string__scan_byte(String__Scanner *it, u8 c)
+{
+    switch (it->kind)
+    {
+        case String__Scan_Byte:          return c == it->byte;
+        case String__Scan_Set:           return it->table[c];
+        case String__Scan_Table:         return it->table[c];
+        case String__Scan_NotWhitespace: return !char_is_whitespace(c);
+    }
+    return false;
+}
+
+force_inline function u64 string__scan_block(String__Scanner *it, u8 *at)
+{
+    u64 result = 0;
+    Simd_U8 x = simd__load(at);
+
+    switch (it->kind)
+    {
+        case String__Scan_Byte:
+        {
+            result = simd__mask(simd__eq(x, simd__set1(it->byte)));
+        } break;
+
+        case String__Scan_Set:
+        {
+            Simd_U8 match = simd__eq(x, simd__set1(it->set.data[0]));
+            for (i64 i = 1; i < it->set.count; i += 1)
+            {
+                match = simd__or(match, simd__eq(x, simd__set1(it->set.data[i])));
+            }
+            result = simd__mask(match);
+        } break;
+
+        case String__Scan_Table:
+        {
+            #if SIMD_HAS_SHUFFLE
+            result = simd__mask(simd__in_nibble_set(x, it->nibble_rows));
+            #else
+            for (u64 i = 0; i < SIMD_WIDTH; i += 1)
+            {
+                if (it->table[at[i]]) result |= SIMD_LANE_MASK << (i * SIMD_LANE_BITS);
+            }
+            #endif
+        } break;
+
+        case String__Scan_NotWhitespace:
+        {
+            // NOTE(nick): '\t' '\n' '\v' '\f' '\r' are 9..13
+            Simd_U8 space = simd__or(simd__in_range(x, 9, 13), simd__eq(x, simd__set1(' ')));
+            result = ~simd__mask(space);
+            #if SIMD_WIDTH * SIMD_LANE_BITS < 64
+            result &= ((u64)1 << (SIMD_WIDTH * SIMD_LANE_BITS)) - 1;
+            #endif
+        } break;
+    }
+
+    return result;
+}
+
+function i64 string__scan(String str, i64 start_index, Match_Flags flags, String__Scanner *it)
+{
+    i64 i = Max(start_index, 0);
+
+    if (!(flags & MatchFlag_FindLast))
+    {
+        for (; i + SIMD_WIDTH <= str.count; i += SIMD_WIDTH)
+        {
+            u64 mask = string__scan_block(it, str.data + i);
+            if (mask) return i + count_trailing_zeros_u64(mask) / SIMD_LANE_BITS;
+        }
+
+        for (; i < str.count; i += 1)
+        {
+            if (string__scan_byte(it, str.data[i])) return i;
+        }
+    }
+    else
+    {
+        i64 end = str.count;
+        for (; end - SIMD_WIDTH >= i; end -= SIMD_WIDTH)
+        {
+            u64 mask = string__scan_block(it, str.data + end - SIMD_WIDTH);
+            if (mask) return end - SIMD_WIDTH + (63 - count_leading_zeros_u64(mask)) / SIMD_LANE_BITS;
+        }
+
+        for (end -= 1; end >= i; end -= 1)
+        {
+            if (string__scan_byte(it, str.data[end])) return end;
+        }
+    }
+
+    return str.count;
+}
+
+function i64 string_find_byte(String str, u8 byte, i64 start_index, Match_Flags flags)
+{
+    String__Scanner it;
+    it.kind = String__Scan_Byte;
+    it.byte = byte;
+    return string__scan(str, start_index, flags, &it);
+}
+
+function void string__scanner_any(String__Scanner *it, String bytes)
+{
+    if (bytes.count == 1)
+    {
+        it->kind = String__Scan_Byte;
+        it->byte = bytes.data[0];
+        return;
+    }
+
+    // NOTE(nick): past a handful of bytes the compare chain loses to a lookup table
+    it->kind = bytes.count <= STRING__SCAN_SET_MAX ? String__Scan_Set : String__Scan_Table;
+    it->set = bytes;
+    MemoryZero(it->table, sizeof(it->table));
+    MemoryZero(it->nibble_rows, sizeof(it->nibble_rows));
+    for (i64 i = 0; i < bytes.count; i += 1)
+    {
+        u8 c = bytes.data[i];
+        it->table[c] = true;
+        it->nibble_rows[(c >> 7) * 16 + (c & 0x0f)] |= (u8)(1 << ((c >> 4) & 7));
+    }
+}
+
+function i64 string_find_any(String str, String bytes, i64 start_index, Match_Flags flags)
+{
+    if (bytes.count == 0) return str.count;
+
+    String__Scanner it;
+    string__scanner_any(&it, bytes);
+    return string__scan(str, start_index, flags, &it);
+}
+
+function i64 string_find_not_whitespace(String str, i64 start_index, Match_Flags flags)
+{
+    String__Scanner it;
+    it.kind = String__Scan_NotWhitespace;
+    return string__scan(str, start_index, flags, &it);
+}
+
+function i64 string_count_byte(String str, u8 byte)
+{
+    i64 result = 0;
+    Simd_U8 needle = simd__set1(byte);
+
+    i64 i = 0;
+    for (; i + SIMD_WIDTH <= str.count; i += SIMD_WIDTH)
+    {
+        result += count_set_bits_u64(simd__mask(simd__eq(simd__load(str.data + i), needle))) / SIMD_LANE_BITS;
+    }
+
+    for (; i < str.count; i += 1)
+    {
+        result += str.data[i] == byte;
+    }
+
+    return result;
+}
+
+
+//
+// Split Iterators
+//
+
+// NOTE(nick): these walk the text lazily and hand back slices of it, nothing is allocated.
+// Every separator ends a field, so "a,,b," gives "a" "" "b" "" unless SplitFlag_SkipEmpty
+// is set. Empty text gives no fields at all.
+//
+// for (String_Split_Iter it = string_split_lines(text, 0); string_split_next(&it, &line);)
+
+enum
+{
+    String__Split_Whole,
+    String__Split_Scan,
+    String__Split_Find,
+    String__Split_Lines,
+};
+
+function String_Split_Iter string_split_by(String text, String separator, Split_Flags flags)
+{
+    String_Split_Iter result = {0};
+    result.text = text;
+    result.at = text.count > 0 ? 0 : 1;
+    result.flags = flags;
+    result.separator = separator;
+
+    if (separator.count == 1)
+    {
+        result.kind = String__Split_Scan;
+        result.scanner.kind = String__Scan_Byte;
+        result.scanner.byte = separator.data[0];
+    }
+    else if (separator.count > 1)
+    {
+        result.kind = String__Split_Find;
+    }
+
+    return result;
+}
+
+function String_Split_Iter string_split_by_any(String text, String bytes, Split_Flags flags)
+{
+    String_Split_Iter result = {0};
+    result.text = text;
+    result.at = text.count > 0 ? 0 : 1;
+    result.flags = flags;
+
+    if (bytes.count > 0)
+    {
+        result.kind = String__Split_Scan;
+        string__scanner_any(&result.scanner, bytes);
+    }
+
+    return result;
+}
+
+// NOTE(nick): splits on '\n' and drops the '\r' of a "\r\n". A final line break doesn't
+// start another (empty) line.
+function String_Split_Iter string_split_lines(String text, Split_Flags flags)
+{
+    String_Split_Iter result = {0};
+    result.text = text;
+    result.kind = String__Split_Lines;
+    result.flags = flags;
+    result.scanner.kind = String__Scan_Byte;
+    result.scanner.byte = '\n';
+    return result;
+}
+
+function b32 string_split_next(String_Split_Iter *it, String *result)
+{
+    while (it->at < it->text.count || (it->at == it->text.count && it->kind != String__Split_Lines))
+    {
+        i64 start = it->at;
+        i64 end = it->text.count;
+        i64 skip = 1;
+
+        switch (it->kind)
+        {
+            case String__Split_Scan:
+            case String__Split_Lines:
+            {
+                end = string__scan(it->text, start, 0, &it->scanner);
+            } break;
+
+            case String__Split_Find:
+            {
+                end = string_find(it->text, it->separator, start, 0);
+                skip = it->separator.count;
+            } break;
+        }
+
+        // NOTE(nick): running off the end moves us past text.count, which is how we finish
+        it->at = end + skip;
+
+        String piece = string_slice(it->text, start, end);
+        if (it->kind == String__Split_Lines && piece.count > 0 && piece.data[piece.count - 1] == '\r')
+        {
+            piece.count -= 1;
+        }
+
+        if (piece.count == 0 && (it->flags & SplitFlag_SkipEmpty)) continue;
+
+        *result = piece;
+        return true;
+    }
+
+    return false;
+}
+
+//
+// Tokenizer
+//
+
+enum
+{
+    String__Token_Word,
+    String__Token_Space,
+    String__Token_Delimiter,
+    String__Token_Quote,
+};
+
+function String_Tokenizer string_tokenizer_make(String text, String_Tokenizer_Options options)
+{
+    String_Tokenizer result = {0};
+    result.text = text;
+    result.escape = options.escape;
+
+    for (i64 i = 0; i < options.whitespace.count; i += 1) result.classes[options.whitespace.data[i]] = String__Token_Space;
+    for (i64 i = 0; i < options.delimiters.count; i += 1) result.classes[options.delimiters.data[i]] = String__Token_Delimiter;
+    for (i64 i = 0; i < options.quotes.count; i += 1)     result.classes[options.quotes.data[i]] = String__Token_Quote;
+
+    return result;
+}
+
+// NOTE(nick): a quote that never closes runs to the end of the text. When the escape byte
+// is also the quote byte a doubled quote is an escape, like in CSV.
+function b32 string_tokenizer_next(String_Tokenizer *it, String_Token *token)
+{
+    String text = it->text;
+    i64 i = it->at;
+
+    while (i < text.count && it->classes[text.data[i]] == String__Token_Space) i += 1;
+
+    if (i >= text.count)
+    {
+        it->at = text.count;
+        return false;
+    }
+
+    String_Token result = {0};
+    result.index = i;
+
+    u8 c = text.data[i];
+    switch (it->classes[c])
+    {
+        case String__Token_Delimiter:
+        {
+            result.kind = Token_Delimiter;
+            result.text = string_slice(text, i, i + 1);
+            i += 1;
+        } break;
+
+        case String__Token_Quote:
+        {
+            result.kind = Token_Quoted;
+            result.quote = c;
+
+            u8 stops_data[2] = {c, it->escape};
+            String stops = Str8(stops_data, it->escape && it->escape != c ? 2 : 1);
+
+            i64 start = i + 1;
+            i64 end = start;
+            for (;;)
+            {
+                end = string_find_any(text, stops, end, 0);
+                if (end >= text.count)
+                {
+                    i = text.count;
+                    break;
+                }
+
+                if (text.data[end] == c && !(it->escape == c && end + 1 < text.count && text.data[end + 1] == c))
+                {
+                    i = end + 1;
+                    break;
+                }
+
+                result.has_escapes = true;
+                end = Min(end + 2, text.count);
+            }
+
+            result.text = string_slice(text, start, end);
+        } break;
+
+        default:
+        {
+            i64 start = i;
+            while (i < text.count && it->classes[text.data[i]] == String__Token_Word) i += 1;
+
+            result.kind = Token_Word;
+            result.text = string_slice(text, start, i);
+        } break;
+    }
+
+    it->at = i;
+    *token = result;
+    return true;
+}
+
+// NOTE(nick): drops each escape byte and keeps the byte after it as-is
+function String string_unescape(Arena *arena, String str, u8 escape)
+{
+    String result = {0};
+    u8 *data = PushArrayNoZero(arena, u8, str.count + 1);
+    if (!data) return result;
+
+    i64 count = 0;
+    i64 i = 0;
+    while (i < str.count)
+    {
+        i64 end = string_find_byte(str, escape, i, 0);
+        MemoryCopy(data + count, str.data + i, end - i);
+        count += end - i;
+
+        if (end + 1 < str.count)
+        {
+            data[count] = str.data[end + 1];
+            count += 1;
+        }
+        i = end + 2;
+    }
+
+    data[count] = '\0';
+    arena_pop(arena, str.count - count);
+    result = Str8(data, count);
+    return result;
+}
+
+
+//
+// Allocation
+//
+
+function String string_push(Arena *arena, String str)
+{
+    String copy = {0};
+    u8 *data = PushArray(arena, u8, str.count+1);
+
+    if (data)
+    {
+        copy = string_make(data, str.count);
+        MemoryCopy(copy.data, str.data, str.count);
+        data[str.count] = '\0';
+    }
+
+    return copy;
+}
+
+function String string_alloc(String str)
+{
+    u8 *data = (u8 *)os_alloc(str.count);
+    MemoryCopy(data, str.data, str.count);
+    return string_make(data, str.count);
+}
+
+function void string_free(String *str)
+{
+    if (str->data)
+    {
+        os_free(str->data);
+        str->data = NULL;
+        str->count = 0;
+    }
+}
+
+__PrintFunction(2,0)
+function String string_printv(Arena *arena, __FormatString const char *fmt, va_list args)
+{
+    String result = {0};
+    
+    // in case we need to try a second time
+    va_list args2;
+    va_copy(args2, args);
+
+    i64 buffer_size = 1024;
+    u8 *buffer = PushArray(arena, u8, buffer_size);
+
+    if (buffer != NULL)
+    {
+        // NOTE(nick): print_to_buffer returns size excluding the null terminator
+        i64 actual_size = PrintToBuffer((char *)buffer, (int)buffer_size, fmt, args);
+
+        if (actual_size > 0)
+        {
+            if (actual_size < buffer_size)
+            {
+                // NOTE(nick): happy path
+                arena_pop(arena, buffer_size - actual_size);
+                result = string_make(buffer, actual_size);
+            }
+            else
+            {
+                arena_pop(arena, buffer_size);
+                u8 *fixed_buffer = PushArray(arena, u8, actual_size);
+
+                if (fixed_buffer != NULL)
+                {
+                    i64 final_size = PrintToBuffer((char *)fixed_buffer, (int)(actual_size + 1), fmt, args2);
+                    result = string_make(fixed_buffer, final_size);
+                }
+            }
+        }
+    }
+
+    va_end(args2);
+
+    return result;
+}
+
+__PrintFunction(2,3)
+function String string_print(Arena *arena, __FormatString const char *fmt, ...)
+{
+    String result = {0};
+
+    va_list args;
+    va_start(args, fmt);
+    result = string_printv(arena, fmt, args);
+    va_end(args);
+
+    return result;
+}
+
+function String string_replace(Arena *arena, String str, String find, String replacer, u64 replace_limit)
+{
+    if (replace_limit == 0) replace_limit = U64_MAX;
+    if (find.count <= 0) return str;
+
+    // NOTE(nick): nothing to replace, hand back the input as is
+    i64 index = string_find(str, find, 0, 0);
+    if (index >= str.count) return str;
+
+    // NOTE(nick): the output grows in place at the top of the arena, so the input is only walked once
+    String_Builder sb = sb_begin(arena, str.count);
+
+    i64 at = 0;
+    u64 replace_count = 0;
+    while (index < str.count && replace_count < replace_limit)
+    {
+        sb_push(arena, &sb, Str8(str.data + at, index - at));
+        sb_push(arena, &sb, replacer);
+        at = index + find.count;
+        replace_count += 1;
+
+        index = string_find(str, find, at, 0);
+    }
+    sb_push(arena, &sb, Str8(str.data + at, str.count - at));
+
+    return sb_end(&sb);
+}
+
+function String string_replace_many(Arena *arena, String str, String_Replacement *replacements, i64 count)
+{
+    // NOTE(nick): only positions that start with the first byte of some find are checked,
+    // and at each one the first replacement in table order that matches wins.
+    u8 first_bytes_data[256];
+    String first_bytes = Str8(first_bytes_data, 0);
+    b8 seen[256] = {0};
+    for (i64 i = 0; i < count; i += 1)
+    {
+        String find = replacements[i].find;
+        if (find.count > 0 && !seen[find.data[0]])
+        {
+            seen[find.data[0]] = true;
+            first_bytes.data[first_bytes.count] = find.data[0];
+            first_bytes.count += 1;
+        }
+    }
+    if (first_bytes.count == 0) return str;
+
+    String__Scanner it;
+    string__scanner_any(&it, first_bytes);
+
+    String_Builder sb = {0};
+
+    i64 at = 0;
+    i64 index = string__scan(str, 0, 0, &it);
+    while (index < str.count)
+    {
+        String rest = Str8(str.data + index, str.count - index);
+        String_Replacement *match = NULL;
+        for (i64 i = 0; i < count; i += 1)
+        {
+            String find = replacements[i].find;
+            if (find.count > 0 && find.count <= rest.count && MemoryEquals(rest.data, find.data, find.count))
+            {
+                match = &replacements[i];
+                break;
+            }
+        }
+
+        if (match)
+        {
+            if (!sb.arena) sb = sb_begin(arena, str.count);
+            sb_push(arena, &sb, Str8(str.data + at, index - at));
+            sb_push(arena, &sb, match->replace);
+            at = index + match->find.count;
+            index = string__scan(str, at, 0, &it);
+        }
+        else
+        {
+            index = string__scan(str, index + 1, 0, &it);
+        }
+    }
+
+    if (at == 0) return str;
+
+    sb_push(arena, &sb, Str8(str.data + at, str.count - at));
+    return sb_end(&sb);
+}
+
+//
+// Unicode Conversions
+//
+
+function String_Decode string_decode_utf8(u8 *str, u64 capacity) {
+    String_Decode result = {S_UTF8_INVALID, 1};
+
+    static u8 utf8_class[] = {
+        1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        2, 2, 2, 2, 3, 3, 4, 5,
+    };
+
+    u8 byte = str[0];
+    u8 count = utf8_class[byte >> 3];
+    // print("byte: 0x%x, count: %d\n", byte, count);
+
+    if (capacity >= count) {
+        switch (count) {
+            case 1:
+            {
+                // NOTE(nick): don't need the extra check because of the utf8_class check
+                result.advance = 1;
+                result.codepoint = str[0] & 0x7F;
+            } break;
+
+            case 2:
+            {
+                if (utf8_class[str[1] >> 3] == 0)
+                {
+                    u32 codepoint = ((str[0] & 0x1F) << 6) | (str[1] & 0x3F);
+                    if (codepoint >= 0x80 && codepoint <= 0x7FF)
+                    {
+                        result.codepoint = codepoint;
+                        result.advance = 2;
+                    }
+                }
+            } break;
+
+            case 3:
+            {
+                if (utf8_class[str[1] >> 3] == 0 && utf8_class[str[2] >> 3] == 0)
+                {
+                    u32 codepoint = (
+                        ((str[0] & 0x0F) << 12) |
+                        ((str[1] & 0x3F) << 6) |
+                        ((str[2] & 0x3F))
+                    );
+                    if (codepoint >= 0x800 && codepoint <= 0xFFFF)
+                    {
+                        result.codepoint = codepoint;
+                        result.advance = 3;
+                    }
+                }
+            } break;
+
+            case 4:
+            {
+                if (utf8_class[str[1] >> 3] == 0 && utf8_class[str[2] >> 3] == 0 && utf8_class[str[3] >> 3] == 0)
+                {
+                    u32 codepoint = (
+                        ((str[0] & 0x07) << 18) |
+                        ((str[1] & 0x3F) << 12) |
+                        ((str[2] & 0x3F) << 6) |
+                        ((str[3] & 0x3F))
+                    );
+                    if (codepoint >= 0x10000 && codepoint <= 0x10FFFF)
+                    {
+                        result.codepoint = codepoint;
+                        result.advance = 4;
+                    }
+                }
+            } break;
+        }
+    }
+
+    return result;
+}
+
+function u32 string_encode_utf8(u8 *dest, u32 codepoint) {
+    u32 advance = 0;
+
+    if (codepoint <= 0x7F)
+    {
+        advance = 1;
+        dest[0] = (u8)codepoint;
+    }
+    else if (codepoint <= 0x7FF)
+    {
+        advance = 2;
+        dest[0] = 0xC0 | (u8)((codepoint >> 6) & 0x1F);
+        dest[1] = 0x80 | (u8)(codepoint & 0x3F);
+    }
+    else if (codepoint <= 0xFFFF)
+    {
+        if (InRange(codepoint, 0xD800, 0xDFFF))
+        {
+            codepoint = S_UTF8_INVALID;
+        }
+
+        advance = 3;
+        dest[0] = 0xE0 | (u8)((codepoint >> 12) & 0x0F);
+        dest[1] = 0x80 | (u8)((codepoint >> 6) & 0x3F);
+        dest[2] = 0x80 | (u8)(codepoint & 0x3F);
+    }
+    else if (codepoint <= 0x10FFFF)
+    {
+        advance = 4;
+        dest[0] = 0xF0 | (u8)((codepoint >> 18) & 0x07);
+        dest[1] = 0x80 | (u8)((codepoint >> 12) & 0x3F);
+        dest[2] = 0x80 | (u8)((codepoint >> 6) & 0x3F);
+        dest[3] = 0x80 | (u8)(codepoint & 0x3F);
+    }
+    else
+    {
+        dest[0] = '?';
+        advance = 1;
+    }
+
+    return advance;
+}
+
+function u32 string_seek_right_utf8(u8 *data, u64 capacity) {
+    String_Decode decode = string_decode_utf8(data, capacity);
+    return decode.advance;
+}
+
+function u32 string_seek_left_utf8(u8 *data, u64 capacity) {
+    u32 advance = 0;
+
+    if (capacity >= 1)
+    {
+        u8 at = *(data - 1);
+
+        if (at < 128)
+        {
+            advance = 1;
+        }
+        else if (capacity >= 2)
+        {
+            advance = 2;
+            at = *(data - 2);
+
+            // scan for 10xxxxxx
+            if (capacity >= 3 && (at & 0xC0) == 0x80)
+            {
+                advance += 1;
+                at = *(data - 3);
+
+                if (capacity >= 4 && (at & 0xC0) == 0x80)
+                {
+                    advance += 1;
+                }
+            }
+        }
+    }
+
+    return advance;
+}
+
+function i64 string_seek_utf8(String text, i64 cursor, i64 amount)
+{
+    i64 result = 0;
+    if (amount < 0)
+    {
+        amount = -amount;
+
+        i64 i = cursor;
+        while (i > 0 && amount > 0)
+        {
+            i -= string_seek_left_utf8(text.data+i, i);
+            amount -= 1;
+        }
+
+        result = i;
+    }
+    else if (amount > 0)
+    {
+        i64 i = cursor;
+        while (i < text.count && amount > 0)
+        {
+            i += string_seek_right_utf8(text.data+i, text.count-i);
+            amount -= 1;
+        }
+
+        result = i;
+    }
+    return result;
+}
+
+function i64 string_move_word(String text, i64 cursor, i32 direction)
+{
+    i64 result = 0;
+    if (direction < 0)
+    {
+        i64 i = cursor;
+        while (i > 0)
+        {
+            i -= string_seek_left_utf8(text.data + i, i);
+            if (!char_is_separator(text.data[i])) break;
+        }
+
+        while (i > 0)
+        {
+            i -= string_seek_left_utf8(text.data + i, i);
+            if (char_is_separator(text.data[i])) break;
+        }
+
+        result = i;
+    }
+    else if (direction > 0)
+    {
+        i64 i = cursor;
+        while (i < text.count)
+        {
+            i += string_seek_right_utf8(text.data + i, text.count-i);
+            if (!char_is_separator(text.data[i])) break;
+        }
+
+        while (i < text.count)
+        {
+            i += string_seek_right_utf8(text.data + i, text.count-i);
+            if (char_is_separator(text.data[i])) break;
+        }
+        result = i;
+    }
+    return result;
+}
+
+function void string_select_word(String text, i64 cursor, i64 *left, i64 *right)
+{
+    i64 i = 0;
+    if (char_is_separator(text.data[i]))
+    {
+        i = cursor;
+        while (i > 0)
+        {
+            if (!char_is_separator(text.data[i])) break;
+            i -= string_seek_left_utf8(text.data+i, i);
+        }
+
+        if (i > 0) i += string_seek_right_utf8(text.data+i, text.count-i);
+
+        *left = i;
+
+        i = cursor;
+        while (i < text.count)
+        {
+            if (!char_is_separator(text.data[i])) break;
+            i += string_seek_right_utf8(text.data+i, text.count-i);
+        }
+
+        *right = i;
+    }
+    else
+    {
+        i = cursor;
+        while (i > 0)
+        {
+            if (char_is_separator(text.data[i])) break;
+            i -= string_seek_left_utf8(text.data+i, i);
+        }
+
+        if (i > 0) i += string_seek_right_utf8(text.data+i, text.count-i);
+
+        *left = i;
+
+        i = cursor;
+        while (i < text.count)
+        {
+            if (char_is_separator(text.data[i])) break;
+            i += string_seek_right_utf8(text.data+i, text.count-i);
+        }
+
+        *right = i;
+    }
+}
+
+function String_Decode string_decode_utf16(u16 *str, u64 capacity) {
+    String_Decode result = {'?', 1};
+
+    u16 x = str[0];
+
+    if (x < 0xD800 || 0xDFFF < x) {
+        result.codepoint = x;
+        result.advance = 1;
+    } else if (capacity >= 2) {
+        u16 y = str[1];
+
+        if (0xD800 <= x && x < 0xDC00 && 0xDC00 <= y && y < 0xE000) {
+            result.codepoint = (((x - 0xD800) << 10) | (y - 0xDC00)) + 0x10000;
+            result.advance = 2;
+        }
+    }
+
+    return result;
+}
+
+function u32 string_encode_utf16(u16 *dest, u32 codepoint)
+{
+    u32 advance = 1;
+    if (codepoint == ~((u32)0))
+    {
+        dest[0] = (u16)'?';
+    }
+    else if (codepoint < 0x10000)
+    {
+        dest[0] = (u16)codepoint;
+    }
+    else
+    {
+        u32 v = codepoint - 0x10000;
+        dest[0] = 0xD800 + (u16)(v >> 10);
+        dest[1] = 0xDC00 + (u16)(v & 0x3FF);
+        advance = 2;
+    }
+    return advance;
+}
+
+//
+// NOTE(nick): the bulk transcoders skip ASCII runs with vector compares and size their
+// output exactly up front. Input that isn't valid UTF-8 goes through the per-codepoint
+// decoder instead, which swaps bad bytes for S_UTF8_INVALID.
+//
+
+// NOTE(nick): how many bytes at the start of data are ASCII
+function i64 string__ascii_prefix(u8 *data, i64 count)
+{
+    i64 i = 0;
+
+    for (; i + 4 * SIMD_WIDTH <= count; i += 4 * SIMD_WIDTH)
+    {
+        Simd_U8 v = simd__or(
+            simd__or(simd__load(data + i), simd__load(data + i + SIMD_WIDTH)),
+            simd__or(simd__load(data + i + 2 * SIMD_WIDTH), simd__load(data + i + 3 * SIMD_WIDTH)));
+        if (simd__mask(simd__in_range(v, 0x80, 0xff))) break;
+    }
+
+    for (; i + SIMD_WIDTH <= count; i += SIMD_WIDTH)
+    {
+        u64 mask = simd__mask(simd__in_range(simd__load(data + i), 0x80, 0xff));
+        if (mask)
+        {
+            return i + count_trailing_zeros_u64(mask) / SIMD_LANE_BITS;
+        }
+    }
+
+    while (i < count && data[i] < 0x80) i += 1;
+    return i;
+}
+
+// NOTE(nick): also counts codepoints and how many of them need 4 bytes (a UTF-16 surrogate pair)
+function i64 string__validate_utf8(u8 *data, i64 count, i64 *codepoint_count, i64 *supplementary_count)
+{
+    i64 codepoints = 0;
+    i64 supplementary = 0;
+
+    i64 i = 0;
+    while (i < count)
+    {
+        i64 ascii = string__ascii_prefix(data + i, count - i);
+        codepoints += ascii;
+        i += ascii;
+
+        while (i < count && data[i] >= 0x80)
+        {
+            u8 b0 = data[i];
+
+            i64 length = 0;
+            u8 min = 0x80, max = 0xbf;
+            if      (b0 >= 0xc2 && b0 <= 0xdf) length = 2;
+            else if (b0 >= 0xe0 && b0 <= 0xef) length = 3;
+            else if (b0 >= 0xf0 && b0 <= 0xf4) length = 4;
+            else break;
+
+            // NOTE(nick): these second bytes would be overlong, a surrogate or past U+10FFFF
+            if      (b0 == 0xe0) min = 0xa0;
+            else if (b0 == 0xed) max = 0x9f;
+            else if (b0 == 0xf0) min = 0x90;
+            else if (b0 == 0xf4) max = 0x8f;
+
+            if (i + length > count) break;
+            if (data[i + 1] < min || data[i + 1] > max) break;
+            if (length >= 3 && (data[i + 2] & 0xc0) != 0x80) break;
+            if (length >= 4 && (data[i + 3] & 0xc0) != 0x80) break;
+
+            codepoints += 1;
+            supplementary += length == 4;
+            i += length;
+        }
+
+        if (i < count && data[i] >= 0x80) break;
+    }
+
+    if (codepoint_count) *codepoint_count = codepoints;
+    if (supplementary_count) *supplementary_count = supplementary;
+    return i;
+}
+
+function b32 string_is_ascii(String str)
+{
+    return string__ascii_prefix(str.data, str.count) == str.count;
+}
+
+function i64 string_validate_utf8(String str)
+{
+    return string__validate_utf8(str.data, str.count, NULL, NULL);
+}
+
+// NOTE(nick): only for input that already passed validation
+force_inline function u32 string__decode_valid_utf8(u8 *at, i64 *advance)
+{
+    u8 b0 = at[0];
+    if (b0 < 0xe0)
+    {
+        *advance = 2;
+        return ((b0 & 0x1f) << 6) | (at[1] & 0x3f);
+    }
+    if (b0 < 0xf0)
+    {
+        *advance = 3;
+        return ((b0 & 0x0f) << 12) | ((at[1] & 0x3f) << 6) | (at[2] & 0x3f);
+    }
+    *advance = 4;
+    return ((b0 & 0x07) << 18) | ((at[1] & 0x3f) << 12) | ((at[2] & 0x3f) << 6) | (at[3] & 0x3f);
+}
+
+function String32 string32_from_string(Arena *arena, String str) {
+    i64 codepoint_count = 0;
+    if (string__validate_utf8(str.data, str.count, &codepoint_count, NULL) == str.count)
+    {
+        u32 *data = PushArrayNoZero(arena, u32, codepoint_count);
+        u32 *at = data;
+        i64 i = 0;
+        while (i < str.count)
+        {
+            i64 ascii = string__ascii_prefix(str.data + i, str.count - i);
+            for (i64 j = 0; j < ascii; j += 1) at[j] = str.data[i + j];
+            at += ascii;
+            i += ascii;
+
+            while (i < str.count && str.data[i] >= 0x80)
+            {
+                i64 advance;
+                *at++ = string__decode_valid_utf8(str.data + i, &advance);
+                i += advance;
+            }
+        }
+
+        return string32_make(data, codepoint_count);
+    }
+
+    u32 *data = PushArray(arena, u32, str.count);
+
+    u32 *at = data;
+    u8 *p0 = str.data;
+    u8 *p1 = str.data + str.count;
+
+    while (p0 < p1) {
+        String_Decode decode = string_decode_utf8(p0, cast(u64)(p1 - p0));
+
+        *at = decode.codepoint;
+        p0 += decode.advance;
+        at += 1;
+    }
+
+    i64 alloc_count = str.count;
+    i64 string_count = cast(u64)(at - data);
+    i64 unused_count = alloc_count - string_count;
+
+    arena_pop(arena, unused_count * sizeof(u32));
+
+    return string32_make(data, string_count);
+}
+
+function String string_from_string32(Arena *arena, String32 str) {
+    // NOTE(nick): same sizes string_encode_utf8 writes, surrogates become U+FFFD and
+    // anything past U+10FFFF becomes '?'
+    i64 size = 0;
+    for (i64 i = 0; i < str.count; i += 1)
+    {
+        u32 codepoint = str.data[i];
+        size += 1 + (codepoint > 0x7F) + (codepoint > 0x7FF) + (codepoint > 0xFFFF) - 3 * (codepoint > 0x10FFFF);
+    }
+
+    u8 *data = PushArrayNoZero(arena, u8, size);
+
+    u32 *p0 = str.data;
+    u32 *p1 = str.data + str.count;
+    u8 *at = data;
+
+    while (p0 < p1) {
+        // NOTE(nick): two ASCII codepoints at a time
+        if (p1 - p0 >= 2)
+        {
+            u64 pair;
+            MemoryCopy(&pair, p0, sizeof(pair));
+            if ((pair & 0xFFFFFF80FFFFFF80ull) == 0)
+            {
+                at[0] = (u8)p0[0];
+                at[1] = (u8)p0[1];
+                at += 2;
+                p0 += 2;
+                continue;
+            }
+        }
+
+        u32 advance = string_encode_utf8(at, *p0);
+
+        p0 += 1;
+        at += advance;
+    }
+
+    return Str8(data, size);
+}
+
+function String16 string16_from_string(Arena *arena, String str) {
+    i64 codepoint_count = 0;
+    i64 supplementary_count = 0;
+    if (string__validate_utf8(str.data, str.count, &codepoint_count, &supplementary_count) == str.count)
+    {
+        i64 unit_count = codepoint_count + supplementary_count;
+        u16 *data = PushArrayNoZero(arena, u16, unit_count + 1);
+        u16 *at = data;
+        i64 i = 0;
+        while (i < str.count)
+        {
+            i64 ascii = string__ascii_prefix(str.data + i, str.count - i);
+            for (i64 j = 0; j < ascii; j += 1) at[j] = str.data[i + j];
+            at += ascii;
+            i += ascii;
+
+            while (i < str.count && str.data[i] >= 0x80)
+            {
+                i64 advance;
+                u32 codepoint = string__decode_valid_utf8(str.data + i, &advance);
+                at += string_encode_utf16(at, codepoint);
+                i += advance;
+            }
+        }
+
+        data[unit_count] = 0;
+        return Str16(data, unit_count);
+    }
+
+    u16 *data = PushArray(arena, u16, str.count * 2 + 1);
+
+    u16 *at = data;
+    u8 *p0 = str.data;
+    u8 *p1 = str.data + str.count;
+
+    while (p0 < p1) {
+        String_Decode decode = string_decode_utf8(p0, (u64)(p1 - p0));
+        u32 encode_size = string_encode_utf16(at, decode.codepoint);
+
+        p0 += decode.advance;
+        at += encode_size;
+    }
+
+    *at = 0;
+
+    i64 alloc_count = str.count * 2 + 1;
+    i64 string_count = cast(u64)(at - data);
+    i64 unused_count = alloc_count - string_count - 1;
+
+    arena_pop(arena, unused_count * sizeof(u16));
+
+    return Str16(data, string_count);
+}
+
+function String string_from_string16(Arena *arena, String16 str) {
+    // NOTE(nick): same sizes string_decode_utf16 + string_encode_utf8 produce, a surrogate
+    // pair is 4 bytes and a lone surrogate becomes '?'
+    i64 size = 0;
+    for (i64 i = 0; i < str.count; i += 1)
+    {
+        if (i + 4 <= str.count)
+        {
+            u64 quad;
+            MemoryCopy(&quad, str.data + i, sizeof(quad));
+            if ((quad & 0xFF80FF80FF80FF80ull) == 0)
+            {
+                size += 4;
+                i += 3;
+                continue;
+            }
+        }
+
+        u16 x = str.data[i];
+        if (x < 0x80)                     size += 1;
+        else if (x < 0x800)               size += 2;
+        else if (x < 0xD800 || x > 0xDFFF) size += 3;
+        else if (x < 0xDC00 && i + 1 < str.count && str.data[i + 1] >= 0xDC00 && str.data[i + 1] <= 0xDFFF)
+        {
+            size += 4;
+            i += 1;
+        }
+        else                              size += 1;
+    }
+
+    String result = {0};
+    result.data = PushArrayNoZero(arena, u8, size);
+
+    u16 *p0 = str.data;
+    u16 *p1 = str.data + str.count;
+    u8 *at = result.data;
+
+    while (p0 < p1) {
+        // NOTE(nick): four ASCII units at a time
+        if (p1 - p0 >= 4)
+        {
+            u64 quad;
+            MemoryCopy(&quad, p0, sizeof(quad));
+            if ((quad & 0xFF80FF80FF80FF80ull) == 0)
+            {
+                at[0] = (u8)p0[0];
+                at[1] = (u8)p0[1];
+                at[2] = (u8)p0[2];
+                at[3] = (u8)p0[3];
+                at += 4;
+                p0 += 4;
+                continue;
+            }
+        }
+
+        String_Decode decode = string_decode_utf16(p0, cast(u64)(p1 - p0));
+        u32 encode_size = string_encode_utf8(at, decode.codepoint);
+
+        p0 += decode.advance;
+        at += encode_size;
+    }
+
+    result.count = size;
+    return result;
+}
+
+//
+// Conversions
+//
+
+function u64 string_to_u64(String str, u32 radix)
+{
+    str = string_trim_whitespace(str);
+
+    assert(2 <= radix && radix <= 16);
+    local_persist u8 char_to_value[] =
+    {
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x08,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+        0xFF,0x0A,0x0B,0x0C,0x0D,0x0E,0x0F,0xFF,
+        0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    };
+    u64 value = 0;
+    if (radix == 10 && string_parse_u64(str, &value) == str.count)
+    {
+        return value;
+    }
+
+    value = 0;
+    for (i64 i = 0; i < str.count; i += 1) {
+        value *= radix;
+        u8 c = str.data[i];
+        value += char_to_value[(c - 0x30)&0x1F];
+    }
+    return value;
+}
+
+function i64 string_to_i64(String str, u32 base)
+{
+    str = string_trim_whitespace(str);
+
+    u64 p = 0;
+    
+    // consume sign
+    i64 sign = +1;
+    if (p < (u64)str.count)
+    {
+        u8 c = str.data[p];
+        if (c == '-')
+        {
+            sign = -1;
+            p += 1;
+        }
+        else if (c == '+')
+        {
+            p += 1;
+        }
+    }
+    
+    // radix from prefix
+    u32 radix = 10;
+    if (p < (u64)str.count)
+    {
+        u8 c0 = str.data[p];
+        if (c0 == '0')
+        {
+            p += 1;
+            radix = 8;
+            if (p < (u64)str.count)
+            {
+                u8 c1 = str.data[p];
+                if (c1 == 'x')
+                {
+                    p += 1;
+                    radix = 16;
+                }
+                else if (c1 == 'b')
+                {
+                    p += 1;
+                    radix = 2;
+                }
+            }
+        }
+    }
+    
+    // consume integer "digits"
+    String digits_substr = string_skip(str, p);
+    u64 n = string_to_u64(digits_substr, radix);
+    
+    // combine result
+    i64 result = sign*n;
+    return result;
+}
+
+function f64 string_to_f64(String string)
+{
+    string = string_trim_whitespace(string);
+
+    f64 value = 0;
+    if (string.count > 0 && string_parse_f64(string, &value) == string.count)
+    {
+        return value;
+    }
+
+    char str[64];
+    u64 count = string.count;
+    if (count > sizeof(str) - 1)
+    {
+        count = sizeof(str) - 1;
+    }
+    MemoryCopy(str, string.data, count);
+    str[count] = 0;
+    return (atof(str));
+}
+
+function b32 string_to_b32(String str)
+{
+    str = string_trim_whitespace(str);
+
+    return (
+        string_match(str, S("true"), MatchFlag_IgnoreCase) ||
+        string_match(str, S("yes"), MatchFlag_IgnoreCase) ||
+        string_equals(str, S("1"))
+    );
+}
+
+//
+// Number Parsing
+//
+
+force_inline function u64 string__load_u64(u8 *at)
+{
+    u64 result;
+    MemoryCopy(&result, at, sizeof(result));
+    if (ARCH_BIG_ENDIAN) result = endian_swap_u64(result);
+    return result;
+}
+
+force_inline function b32 string__is_8_digits(u64 chunk)
+{
+    return ((chunk & 0xf0f0f0f0f0f0f0f0ull) | (((chunk + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) == 0x3333333333333333ull;
+}
+
+force_inline function u32 string__parse_8_digits(u64 chunk)
+{
+    // NOTE(nick): combine neighbouring digits into pairs, then pairs into fours, then the halves
+    chunk -= 0x3030303030303030ull;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000ff000000ffull) * (100 + (1000000ull << 32))) +
+             (((chunk >> 16) & 0x000000ff000000ffull) * (1 + (10000ull << 32)))) >> 32;
+    return (u32)chunk;
+}
+
+// NOTE(nick): wraps on overflow, callers check the digit count
+function u8 *string__parse_digits(u8 *at, u8 *end, u64 *value)
+{
+    u64 result = *value;
+
+    while (end - at >= 8)
+    {
+        u64 chunk = string__load_u64(at);
+        if (!string__is_8_digits(chunk)) break;
+
+        result = result * 100000000 + string__parse_8_digits(chunk);
+        at += 8;
+    }
+
+    while (at < end && char_is_digit(*at))
+    {
+        result = result * 10 + (*at - '0');
+        at += 1;
+    }
+
+    *value = result;
+    return at;
+}
+
+function i64 string_parse_u64(String str, u64 *value)
+{
+    u8 *start = str.data;
+    u8 *end = str.data + str.count;
+
+    u8 *at = start;
+    while (at < end && *at == '0') at += 1;
+
+    // NOTE(nick): 19 digits always fit, the 20th needs checking
+    u64 result = 0;
+    u8 *significant = at;
+    at = string__parse_digits(at, Min(end, significant + 19), &result);
+
+    if (at - significant == 19 && at < end && char_is_digit(*at))
+    {
+        u64 digit = *at - '0';
+        if (result > (U64_MAX - digit) / 10) return 0;
+        result = result * 10 + digit;
+        at += 1;
+
+        if (at < end && char_is_digit(*at)) return 0;
+    }
+
+    if (at == start) return 0;
+
+    *value = result;
+    return at - start;
+}
+
+function i64 string_parse_i64(String str, i64 *value)
+{
+    i64 sign_count = 0;
+    b32 negative = false;
+    if (str.count > 0 && (str.data[0] == '-' || str.data[0] == '+'))
+    {
+        negative = str.data[0] == '-';
+        sign_count = 1;
+    }
+
+    u64 magnitude = 0;
+    i64 count = string_parse_u64(string_skip(str, sign_count), &magnitude);
+    if (count == 0) return 0;
+
+    u64 limit = negative ? (u64)I64_MAX + 1 : (u64)I64_MAX;
+    if (magnitude > limit) return 0;
+
+    *value = negative ? (i64)((u64)0 - magnitude) : (i64)magnitude;
+    return sign_count + count;
+}
+
+//
+// NOTE(nick): Eisel-Lemire (Lemire, "Number Parsing at a Gigabyte per Second"). These are
+// 10^e for e in [-348, 347] as 128 bit mantissas, rounded down, high word first.
+//
+
+#define STRING__POWERS_OF_10_MIN_EXPONENT -348
+#define STRING__POWERS_OF_10_MAX_EXPONENT 347
+
+static const u64 string__powers_of_10_u128[696][2] = {
+    {0xfa8fd5a0081c0288ull, 0x1732c869cd60e453ull}, {0x9c99e58405118195ull, 0x0e7fbd42205c8eb4ull},
+    {0xc3c05ee50655e1faull, 0x521fac92a873b261ull}, {0xf4b0769e47eb5a78ull, 0xe6a797b752909ef9ull},
+    {0x98ee4a22ecf3188bull, 0x9028bed2939a635cull}, {0xbf29dcaba82fdeaeull, 0x7432ee873880fc33ull},
+    {0xeef453d6923bd65aull, 0x113faa2906a13b3full}, {0x9558b4661b6565f8ull, 0x4ac7ca59a424c507ull},
+    {0xbaaee17fa23ebf76ull, 0x5d79bcf00d2df649ull}, {0xe95a99df8ace6f53ull, 0xf4d82c2c107973dcull},
+    {0x91d8a02bb6c10594ull, 0x79071b9b8a4be869ull}, {0xb64ec836a47146f9ull, 0x9748e2826cdee284ull},
+    {0xe3e27a444d8d98b7ull, 0xfd1b1b2308169b25ull}, {0x8e6d8c6ab0787f72ull, 0xfe30f0f5e50e20f7ull},
+    {0xb208ef855c969f4full, 0xbdbd2d335e51a935ull}, {0xde8b2b66b3bc4723ull, 0xad2c788035e61382ull},
+    {0x8b16fb203055ac76ull, 0x4c3bcb5021afcc31ull}, {0xaddcb9e83c6b1793ull, 0xdf4abe242a1bbf3dull},
+    {0xd953e8624b85dd78ull, 0xd71d6dad34a2af0dull}, {0x87d4713d6f33aa6bull, 0x8672648c40e5ad68ull},
+    {0xa9c98d8ccb009506ull, 0x680efdaf511f18c2ull}, {0xd43bf0effdc0ba48ull, 0x0212bd1b2566def2ull},
+    {0x84a57695fe98746dull, 0x014bb630f7604b57ull}, {0xa5ced43b7e3e9188ull, 0x419ea3bd35385e2dull},
+    {0xcf42894a5dce35eaull, 0x52064cac828675b9ull}, {0x818995ce7aa0e1b2ull, 0x7343efebd1940993ull},
+    {0xa1ebfb4219491a1full, 0x1014ebe6c5f90bf8ull}, {0xca66fa129f9b60a6ull, 0xd41a26e077774ef6ull},
+    {0xfd00b897478238d0ull, 0x8920b098955522b4ull}, {0x9e20735e8cb16382ull, 0x55b46e5f5d5535b0ull},
+    {0xc5a890362fddbc62ull, 0xeb2189f734aa831dull}, {0xf712b443bbd52b7bull, 0xa5e9ec7501d523e4ull},
+    {0x9a6bb0aa55653b2dull, 0x47b233c92125366eull}, {0xc1069cd4eabe89f8ull, 0x999ec0bb696e840aull},
+    {0xf148440a256e2c76ull, 0xc00670ea43ca250dull}, {0x96cd2a865764dbcaull, 0x380406926a5e5728ull},
+    {0xbc807527ed3e12bcull, 0xc605083704f5ecf2ull}, {0xeba09271e88d976bull, 0xf7864a44c633682eull},
+    {0x93445b8731587ea3ull, 0x7ab3ee6afbe0211dull}, {0xb8157268fdae9e4cull, 0x5960ea05bad82964ull},
+    {0xe61acf033d1a45dfull, 0x6fb92487298e33bdull}, {0x8fd0c16206306babull, 0xa5d3b6d479f8e056ull},
+    {0xb3c4f1ba87bc8696ull, 0x8f48a4899877186cull}, {0xe0b62e2929aba83cull, 0x331acdabfe94de87ull},
+    {0x8c71dcd9ba0b4925ull, 0x9ff0c08b7f1d0b14ull}, {0xaf8e5410288e1b6full, 0x07ecf0ae5ee44dd9ull},
+    {0xdb71e91432b1a24aull, 0xc9e82cd9f69d6150ull}, {0x892731ac9faf056eull, 0xbe311c083a225cd2ull},
+    {0xab70fe17c79ac6caull, 0x6dbd630a48aaf406ull}, {0xd64d3d9db981787dull, 0x092cbbccdad5b108ull},
+    {0x85f0468293f0eb4eull, 0x25bbf56008c58ea5ull}, {0xa76c582338ed2621ull, 0xaf2af2b80af6f24eull},
+    {0xd1476e2c07286faaull, 0x1af5af660db4aee1ull}, {0x82cca4db847945caull, 0x50d98d9fc890ed4dull},
+    {0xa37fce126597973cull, 0xe50ff107bab528a0ull}, {0xcc5fc196fefd7d0cull, 0x1e53ed49a96272c8ull},
+    {0xff77b1fcbebcdc4full, 0x25e8e89c13bb0f7aull}, {0x9faacf3df73609b1ull, 0x77b191618c54e9acull},
+    {0xc795830d75038c1dull, 0xd59df5b9ef6a2417ull}, {0xf97ae3d0d2446f25ull, 0x4b0573286b44ad1dull},
+    {0x9becce62836ac577ull, 0x4ee367f9430aec32ull}, {0xc2e801fb244576d5ull, 0x229c41f793cda73full},
+    {0xf3a20279ed56d48aull, 0x6b43527578c1110full}, {0x9845418c345644d6ull, 0x830a13896b78aaa9ull},
+    {0xbe5691ef416bd60cull, 0x23cc986bc656d553ull}, {0xedec366b11c6cb8full, 0x2cbfbe86b7ec8aa8ull},
+    {0x94b3a202eb1c3f39ull, 0x7bf7d71432f3d6a9ull}, {0xb9e08a83a5e34f07ull, 0xdaf5ccd93fb0cc53ull},
+    {0xe858ad248f5c22c9ull, 0xd1b3400f8f9cff68ull}, {0x91376c36d99995beull, 0x23100809b9c21fa1ull},
+    {0xb58547448ffffb2dull, 0xabd40a0c2832a78aull}, {0xe2e69915b3fff9f9ull, 0x16c90c8f323f516cull},
+    {0x8dd01fad907ffc3bull, 0xae3da7d97f6792e3ull}, {0xb1442798f49ffb4aull, 0x99cd11cfdf41779cull},
+    {0xdd95317f31c7fa1dull, 0x40405643d711d583ull}, {0x8a7d3eef7f1cfc52ull, 0x482835ea666b2572ull},
+    {0xad1c8eab5ee43b66ull, 0xda3243650005eecfull}, {0xd863b256369d4a40ull, 0x90bed43e40076a82ull},
+    {0x873e4f75e2224e68ull, 0x5a7744a6e804a291ull}, {0xa90de3535aaae202ull, 0x711515d0a205cb36ull},
+    {0xd3515c2831559a83ull, 0x0d5a5b44ca873e03ull}, {0x8412d9991ed58091ull, 0xe858790afe9486c2ull},
+    {0xa5178fff668ae0b6ull, 0x626e974dbe39a872ull}, {0xce5d73ff402d98e3ull, 0xfb0a3d212dc8128full},
+    {0x80fa687f881c7f8eull, 0x7ce66634bc9d0b99ull}, {0xa139029f6a239f72ull, 0x1c1fffc1ebc44e80ull},
+    {0xc987434744ac874eull, 0xa327ffb266b56220ull}, {0xfbe9141915d7a922ull, 0x4bf1ff9f0062baa8ull},
+    {0x9d71ac8fada6c9b5ull, 0x6f773fc3603db4a9ull}, {0xc4ce17b399107c22ull, 0xcb550fb4384d21d3ull},
+    {0xf6019da07f549b2bull, 0x7e2a53a146606a48ull}, {0x99c102844f94e0fbull, 0x2eda7444cbfc426dull},
+    {0xc0314325637a1939ull, 0xfa911155fefb5308ull}, {0xf03d93eebc589f88ull, 0x793555ab7eba27caull},
+    {0x96267c7535b763b5ull, 0x4bc1558b2f3458deull}, {0xbbb01b9283253ca2ull, 0x9eb1aaedfb016f16ull},
+    {0xea9c227723ee8bcbull, 0x465e15a979c1cadcull}, {0x92a1958a7675175full, 0x0bfacd89ec191ec9ull},
+    {0xb749faed14125d36ull, 0xcef980ec671f667bull}, {0xe51c79a85916f484ull, 0x82b7e12780e7401aull},
+    {0x8f31cc0937ae58d2ull, 0xd1b2ecb8b0908810ull}, {0xb2fe3f0b8599ef07ull, 0x861fa7e6dcb4aa15ull},
+    {0xdfbdcece67006ac9ull, 0x67a791e093e1d49aull}, {0x8bd6a141006042bdull, 0xe0c8bb2c5c6d24e0ull},
+    {0xaecc49914078536dull, 0x58fae9f773886e18ull}, {0xda7f5bf590966848ull, 0xaf39a475506a899eull},
+    {0x888f99797a5e012dull, 0x6d8406c952429603ull}, {0xaab37fd7d8f58178ull, 0xc8e5087ba6d33b83ull},
+    {0xd5605fcdcf32e1d6ull, 0xfb1e4a9a90880a64ull}, {0x855c3be0a17fcd26ull, 0x5cf2eea09a55067full},
+    {0xa6b34ad8c9dfc06full, 0xf42faa48c0ea481eull}, {0xd0601d8efc57b08bull, 0xf13b94daf124da26ull},
+    {0x823c12795db6ce57ull, 0x76c53d08d6b70858ull}, {0xa2cb1717b52481edull, 0x54768c4b0c64ca6eull},
+    {0xcb7ddcdda26da268ull, 0xa9942f5dcf7dfd09ull}, {0xfe5d54150b090b02ull, 0xd3f93b35435d7c4cull},
+    {0x9efa548d26e5a6e1ull, 0xc47bc5014a1a6dafull}, {0xc6b8e9b0709f109aull, 0x359ab6419ca1091bull},
+    {0xf867241c8cc6d4c0ull, 0xc30163d203c94b62ull}, {0x9b407691d7fc44f8ull, 0x79e0de63425dcf1dull},
+    {0xc21094364dfb5636ull, 0x985915fc12f542e4ull}, {0xf294b943e17a2bc4ull, 0x3e6f5b7b17b2939dull},
+    {0x979cf3ca6cec5b5aull, 0xa705992ceecf9c42ull}, {0xbd8430bd08277231ull, 0x50c6ff782a838353ull},
+    {0xece53cec4a314ebdull, 0xa4f8bf5635246428ull}, {0x940f4613ae5ed136ull, 0x871b7795e136be99ull},
+    {0xb913179899f68584ull, 0x28e2557b59846e3full}, {0xe757dd7ec07426e5ull, 0x331aeada2fe589cfull},
+    {0x9096ea6f3848984full, 0x3ff0d2c85def7621ull}, {0xb4bca50b065abe63ull, 0x0fed077a756b53a9ull},
+    {0xe1ebce4dc7f16dfbull, 0xd3e8495912c62894ull}, {0x8d3360f09cf6e4bdull, 0x64712dd7abbbd95cull},
+    {0xb080392cc4349decull, 0xbd8d794d96aacfb3ull}, {0xdca04777f541c567ull, 0xecf0d7a0fc5583a0ull},
+    {0x89e42caaf9491b60ull, 0xf41686c49db57244ull}, {0xac5d37d5b79b6239ull, 0x311c2875c522ced5ull},
+    {0xd77485cb25823ac7ull, 0x7d633293366b828bull}, {0x86a8d39ef77164bcull, 0xae5dff9c02033197ull},
+    {0xa8530886b54dbdebull, 0xd9f57f830283fdfcull}, {0xd267caa862a12d66ull, 0xd072df63c324fd7bull},
+    {0x8380dea93da4bc60ull, 0x4247cb9e59f71e6dull}, {0xa46116538d0deb78ull, 0x52d9be85f074e608ull},
+    {0xcd795be870516656ull, 0x67902e276c921f8bull}, {0x806bd9714632dff6ull, 0x00ba1cd8a3db53b6ull},
+    {0xa086cfcd97bf97f3ull, 0x80e8a40eccd228a4ull}, {0xc8a883c0fdaf7df0ull, 0x6122cd128006b2cdull},
+    {0xfad2a4b13d1b5d6cull, 0x796b805720085f81ull}, {0x9cc3a6eec6311a63ull, 0xcbe3303674053bb0ull},
+    {0xc3f490aa77bd60fcull, 0xbedbfc4411068a9cull}, {0xf4f1b4d515acb93bull, 0xee92fb5515482d44ull},
+    {0x991711052d8bf3c5ull, 0x751bdd152d4d1c4aull}, {0xbf5cd54678eef0b6ull, 0xd262d45a78a0635dull},
+    {0xef340a98172aace4ull, 0x86fb897116c87c34ull}, {0x9580869f0e7aac0eull, 0xd45d35e6ae3d4da0ull},
+    {0xbae0a846d2195712ull, 0x8974836059cca109ull}, {0xe998d258869facd7ull, 0x2bd1a438703fc94bull},
+    {0x91ff83775423cc06ull, 0x7b6306a34627ddcfull}, {0xb67f6455292cbf08ull, 0x1a3bc84c17b1d542ull},
+    {0xe41f3d6a7377eecaull, 0x20caba5f1d9e4a93ull}, {0x8e938662882af53eull, 0x547eb47b7282ee9cull},
+    {0xb23867fb2a35b28dull, 0xe99e619a4f23aa43ull}, {0xdec681f9f4c31f31ull, 0x6405fa00e2ec94d4ull},
+    {0x8b3c113c38f9f37eull, 0xde83bc408dd3dd04ull}, {0xae0b158b4738705eull, 0x9624ab50b148d445ull},
+    {0xd98ddaee19068c76ull, 0x3badd624dd9b0957ull}, {0x87f8a8d4cfa417c9ull, 0xe54ca5d70a80e5d6ull},
+    {0xa9f6d30a038d1dbcull, 0x5e9fcf4ccd211f4cull}, {0xd47487cc8470652bull, 0x7647c3200069671full},
+    {0x84c8d4dfd2c63f3bull, 0x29ecd9f40041e073ull}, {0xa5fb0a17c777cf09ull, 0xf468107100525890ull},
+    {0xcf79cc9db955c2ccull, 0x7182148d4066eeb4ull}, {0x81ac1fe293d599bfull, 0xc6f14cd848405530ull},
+    {0xa21727db38cb002full, 0xb8ada00e5a506a7cull}, {0xca9cf1d206fdc03bull, 0xa6d90811f0e4851cull},
+    {0xfd442e4688bd304aull, 0x908f4a166d1da663ull}, {0x9e4a9cec15763e2eull, 0x9a598e4e043287feull},
+    {0xc5dd44271ad3cdbaull, 0x40eff1e1853f29fdull}, {0xf7549530e188c128ull, 0xd12bee59e68ef47cull},
+    {0x9a94dd3e8cf578b9ull, 0x82bb74f8301958ceull}, {0xc13a148e3032d6e7ull, 0xe36a52363c1faf01ull},
+    {0xf18899b1bc3f8ca1ull, 0xdc44e6c3cb279ac1ull}, {0x96f5600f15a7b7e5ull, 0x29ab103a5ef8c0b9ull},
+    {0xbcb2b812db11a5deull, 0x7415d448f6b6f0e7ull}, {0xebdf661791d60f56ull, 0x111b495b3464ad21ull},
+    {0x936b9fcebb25c995ull, 0xcab10dd900beec34ull}, {0xb84687c269ef3bfbull, 0x3d5d514f40eea742ull},
+    {0xe65829b3046b0afaull, 0x0cb4a5a3112a5112ull}, {0x8ff71a0fe2c2e6dcull, 0x47f0e785eaba72abull},
+    {0xb3f4e093db73a093ull, 0x59ed216765690f56ull}, {0xe0f218b8d25088b8ull, 0x306869c13ec3532cull},
+    {0x8c974f7383725573ull, 0x1e414218c73a13fbull}, {0xafbd2350644eeacfull, 0xe5d1929ef90898faull},
+    {0xdbac6c247d62a583ull, 0xdf45f746b74abf39ull}, {0x894bc396ce5da772ull, 0x6b8bba8c328eb783ull},
+    {0xab9eb47c81f5114full, 0x066ea92f3f326564ull}, {0xd686619ba27255a2ull, 0xc80a537b0efefebdull},
+    {0x8613fd0145877585ull, 0xbd06742ce95f5f36ull}, {0xa798fc4196e952e7ull, 0x2c48113823b73704ull},
+    {0xd17f3b51fca3a7a0ull, 0xf75a15862ca504c5ull}, {0x82ef85133de648c4ull, 0x9a984d73dbe722fbull},
+    {0xa3ab66580d5fdaf5ull, 0xc13e60d0d2e0ebbaull}, {0xcc963fee10b7d1b3ull, 0x318df905079926a8ull},
+    {0xffbbcfe994e5c61full, 0xfdf17746497f7052ull}, {0x9fd561f1fd0f9bd3ull, 0xfeb6ea8bedefa633ull},
+    {0xc7caba6e7c5382c8ull, 0xfe64a52ee96b8fc0ull}, {0xf9bd690a1b68637bull, 0x3dfdce7aa3c673b0ull},
+    {0x9c1661a651213e2dull, 0x06bea10ca65c084eull}, {0xc31bfa0fe5698db8ull, 0x486e494fcff30a62ull},
+    {0xf3e2f893dec3f126ull, 0x5a89dba3c3efccfaull}, {0x986ddb5c6b3a76b7ull, 0xf89629465a75e01cull},
+    {0xbe89523386091465ull, 0xf6bbb397f1135823ull}, {0xee2ba6c0678b597full, 0x746aa07ded582e2cull},
+    {0x94db483840b717efull, 0xa8c2a44eb4571cdcull}, {0xba121a4650e4ddebull, 0x92f34d62616ce413ull},
+    {0xe896a0d7e51e1566ull, 0x77b020baf9c81d17ull}, {0x915e2486ef32cd60ull, 0x0ace1474dc1d122eull},
+    {0xb5b5ada8aaff80b8ull, 0x0d819992132456baull}, {0xe3231912d5bf60e6ull, 0x10e1fff697ed6c69ull},
+    {0x8df5efabc5979c8full, 0xca8d3ffa1ef463c1ull}, {0xb1736b96b6fd83b3ull, 0xbd308ff8a6b17cb2ull},
+    {0xddd0467c64bce4a0ull, 0xac7cb3f6d05ddbdeull}, {0x8aa22c0dbef60ee4ull, 0x6bcdf07a423aa96bull},
+    {0xad4ab7112eb3929dull, 0x86c16c98d2c953c6ull}, {0xd89d64d57a607744ull, 0xe871c7bf077ba8b7ull},
+    {0x87625f056c7c4a8bull, 0x11471cd764ad4972ull}, {0xa93af6c6c79b5d2dull, 0xd598e40d3dd89bcfull},
+    {0xd389b47879823479ull, 0x4aff1d108d4ec2c3ull}, {0x843610cb4bf160cbull, 0xcedf722a585139baull},
+    {0xa54394fe1eedb8feull, 0xc2974eb4ee658828ull}, {0xce947a3da6a9273eull, 0x733d226229feea32ull},
+    {0x811ccc668829b887ull, 0x0806357d5a3f525full}, {0xa163ff802a3426a8ull, 0xca07c2dcb0cf26f7ull},
+    {0xc9bcff6034c13052ull, 0xfc89b393dd02f0b5ull}, {0xfc2c3f3841f17c67ull, 0xbbac2078d443ace2ull},
+    {0x9d9ba7832936edc0ull, 0xd54b944b84aa4c0dull}, {0xc5029163f384a931ull, 0x0a9e795e65d4df11ull},
+    {0xf64335bcf065d37dull, 0x4d4617b5ff4a16d5ull}, {0x99ea0196163fa42eull, 0x504bced1bf8e4e45ull},
+    {0xc06481fb9bcf8d39ull, 0xe45ec2862f71e1d6ull}, {0xf07da27a82c37088ull, 0x5d767327bb4e5a4cull},
+    {0x964e858c91ba2655ull, 0x3a6a07f8d510f86full}, {0xbbe226efb628afeaull, 0x890489f70a55368bull},
+    {0xeadab0aba3b2dbe5ull, 0x2b45ac74ccea842eull}, {0x92c8ae6b464fc96full, 0x3b0b8bc90012929dull},
+    {0xb77ada0617e3bbcbull, 0x09ce6ebb40173744ull}, {0xe55990879ddcaabdull, 0xcc420a6a101d0515ull},
+    {0x8f57fa54c2a9eab6ull, 0x9fa946824a12232dull}, {0xb32df8e9f3546564ull, 0x47939822dc96abf9ull},
+    {0xdff9772470297ebdull, 0x59787e2b93bc56f7ull}, {0x8bfbea76c619ef36ull, 0x57eb4edb3c55b65aull},
+    {0xaefae51477a06b03ull, 0xede622920b6b23f1ull}, {0xdab99e59958885c4ull, 0xe95fab368e45ecedull},
+    {0x88b402f7fd75539bull, 0x11dbcb0218ebb414ull}, {0xaae103b5fcd2a881ull, 0xd652bdc29f26a119ull},
+    {0xd59944a37c0752a2ull, 0x4be76d3346f0495full}, {0x857fcae62d8493a5ull, 0x6f70a4400c562ddbull},
+    {0xa6dfbd9fb8e5b88eull, 0xcb4ccd500f6bb952ull}, {0xd097ad07a71f26b2ull, 0x7e2000a41346a7a7ull},
+    {0x825ecc24c873782full, 0x8ed400668c0c28c8ull}, {0xa2f67f2dfa90563bull, 0x728900802f0f32faull},
+    {0xcbb41ef979346bcaull, 0x4f2b40a03ad2ffb9ull}, {0xfea126b7d78186bcull, 0xe2f610c84987bfa8ull},
+    {0x9f24b832e6b0f436ull, 0x0dd9ca7d2df4d7c9ull}, {0xc6ede63fa05d3143ull, 0x91503d1c79720dbbull},
+    {0xf8a95fcf88747d94ull, 0x75a44c6397ce912aull}, {0x9b69dbe1b548ce7cull, 0xc986afbe3ee11abaull},
+    {0xc24452da229b021bull, 0xfbe85badce996168ull}, {0xf2d56790ab41c2a2ull, 0xfae27299423fb9c3ull},
+    {0x97c560ba6b0919a5ull, 0xdccd879fc967d41aull}, {0xbdb6b8e905cb600full, 0x5400e987bbc1c920ull},
+    {0xed246723473e3813ull, 0x290123e9aab23b68ull}, {0x9436c0760c86e30bull, 0xf9a0b6720aaf6521ull},
+    {0xb94470938fa89bceull, 0xf808e40e8d5b3e69ull}, {0xe7958cb87392c2c2ull, 0xb60b1d1230b20e04ull},
+    {0x90bd77f3483bb9b9ull, 0xb1c6f22b5e6f48c2ull}, {0xb4ecd5f01a4aa828ull, 0x1e38aeb6360b1af3ull},
+    {0xe2280b6c20dd5232ull, 0x25c6da63c38de1b0ull}, {0x8d590723948a535full, 0x579c487e5a38ad0eull},
+    {0xb0af48ec79ace837ull, 0x2d835a9df0c6d851ull}, {0xdcdb1b2798182244ull, 0xf8e431456cf88e65ull},
+    {0x8a08f0f8bf0f156bull, 0x1b8e9ecb641b58ffull}, {0xac8b2d36eed2dac5ull, 0xe272467e3d222f3full},
+    {0xd7adf884aa879177ull, 0x5b0ed81dcc6abb0full}, {0x86ccbb52ea94baeaull, 0x98e947129fc2b4e9ull},
+    {0xa87fea27a539e9a5ull, 0x3f2398d747b36224ull}, {0xd29fe4b18e88640eull, 0x8eec7f0d19a03aadull},
+    {0x83a3eeeef9153e89ull, 0x1953cf68300424acull}, {0xa48ceaaab75a8e2bull, 0x5fa8c3423c052dd7ull},
+    {0xcdb02555653131b6ull, 0x3792f412cb06794dull}, {0x808e17555f3ebf11ull, 0xe2bbd88bbee40bd0ull},
+    {0xa0b19d2ab70e6ed6ull, 0x5b6aceaeae9d0ec4ull}, {0xc8de047564d20a8bull, 0xf245825a5a445275ull},
+    {0xfb158592be068d2eull, 0xeed6e2f0f0d56712ull}, {0x9ced737bb6c4183dull, 0x55464dd69685606bull},
+    {0xc428d05aa4751e4cull, 0xaa97e14c3c26b886ull}, {0xf53304714d9265dfull, 0xd53dd99f4b3066a8ull},
+    {0x993fe2c6d07b7fabull, 0xe546a8038efe4029ull}, {0xbf8fdb78849a5f96ull, 0xde98520472bdd033ull},
+    {0xef73d256a5c0f77cull, 0x963e66858f6d4440ull}, {0x95a8637627989aadull, 0xdde7001379a44aa8ull},
+    {0xbb127c53b17ec159ull, 0x5560c018580d5d52ull}, {0xe9d71b689dde71afull, 0xaab8f01e6e10b4a6ull},
+    {0x9226712162ab070dull, 0xcab3961304ca70e8ull}, {0xb6b00d69bb55c8d1ull, 0x3d607b97c5fd0d22ull},
+    {0xe45c10c42a2b3b05ull, 0x8cb89a7db77c506aull}, {0x8eb98a7a9a5b04e3ull, 0x77f3608e92adb242ull},
+    {0xb267ed1940f1c61cull, 0x55f038b237591ed3ull}, {0xdf01e85f912e37a3ull, 0x6b6c46dec52f6688ull},
+    {0x8b61313bbabce2c6ull, 0x2323ac4b3b3da015ull}, {0xae397d8aa96c1b77ull, 0xabec975e0a0d081aull},
+    {0xd9c7dced53c72255ull, 0x96e7bd358c904a21ull}, {0x881cea14545c7575ull, 0x7e50d64177da2e54ull},
+    {0xaa242499697392d2ull, 0xdde50bd1d5d0b9e9ull}, {0xd4ad2dbfc3d07787ull, 0x955e4ec64b44e864ull},
+    {0x84ec3c97da624ab4ull, 0xbd5af13bef0b113eull}, {0xa6274bbdd0fadd61ull, 0xecb1ad8aeacdd58eull},
+    {0xcfb11ead453994baull, 0x67de18eda5814af2ull}, {0x81ceb32c4b43fcf4ull, 0x80eacf948770ced7ull},
+    {0xa2425ff75e14fc31ull, 0xa1258379a94d028dull}, {0xcad2f7f5359a3b3eull, 0x096ee45813a04330ull},
+    {0xfd87b5f28300ca0dull, 0x8bca9d6e188853fcull}, {0x9e74d1b791e07e48ull, 0x775ea264cf55347dull},
+    {0xc612062576589ddaull, 0x95364afe032a819dull}, {0xf79687aed3eec551ull, 0x3a83ddbd83f52204ull},
+    {0x9abe14cd44753b52ull, 0xc4926a9672793542ull}, {0xc16d9a0095928a27ull, 0x75b7053c0f178293ull},
+    {0xf1c90080baf72cb1ull, 0x5324c68b12dd6338ull}, {0x971da05074da7beeull, 0xd3f6fc16ebca5e03ull},
+    {0xbce5086492111aeaull, 0x88f4bb1ca6bcf584ull}, {0xec1e4a7db69561a5ull, 0x2b31e9e3d06c32e5ull},
+    {0x9392ee8e921d5d07ull, 0x3aff322e62439fcfull}, {0xb877aa3236a4b449ull, 0x09befeb9fad487c2ull},
+    {0xe69594bec44de15bull, 0x4c2ebe687989a9b3ull}, {0x901d7cf73ab0acd9ull, 0x0f9d37014bf60a10ull},
+    {0xb424dc35095cd80full, 0x538484c19ef38c94ull}, {0xe12e13424bb40e13ull, 0x2865a5f206b06fb9ull},
+    {0x8cbccc096f5088cbull, 0xf93f87b7442e45d3ull}, {0xafebff0bcb24aafeull, 0xf78f69a51539d748ull},
+    {0xdbe6fecebdedd5beull, 0xb573440e5a884d1bull}, {0x89705f4136b4a597ull, 0x31680a88f8953030ull},
+    {0xabcc77118461cefcull, 0xfdc20d2b36ba7c3dull}, {0xd6bf94d5e57a42bcull, 0x3d32907604691b4cull},
+    {0x8637bd05af6c69b5ull, 0xa63f9a49c2c1b10full}, {0xa7c5ac471b478423ull, 0x0fcf80dc33721d53ull},
+    {0xd1b71758e219652bull, 0xd3c36113404ea4a8ull}, {0x83126e978d4fdf3bull, 0x645a1cac083126e9ull},
+    {0xa3d70a3d70a3d70aull, 0x3d70a3d70a3d70a3ull}, {0xccccccccccccccccull, 0xccccccccccccccccull},
+    {0x8000000000000000ull, 0x0000000000000000ull}, {0xa000000000000000ull, 0x0000000000000000ull},
+    {0xc800000000000000ull, 0x0000000000000000ull}, {0xfa00000000000000ull, 0x0000000000000000ull},
+    {0x9c40000000000000ull, 0x0000000000000000ull}, {0xc350000000000000ull, 0x0000000000000000ull},
+    {0xf424000000000000ull, 0x0000000000000000ull}, {0x9896800000000000ull, 0x0000000000000000ull},
+    {0xbebc200000000000ull, 0x0000000000000000ull}, {0xee6b280000000000ull, 0x0000000000000000ull},
+    {0x9502f90000000000ull, 0x0000000000000000ull}, {0xba43b74000000000ull, 0x0000000000000000ull},
+    {0xe8d4a51000000000ull, 0x0000000000000000ull}, {0x9184e72a00000000ull, 0x0000000000000000ull},
+    {0xb5e620f480000000ull, 0x0000000000000000ull}, {0xe35fa931a0000000ull, 0x0000000000000000ull},
+    {0x8e1bc9bf04000000ull, 0x0000000000000000ull}, {0xb1a2bc2ec5000000ull, 0x0000000000000000ull},
+    {0xde0b6b3a76400000ull, 0x0000000000000000ull}, {0x8ac7230489e80000ull, 0x0000000000000000ull},
+    {0xad78ebc5ac620000ull, 0x0000000000000000ull}, {0xd8d726b7177a8000ull, 0x0000000000000000ull},
+    {0x878678326eac9000ull, 0x0000000000000000ull}, {0xa968163f0a57b400ull, 0x0000000000000000ull},
+    {0xd3c21bcecceda100ull, 0x0000000000000000ull}, {0x84595161401484a0ull, 0x0000000000000000ull},
+    {0xa56fa5b99019a5c8ull, 0x0000000000000000ull}, {0xcecb8f27f4200f3aull, 0x0000000000000000ull},
+    {0x813f3978f8940984ull, 0x4000000000000000ull}, {0xa18f07d736b90be5ull, 0x5000000000000000ull},
+    {0xc9f2c9cd04674edeull, 0xa400000000000000ull}, {0xfc6f7c4045812296ull, 0x4d00000000000000ull},
+    {0x9dc5ada82b70b59dull, 0xf020000000000000ull}, {0xc5371912364ce305ull, 0x6c28000000000000ull},
+    {0xf684df56c3e01bc6ull, 0xc732000000000000ull}, {0x9a130b963a6c115cull, 0x3c7f400000000000ull},
+    {0xc097ce7bc90715b3ull, 0x4b9f100000000000ull}, {0xf0bdc21abb48db20ull, 0x1e86d40000000000ull},
+    {0x96769950b50d88f4ull, 0x1314448000000000ull}, {0xbc143fa4e250eb31ull, 0x17d955a000000000ull},
+    {0xeb194f8e1ae525fdull, 0x5dcfab0800000000ull}, {0x92efd1b8d0cf37beull, 0x5aa1cae500000000ull},
+    {0xb7abc627050305adull, 0xf14a3d9e40000000ull}, {0xe596b7b0c643c719ull, 0x6d9ccd05d0000000ull},
+    {0x8f7e32ce7bea5c6full, 0xe4820023a2000000ull}, {0xb35dbf821ae4f38bull, 0xdda2802c8a800000ull},
+    {0xe0352f62a19e306eull, 0xd50b2037ad200000ull}, {0x8c213d9da502de45ull, 0x4526f422cc340000ull},
+    {0xaf298d050e4395d6ull, 0x9670b12b7f410000ull}, {0xdaf3f04651d47b4cull, 0x3c0cdd765f114000ull},
+    {0x88d8762bf324cd0full, 0xa5880a69fb6ac800ull}, {0xab0e93b6efee0053ull, 0x8eea0d047a457a00ull},
+    {0xd5d238a4abe98068ull, 0x72a4904598d6d880ull}, {0x85a36366eb71f041ull, 0x47a6da2b7f864750ull},
+    {0xa70c3c40a64e6c51ull, 0x999090b65f67d924ull}, {0xd0cf4b50cfe20765ull, 0xfff4b4e3f741cf6dull},
+    {0x82818f1281ed449full, 0xbff8f10e7a8921a4ull}, {0xa321f2d7226895c7ull, 0xaff72d52192b6a0dull},
+    {0xcbea6f8ceb02bb39ull, 0x9bf4f8a69f764490ull}, {0xfee50b7025c36a08ull, 0x02f236d04753d5b4ull},
+    {0x9f4f2726179a2245ull, 0x01d762422c946590ull}, {0xc722f0ef9d80aad6ull, 0x424d3ad2b7b97ef5ull},
+    {0xf8ebad2b84e0d58bull, 0xd2e0898765a7deb2ull}, {0x9b934c3b330c8577ull, 0x63cc55f49f88eb2full},
+    {0xc2781f49ffcfa6d5ull, 0x3cbf6b71c76b25fbull}, {0xf316271c7fc3908aull, 0x8bef464e3945ef7aull},
+    {0x97edd871cfda3a56ull, 0x97758bf0e3cbb5acull}, {0xbde94e8e43d0c8ecull, 0x3d52eeed1cbea317ull},
+    {0xed63a231d4c4fb27ull, 0x4ca7aaa863ee4bddull}, {0x945e455f24fb1cf8ull, 0x8fe8caa93e74ef6aull},
+    {0xb975d6b6ee39e436ull, 0xb3e2fd538e122b44ull}, {0xe7d34c64a9c85d44ull, 0x60dbbca87196b616ull},
+    {0x90e40fbeea1d3a4aull, 0xbc8955e946fe31cdull}, {0xb51d13aea4a488ddull, 0x6babab6398bdbe41ull},
+    {0xe264589a4dcdab14ull, 0xc696963c7eed2dd1ull}, {0x8d7eb76070a08aecull, 0xfc1e1de5cf543ca2ull},
+    {0xb0de65388cc8ada8ull, 0x3b25a55f43294bcbull}, {0xdd15fe86affad912ull, 0x49ef0eb713f39ebeull},
+    {0x8a2dbf142dfcc7abull, 0x6e3569326c784337ull}, {0xacb92ed9397bf996ull, 0x49c2c37f07965404ull},
+    {0xd7e77a8f87daf7fbull, 0xdc33745ec97be906ull}, {0x86f0ac99b4e8dafdull, 0x69a028bb3ded71a3ull},
+    {0xa8acd7c0222311bcull, 0xc40832ea0d68ce0cull}, {0xd2d80db02aabd62bull, 0xf50a3fa490c30190ull},
+    {0x83c7088e1aab65dbull, 0x792667c6da79e0faull}, {0xa4b8cab1a1563f52ull, 0x577001b891185938ull},
+    {0xcde6fd5e09abcf26ull, 0xed4c0226b55e6f86ull}, {0x80b05e5ac60b6178ull, 0x544f8158315b05b4ull},
+    {0xa0dc75f1778e39d6ull, 0x696361ae3db1c721ull}, {0xc913936dd571c84cull, 0x03bc3a19cd1e38e9ull},
+    {0xfb5878494ace3a5full, 0x04ab48a04065c723ull}, {0x9d174b2dcec0e47bull, 0x62eb0d64283f9c76ull},
+    {0xc45d1df942711d9aull, 0x3ba5d0bd324f8394ull}, {0xf5746577930d6500ull, 0xca8f44ec7ee36479ull},
+    {0x9968bf6abbe85f20ull, 0x7e998b13cf4e1ecbull}, {0xbfc2ef456ae276e8ull, 0x9e3fedd8c321a67eull},
+    {0xefb3ab16c59b14a2ull, 0xc5cfe94ef3ea101eull}, {0x95d04aee3b80ece5ull, 0xbba1f1d158724a12ull},
+    {0xbb445da9ca61281full, 0x2a8a6e45ae8edc97ull}, {0xea1575143cf97226ull, 0xf52d09d71a3293bdull},
+    {0x924d692ca61be758ull, 0x593c2626705f9c56ull}, {0xb6e0c377cfa2e12eull, 0x6f8b2fb00c77836cull},
+    {0xe498f455c38b997aull, 0x0b6dfb9c0f956447ull}, {0x8edf98b59a373fecull, 0x4724bd4189bd5eacull},
+    {0xb2977ee300c50fe7ull, 0x58edec91ec2cb657ull}, {0xdf3d5e9bc0f653e1ull, 0x2f2967b66737e3edull},
+    {0x8b865b215899f46cull, 0xbd79e0d20082ee74ull}, {0xae67f1e9aec07187ull, 0xecd8590680a3aa11ull},
+    {0xda01ee641a708de9ull, 0xe80e6f4820cc9495ull}, {0x884134fe908658b2ull, 0x3109058d147fdcddull},
+    {0xaa51823e34a7eedeull, 0xbd4b46f0599fd415ull}, {0xd4e5e2cdc1d1ea96ull, 0x6c9e18ac7007c91aull},
+    {0x850fadc09923329eull, 0x03e2cf6bc604ddb0ull}, {0xa6539930bf6bff45ull, 0x84db8346b786151cull},
+    {0xcfe87f7cef46ff16ull, 0xe612641865679a63ull}, {0x81f14fae158c5f6eull, 0x4fcb7e8f3f60c07eull},
+    {0xa26da3999aef7749ull, 0xe3be5e330f38f09dull}, {0xcb090c8001ab551cull, 0x5cadf5bfd3072cc5ull},
+    {0xfdcb4fa002162a63ull, 0x73d9732fc7c8f7f6ull}, {0x9e9f11c4014dda7eull, 0x2867e7fddcdd9afaull},
+    {0xc646d63501a1511dull, 0xb281e1fd541501b8ull}, {0xf7d88bc24209a565ull, 0x1f225a7ca91a4226ull},
+    {0x9ae757596946075full, 0x3375788de9b06958ull}, {0xc1a12d2fc3978937ull, 0x0052d6b1641c83aeull},
+    {0xf209787bb47d6b84ull, 0xc0678c5dbd23a49aull}, {0x9745eb4d50ce6332ull, 0xf840b7ba963646e0ull},
+    {0xbd176620a501fbffull, 0xb650e5a93bc3d898ull}, {0xec5d3fa8ce427affull, 0xa3e51f138ab4cebeull},
+    {0x93ba47c980e98cdfull, 0xc66f336c36b10137ull}, {0xb8a8d9bbe123f017ull, 0xb80b0047445d4184ull},
+    {0xe6d3102ad96cec1dull, 0xa60dc059157491e5ull}, {0x9043ea1ac7e41392ull, 0x87c89837ad68db2full},
+    {0xb454e4a179dd1877ull, 0x29babe4598c311fbull}, {0xe16a1dc9d8545e94ull, 0xf4296dd6fef3d67aull},
+    {0x8ce2529e2734bb1dull, 0x1899e4a65f58660cull}, {0xb01ae745b101e9e4ull, 0x5ec05dcff72e7f8full},
+    {0xdc21a1171d42645dull, 0x76707543f4fa1f73ull}, {0x899504ae72497ebaull, 0x6a06494a791c53a8ull},
+    {0xabfa45da0edbde69ull, 0x0487db9d17636892ull}, {0xd6f8d7509292d603ull, 0x45a9d2845d3c42b6ull},
+    {0x865b86925b9bc5c2ull, 0x0b8a2392ba45a9b2ull}, {0xa7f26836f282b732ull, 0x8e6cac7768d7141eull},
+    {0xd1ef0244af2364ffull, 0x3207d795430cd926ull}, {0x8335616aed761f1full, 0x7f44e6bd49e807b8ull},
+    {0xa402b9c5a8d3a6e7ull, 0x5f16206c9c6209a6ull}, {0xcd036837130890a1ull, 0x36dba887c37a8c0full},
+    {0x802221226be55a64ull, 0xc2494954da2c9789ull}, {0xa02aa96b06deb0fdull, 0xf2db9baa10b7bd6cull},
+    {0xc83553c5c8965d3dull, 0x6f92829494e5acc7ull}, {0xfa42a8b73abbf48cull, 0xcb772339ba1f17f9ull},
+    {0x9c69a97284b578d7ull, 0xff2a760414536efbull}, {0xc38413cf25e2d70dull, 0xfef5138519684abaull},
+    {0xf46518c2ef5b8cd1ull, 0x7eb258665fc25d69ull}, {0x98bf2f79d5993802ull, 0xef2f773ffbd97a61ull},
+    {0xbeeefb584aff8603ull, 0xaafb550ffacfd8faull}, {0xeeaaba2e5dbf6784ull, 0x95ba2a53f983cf38ull},
+    {0x952ab45cfa97a0b2ull, 0xdd945a747bf26183ull}, {0xba756174393d88dfull, 0x94f971119aeef9e4ull},
+    {0xe912b9d1478ceb17ull, 0x7a37cd5601aab85dull}, {0x91abb422ccb812eeull, 0xac62e055c10ab33aull},
+    {0xb616a12b7fe617aaull, 0x577b986b314d6009ull}, {0xe39c49765fdf9d94ull, 0xed5a7e85fda0b80bull},
+    {0x8e41ade9fbebc27dull, 0x14588f13be847307ull}, {0xb1d219647ae6b31cull, 0x596eb2d8ae258fc8ull},
+    {0xde469fbd99a05fe3ull, 0x6fca5f8ed9aef3bbull}, {0x8aec23d680043beeull, 0x25de7bb9480d5854ull},
+    {0xada72ccc20054ae9ull, 0xaf561aa79a10ae6aull}, {0xd910f7ff28069da4ull, 0x1b2ba1518094da04ull},
+    {0x87aa9aff79042286ull, 0x90fb44d2f05d0842ull}, {0xa99541bf57452b28ull, 0x353a1607ac744a53ull},
+    {0xd3fa922f2d1675f2ull, 0x42889b8997915ce8ull}, {0x847c9b5d7c2e09b7ull, 0x69956135febada11ull},
+    {0xa59bc234db398c25ull, 0x43fab9837e699095ull}, {0xcf02b2c21207ef2eull, 0x94f967e45e03f4bbull},
+    {0x8161afb94b44f57dull, 0x1d1be0eebac278f5ull}, {0xa1ba1ba79e1632dcull, 0x6462d92a69731732ull},
+    {0xca28a291859bbf93ull, 0x7d7b8f7503cfdcfeull}, {0xfcb2cb35e702af78ull, 0x5cda735244c3d43eull},
+    {0x9defbf01b061adabull, 0x3a0888136afa64a7ull}, {0xc56baec21c7a1916ull, 0x088aaa1845b8fdd0ull},
+    {0xf6c69a72a3989f5bull, 0x8aad549e57273d45ull}, {0x9a3c2087a63f6399ull, 0x36ac54e2f678864bull},
+    {0xc0cb28a98fcf3c7full, 0x84576a1bb416a7ddull}, {0xf0fdf2d3f3c30b9full, 0x656d44a2a11c51d5ull},
+    {0x969eb7c47859e743ull, 0x9f644ae5a4b1b325ull}, {0xbc4665b596706114ull, 0x873d5d9f0dde1feeull},
+    {0xeb57ff22fc0c7959ull, 0xa90cb506d155a7eaull}, {0x9316ff75dd87cbd8ull, 0x09a7f12442d588f2ull},
+    {0xb7dcbf5354e9beceull, 0x0c11ed6d538aeb2full}, {0xe5d3ef282a242e81ull, 0x8f1668c8a86da5faull},
+    {0x8fa475791a569d10ull, 0xf96e017d694487bcull}, {0xb38d92d760ec4455ull, 0x37c981dcc395a9acull},
+    {0xe070f78d3927556aull, 0x85bbe253f47b1417ull}, {0x8c469ab843b89562ull, 0x93956d7478ccec8eull},
+    {0xaf58416654a6babbull, 0x387ac8d1970027b2ull}, {0xdb2e51bfe9d0696aull, 0x06997b05fcc0319eull},
+    {0x88fcf317f22241e2ull, 0x441fece3bdf81f03ull}, {0xab3c2fddeeaad25aull, 0xd527e81cad7626c3ull},
+    {0xd60b3bd56a5586f1ull, 0x8a71e223d8d3b074ull}, {0x85c7056562757456ull, 0xf6872d5667844e49ull},
+    {0xa738c6bebb12d16cull, 0xb428f8ac016561dbull}, {0xd106f86e69d785c7ull, 0xe13336d701beba52ull},
+    {0x82a45b450226b39cull, 0xecc0024661173473ull}, {0xa34d721642b06084ull, 0x27f002d7f95d0190ull},
+    {0xcc20ce9bd35c78a5ull, 0x31ec038df7b441f4ull}, {0xff290242c83396ceull, 0x7e67047175a15271ull},
+    {0x9f79a169bd203e41ull, 0x0f0062c6e984d386ull}, {0xc75809c42c684dd1ull, 0x52c07b78a3e60868ull},
+    {0xf92e0c3537826145ull, 0xa7709a56ccdf8a82ull}, {0x9bbcc7a142b17ccbull, 0x88a66076400bb691ull},
+    {0xc2abf989935ddbfeull, 0x6acff893d00ea435ull}, {0xf356f7ebf83552feull, 0x0583f6b8c4124d43ull},
+    {0x98165af37b2153deull, 0xc3727a337a8b704aull}, {0xbe1bf1b059e9a8d6ull, 0x744f18c0592e4c5cull},
+    {0xeda2ee1c7064130cull, 0x1162def06f79df73ull}, {0x9485d4d1c63e8be7ull, 0x8addcb5645ac2ba8ull},
+    {0xb9a74a0637ce2ee1ull, 0x6d953e2bd7173692ull}, {0xe8111c87c5c1ba99ull, 0xc8fa8db6ccdd0437ull},
+    {0x910ab1d4db9914a0ull, 0x1d9c9892400a22a2ull}, {0xb54d5e4a127f59c8ull, 0x2503beb6d00cab4bull},
+    {0xe2a0b5dc971f303aull, 0x2e44ae64840fd61dull}, {0x8da471a9de737e24ull, 0x5ceaecfed289e5d2ull},
+    {0xb10d8e1456105dadull, 0x7425a83e872c5f47ull}, {0xdd50f1996b947518ull, 0xd12f124e28f77719ull},
+    {0x8a5296ffe33cc92full, 0x82bd6b70d99aaa6full}, {0xace73cbfdc0bfb7bull, 0x636cc64d1001550bull},
+    {0xd8210befd30efa5aull, 0x3c47f7e05401aa4eull}, {0x8714a775e3e95c78ull, 0x65acfaec34810a71ull},
+    {0xa8d9d1535ce3b396ull, 0x7f1839a741a14d0dull}, {0xd31045a8341ca07cull, 0x1ede48111209a050ull},
+    {0x83ea2b892091e44dull, 0x934aed0aab460432ull}, {0xa4e4b66b68b65d60ull, 0xf81da84d5617853full},
+    {0xce1de40642e3f4b9ull, 0x36251260ab9d668eull}, {0x80d2ae83e9ce78f3ull, 0xc1d72b7c6b426019ull},
+    {0xa1075a24e4421730ull, 0xb24cf65b8612f81full}, {0xc94930ae1d529cfcull, 0xdee033f26797b627ull},
+    {0xfb9b7cd9a4a7443cull, 0x169840ef017da3b1ull}, {0x9d412e0806e88aa5ull, 0x8e1f289560ee864eull},
+    {0xc491798a08a2ad4eull, 0xf1a6f2bab92a27e2ull}, {0xf5b5d7ec8acb58a2ull, 0xae10af696774b1dbull},
+    {0x9991a6f3d6bf1765ull, 0xacca6da1e0a8ef29ull}, {0xbff610b0cc6edd3full, 0x17fd090a58d32af3ull},
+    {0xeff394dcff8a948eull, 0xddfc4b4cef07f5b0ull}, {0x95f83d0a1fb69cd9ull, 0x4abdaf101564f98eull},
+    {0xbb764c4ca7a4440full, 0x9d6d1ad41abe37f1ull}, {0xea53df5fd18d5513ull, 0x84c86189216dc5edull},
+    {0x92746b9be2f8552cull, 0x32fd3cf5b4e49bb4ull}, {0xb7118682dbb66a77ull, 0x3fbc8c33221dc2a1ull},
+    {0xe4d5e82392a40515ull, 0x0fabaf3feaa5334aull}, {0x8f05b1163ba6832dull, 0x29cb4d87f2a7400eull},
+    {0xb2c71d5bca9023f8ull, 0x743e20e9ef511012ull}, {0xdf78e4b2bd342cf6ull, 0x914da9246b255416ull},
+    {0x8bab8eefb6409c1aull, 0x1ad089b6c2f7548eull}, {0xae9672aba3d0c320ull, 0xa184ac2473b529b1ull},
+    {0xda3c0f568cc4f3e8ull, 0xc9e5d72d90a2741eull}, {0x8865899617fb1871ull, 0x7e2fa67c7a658892ull},
+    {0xaa7eebfb9df9de8dull, 0xddbb901b98feeab7ull}, {0xd51ea6fa85785631ull, 0x552a74227f3ea565ull},
+    {0x8533285c936b35deull, 0xd53a88958f87275full}, {0xa67ff273b8460356ull, 0x8a892abaf368f137ull},
+    {0xd01fef10a657842cull, 0x2d2b7569b0432d85ull}, {0x8213f56a67f6b29bull, 0x9c3b29620e29fc73ull},
+    {0xa298f2c501f45f42ull, 0x8349f3ba91b47b8full}, {0xcb3f2f7642717713ull, 0x241c70a936219a73ull},
+    {0xfe0efb53d30dd4d7ull, 0xed238cd383aa0110ull}, {0x9ec95d1463e8a506ull, 0xf4363804324a40aaull},
+    {0xc67bb4597ce2ce48ull, 0xb143c6053edcd0d5ull}, {0xf81aa16fdc1b81daull, 0xdd94b7868e94050aull},
+    {0x9b10a4e5e9913128ull, 0xca7cf2b4191c8326ull}, {0xc1d4ce1f63f57d72ull, 0xfd1c2f611f63a3f0ull},
+    {0xf24a01a73cf2dccfull, 0xbc633b39673c8cecull}, {0x976e41088617ca01ull, 0xd5be0503e085d813ull},
+    {0xbd49d14aa79dbc82ull, 0x4b2d8644d8a74e18ull}, {0xec9c459d51852ba2ull, 0xddf8e7d60ed1219eull},
+    {0x93e1ab8252f33b45ull, 0xcabb90e5c942b503ull}, {0xb8da1662e7b00a17ull, 0x3d6a751f3b936243ull},
+    {0xe7109bfba19c0c9dull, 0x0cc512670a783ad4ull}, {0x906a617d450187e2ull, 0x27fb2b80668b24c5ull},
+    {0xb484f9dc9641e9daull, 0xb1f9f660802dedf6ull}, {0xe1a63853bbd26451ull, 0x5e7873f8a0396973ull},
+    {0x8d07e33455637eb2ull, 0xdb0b487b6423e1e8ull}, {0xb049dc016abc5e5full, 0x91ce1a9a3d2cda62ull},
+    {0xdc5c5301c56b75f7ull, 0x7641a140cc7810fbull}, {0x89b9b3e11b6329baull, 0xa9e904c87fcb0a9dull},
+    {0xac2820d9623bf429ull, 0x546345fa9fbdcd44ull}, {0xd732290fbacaf133ull, 0xa97c177947ad4095ull},
+    {0x867f59a9d4bed6c0ull, 0x49ed8eabcccc485dull}, {0xa81f301449ee8c70ull, 0x5c68f256bfff5a74ull},
+    {0xd226fc195c6a2f8cull, 0x73832eec6fff3111ull}, {0x83585d8fd9c25db7ull, 0xc831fd53c5ff7eabull},
+    {0xa42e74f3d032f525ull, 0xba3e7ca8b77f5e55ull}, {0xcd3a1230c43fb26full, 0x28ce1bd2e55f35ebull},
+    {0x80444b5e7aa7cf85ull, 0x7980d163cf5b81b3ull}, {0xa0555e361951c366ull, 0xd7e105bcc332621full},
+    {0xc86ab5c39fa63440ull, 0x8dd9472bf3fefaa7ull}, {0xfa856334878fc150ull, 0xb14f98f6f0feb951ull},
+    {0x9c935e00d4b9d8d2ull, 0x6ed1bf9a569f33d3ull}, {0xc3b8358109e84f07ull, 0x0a862f80ec4700c8ull},
+    {0xf4a642e14c6262c8ull, 0xcd27bb612758c0faull}, {0x98e7e9cccfbd7dbdull, 0x8038d51cb897789cull},
+    {0xbf21e44003acdd2cull, 0xe0470a63e6bd56c3ull}, {0xeeea5d5004981478ull, 0x1858ccfce06cac74ull},
+    {0x95527a5202df0ccbull, 0x0f37801e0c43ebc8ull}, {0xbaa718e68396cffdull, 0xd30560258f54e6baull},
+    {0xe950df20247c83fdull, 0x47c6b82ef32a2069ull}, {0x91d28b7416cdd27eull, 0x4cdc331d57fa5441ull},
+    {0xb6472e511c81471dull, 0xe0133fe4adf8e952ull}, {0xe3d8f9e563a198e5ull, 0x58180fddd97723a6ull},
+    {0x8e679c2f5e44ff8full, 0x570f09eaa7ea7648ull}, {0xb201833b35d63f73ull, 0x2cd2cc6551e513daull},
+    {0xde81e40a034bcf4full, 0xf8077f7ea65e58d1ull}, {0x8b112e86420f6191ull, 0xfb04afaf27faf782ull},
+    {0xadd57a27d29339f6ull, 0x79c5db9af1f9b563ull}, {0xd94ad8b1c7380874ull, 0x18375281ae7822bcull},
+    {0x87cec76f1c830548ull, 0x8f2293910d0b15b5ull}, {0xa9c2794ae3a3c69aull, 0xb2eb3875504ddb22ull},
+    {0xd433179d9c8cb841ull, 0x5fa60692a46151ebull}, {0x849feec281d7f328ull, 0xdbc7c41ba6bcd333ull},
+    {0xa5c7ea73224deff3ull, 0x12b9b522906c0800ull}, {0xcf39e50feae16befull, 0xd768226b34870a00ull},
+    {0x81842f29f2cce375ull, 0xe6a1158300d46640ull}, {0xa1e53af46f801c53ull, 0x60495ae3c1097fd0ull},
+    {0xca5e89b18b602368ull, 0x385bb19cb14bdfc4ull}, {0xfcf62c1dee382c42ull, 0x46729e03dd9ed7b5ull},
+    {0x9e19db92b4e31ba9ull, 0x6c07a2c26a8346d1ull}, {0xc5a05277621be293ull, 0xc7098b7305241885ull},
+    {0xf70867153aa2db38ull, 0xb8cbee4fc66d1ea7ull}, {0x9a65406d44a5c903ull, 0x737f74f1dc043328ull},
+    {0xc0fe908895cf3b44ull, 0x505f522e53053ff2ull}, {0xf13e34aabb430a15ull, 0x647726b9e7c68fefull},
+    {0x96c6e0eab509e64dull, 0x5eca783430dc19f5ull}, {0xbc789925624c5fe0ull, 0xb67d16413d132072ull},
+    {0xeb96bf6ebadf77d8ull, 0xe41c5bd18c57e88full}, {0x933e37a534cbaae7ull, 0x8e91b962f7b6f159ull},
+    {0xb80dc58e81fe95a1ull, 0x723627bbb5a4adb0ull}, {0xe61136f2227e3b09ull, 0xcec3b1aaa30dd91cull},
+    {0x8fcac257558ee4e6ull, 0x213a4f0aa5e8a7b1ull}, {0xb3bd72ed2af29e1full, 0xa988e2cd4f62d19dull},
+    {0xe0accfa875af45a7ull, 0x93eb1b80a33b8605ull}, {0x8c6c01c9498d8b88ull, 0xbc72f130660533c3ull},
+    {0xaf87023b9bf0ee6aull, 0xeb8fad7c7f8680b4ull}, {0xdb68c2ca82ed2a05ull, 0xa67398db9f6820e1ull},
+    {0x892179be91d43a43ull, 0x88083f8943a1148cull}, {0xab69d82e364948d4ull, 0x6a0a4f6b948959b0ull},
+    {0xd6444e39c3db9b09ull, 0x848ce34679abb01cull}, {0x85eab0e41a6940e5ull, 0xf2d80e0c0c0b4e11ull},
+    {0xa7655d1d2103911full, 0x6f8e118f0f0e2195ull}, {0xd13eb46469447567ull, 0x4b7195f2d2d1a9fbull},
+};
+
+static const f64 string__exact_powers_of_10[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+function b32 string__eisel_lemire(u64 mantissa, i64 exponent, b32 negative, f64 *value)
+{
+    u64 bits = 0;
+
+    if (mantissa != 0)
+    {
+        if (exponent < STRING__POWERS_OF_10_MIN_EXPONENT || exponent > STRING__POWERS_OF_10_MAX_EXPONENT)
+        {
+            return false;
+        }
+
+        u32 clz = count_leading_zeros_u64(mantissa);
+        mantissa <<= clz;
+        u64 result_exponent = (u64)(((217706 * exponent) >> 16) + 64 + 1023) - clz;
+
+        const u64 *power = string__powers_of_10_u128[exponent - STRING__POWERS_OF_10_MIN_EXPONENT];
+        u64 hi;
+        u64 lo = multiply_u64_wide(mantissa, power[0], &hi);
+
+        // NOTE(nick): the truncated power might be off in the low bits, look at the next word
+        if ((hi & 0x1ff) == 0x1ff && lo + mantissa < mantissa)
+        {
+            u64 y_hi;
+            u64 y_lo = multiply_u64_wide(mantissa, power[1], &y_hi);
+            u64 merged_hi = hi;
+            u64 merged_lo = lo + y_hi;
+            if (merged_lo < lo) merged_hi += 1;
+            if ((merged_hi & 0x1ff) == 0x1ff && merged_lo + 1 == 0 && y_lo + mantissa < mantissa)
+            {
+                return false;
+            }
+            hi = merged_hi;
+            lo = merged_lo;
+        }
+
+        u64 msb = hi >> 63;
+        u64 result_mantissa = hi >> (msb + 9);
+        result_exponent -= 1 ^ msb;
+
+        // NOTE(nick): exactly halfway between two doubles, we can't tell which way to round
+        if (lo == 0 && (hi & 0x1ff) == 0 && (result_mantissa & 3) == 1)
+        {
+            return false;
+        }
+
+        result_mantissa += result_mantissa & 1;
+        result_mantissa >>= 1;
+        if (result_mantissa >> 53)
+        {
+            result_mantissa >>= 1;
+            result_exponent += 1;
+        }
+
+        // NOTE(nick): subnormals and overflow go to the slow path
+        if (result_exponent - 1 >= 0x7ff - 1)
+        {
+            return false;
+        }
+
+        bits = (result_exponent << 52) | (result_mantissa & ((1ull << 52) - 1));
+    }
+
+    if (negative) bits |= 1ull << 63;
+    MemoryCopy(value, &bits, sizeof(bits));
+    return true;
+}
+
+function i64 string_parse_f64(String str, f64 *value)
+{
+    u8 *start = str.data;
+    u8 *end = str.data + str.count;
+    u8 *at = start;
+
+    b32 negative = false;
+    if (at < end && (*at == '-' || *at == '+'))
+    {
+        negative = *at == '-';
+        at += 1;
+    }
+
+    if (at < end && (char_to_lower(*at) == 'i' || char_to_lower(*at) == 'n'))
+    {
+        String rest = Str8(at, end - at);
+        u64 bits = 0;
+        i64 count = 0;
+        if (string_match(string_prefix(rest, 8), S("infinity"), MatchFlag_IgnoreCase))
+        {
+            bits = 0x7ff0000000000000ull;
+            count = 8;
+        }
+        else if (string_match(string_prefix(rest, 3), S("inf"), MatchFlag_IgnoreCase))
+        {
+            bits = 0x7ff0000000000000ull;
+            count = 3;
+        }
+        else if (string_match(string_prefix(rest, 3), S("nan"), MatchFlag_IgnoreCase))
+        {
+            bits = 0x7ff8000000000000ull;
+            count = 3;
+        }
+        if (count == 0) return 0;
+
+        if (negative) bits |= 1ull << 63;
+        MemoryCopy(value, &bits, sizeof(bits));
+        return (at - start) + count;
+    }
+
+    // NOTE(nick): leading zeros don't count towards the 19 digits a u64 can hold
+    u64 mantissa = 0;
+    i64 exponent = 0;
+
+    u8 *integer_start = at;
+    while (at < end && *at == '0') at += 1;
+    u8 *significant = at;
+    at = string__parse_digits(at, end, &mantissa);
+    i64 digit_count = at - significant;
+    i64 integer_count = at - integer_start;
+
+    i64 fraction_count = 0;
+    if (at < end && *at == '.')
+    {
+        at += 1;
+        u8 *fraction_start = at;
+        if (mantissa == 0)
+        {
+            while (at < end && *at == '0') at += 1;
+        }
+        significant = at;
+        at = string__parse_digits(at, end, &mantissa);
+        digit_count += at - significant;
+        fraction_count = at - fraction_start;
+        exponent -= fraction_count;
+    }
+
+    if (integer_count + fraction_count == 0) return 0;
+
+    if (at < end && (*at == 'e' || *at == 'E'))
+    {
+        u8 *e = at + 1;
+        b32 exponent_negative = false;
+        if (e < end && (*e == '-' || *e == '+'))
+        {
+            exponent_negative = *e == '-';
+            e += 1;
+        }
+
+        // NOTE(nick): "1e" is just 1 followed by an 'e'
+        if (e < end && char_is_digit(*e))
+        {
+            i64 explicit_exponent = 0;
+            while (e < end && char_is_digit(*e))
+            {
+                if (explicit_exponent < 100000) explicit_exponent = explicit_exponent * 10 + (*e - '0');
+                e += 1;
+            }
+            exponent += exponent_negative ? -explicit_exponent : explicit_exponent;
+            at = e;
+        }
+    }
+
+    i64 count = at - start;
+
+    if (digit_count <= 19)
+    {
+        // NOTE(nick): both operands are exact doubles so a single multiply or divide rounds correctly
+        if (mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22)
+        {
+            f64 result = (f64)mantissa;
+            if (exponent < 0) result /= string__exact_powers_of_10[-exponent];
+            else              result *= string__exact_powers_of_10[exponent];
+            *value = negative ? -result : result;
+            return count;
+        }
+
+        if (string__eisel_lemire(mantissa, exponent, negative, value))
+        {
+            return count;
+        }
+    }
+
+    // NOTE(nick): too many digits, subnormals, overflow or a halfway case
+    M_Temp scratch = GetScratch(0, 0);
+    char *cstr = string_to_cstr(scratch.arena, Str8(start, count));
+    *value = strtod(cstr, NULL);
+    ReleaseScratch(scratch);
+
+    return count;
+}
+
+//
+// Number Formatting
+//
+
+static const char string__digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static const u64 string__powers_of_10[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+    10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+    100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull,
+};
+
+function i64 string__count_digits_u64(u64 value)
+{
+    // NOTE(nick): 1233 / 4096 is close enough to log10(2) for the first guess,
+    // value | 1 makes 0 count as one digit
+    value |= 1;
+    i64 bits = 64 - count_leading_zeros_u64(value);
+    i64 guess = (bits * 1233) >> 12;
+    return guess + (value >= string__powers_of_10[guess]);
+}
+
+function i64 string_write_u64(u8 *dest, u64 value)
+{
+    i64 count = string__count_digits_u64(value);
+
+    // NOTE(nick): two digits per divide, written back to front
+    u8 *at = dest + count;
+    while (value >= 100)
+    {
+        u64 index = (value % 100) * 2;
+        value /= 100;
+        at -= 2;
+        at[0] = string__digit_pairs[index + 0];
+        at[1] = string__digit_pairs[index + 1];
+    }
+
+    if (value >= 10)
+    {
+        at -= 2;
+        at[0] = string__digit_pairs[value * 2 + 0];
+        at[1] = string__digit_pairs[value * 2 + 1];
+    }
+    else
+    {
+        at -= 1;
+        at[0] = '0' + (u8)value;
+    }
+
+    return count;
+}
+
+function i64 string_write_i64(u8 *dest, i64 value)
+{
+    if (value < 0)
+    {
+        dest[0] = '-';
+        return 1 + string_write_u64(dest + 1, (u64)0 - (u64)value);
+    }
+    return string_write_u64(dest, (u64)value);
+}
+
+function i64 string_write_hex(u8 *dest, u64 value, i32 min_digits)
+{
+    static const char digits[] = "0123456789abcdef";
+
+    assert(min_digits <= STRING_NUMBER_MAX_SIZE);
+
+    i64 count = (64 - count_leading_zeros_u64(value | 1) + 3) / 4;
+    count = Max(count, Clamp(min_digits, 1, STRING_NUMBER_MAX_SIZE));
+
+    for (i64 i = count - 1; i >= 0; i -= 1)
+    {
+        dest[i] = digits[value & 0xf];
+        value >>= 4;
+    }
+
+    return count;
+}
+
+//
+// NOTE(nick): Schubfach (Giulietti, "The Schubfach way to render doubles"). Gives the fewest
+// digits that read back as the same double, and of those the closest to its exact value.
+// It needs 10^-k to 126 bits, which is the Eisel-Lemire table from the parser shifted down.
+//
+
+force_inline function u64 string__schubfach_round_odd(u64 g1, u64 g0, u64 cp)
+{
+    // NOTE(nick): (g * cp) >> 127, with a 1 in the lowest bit if anything nonzero got shifted out
+    u64 x1 = 0;
+    u64 y1 = 0;
+    multiply_u64_wide(g0, cp, &x1);
+    u64 y0 = multiply_u64_wide(g1, cp, &y1);
+    u64 z = (y0 >> 1) + x1;
+    u64 mask_63 = (1ull << 63) - 1;
+    return (y1 + (z >> 63)) | (((z & mask_63) + mask_63) >> 63);
+}
+
+// NOTE(nick): value has to be finite and nonzero, the sign is ignored. Returns the digits,
+// value reads back from result * 10^exponent.
+function u64 string__schubfach(f64 value, i32 *exponent)
+{
+    u64 bits;
+    MemoryCopy(&bits, &value, sizeof(bits));
+
+    u64 mantissa = bits & ((1ull << 52) - 1);
+    i32 biased_exponent = (i32)((bits >> 52) & 0x7ff);
+
+    // NOTE(nick): value is c * 2^q
+    u64 c = mantissa;
+    i32 q = -1074;
+    if (biased_exponent)
+    {
+        c = mantissa | (1ull << 52);
+        q = biased_exponent - 1075;
+
+        // NOTE(nick): integers below 2^53 are their own answer
+        if (q < 0 && q > -53 && ((c >> -q) << -q) == c)
+        {
+            *exponent = 0;
+            return c >> -q;
+        }
+    }
+
+    // NOTE(nick): from here on everything is in quarters of the gap between doubles. What reads
+    // back as value is [cbl, cbr] when c is even, and the open interval when it's odd.
+    u64 out = c & 1;
+    u64 cb = c << 2;
+    u64 cbr = cb + 2;
+    u64 cbl = cb - 2;
+
+    // NOTE(nick): k = floor(log10(2^q)), the gap below a power of two is half as wide
+    i32 k = (i32)(((i64)q * 661971961083ll) >> 41);
+    if (c == (1ull << 52) && q != -1074)
+    {
+        cbl = cb - 1;
+        k = (i32)(((i64)q * 661971961083ll - 274743187321ll) >> 41);
+    }
+    i32 h = q + (i32)(((i64)-k * 913124641741ll) >> 38) + 2;
+
+    // NOTE(nick): g = floor(10^-k * 2^r) + 1 to 126 bits, split into two 63 bit halves
+    u64 const *power = string__powers_of_10_u128[-k - STRING__POWERS_OF_10_MIN_EXPONENT];
+    u64 g_hi = power[0] >> 2;
+    u64 g_lo = ((power[0] << 62) | (power[1] >> 2)) + 1;
+    if (g_lo == 0) g_hi += 1;
+    u64 g1 = (g_hi << 1) | (g_lo >> 63);
+    u64 g0 = g_lo & ((1ull << 63) - 1);
+
+    u64 vb = string__schubfach_round_odd(g1, g0, cb << h);
+    u64 vbl = string__schubfach_round_odd(g1, g0, cbl << h);
+    u64 vbr = string__schubfach_round_odd(g1, g0, cbr << h);
+
+    *exponent = k;
+
+    // NOTE(nick): try one digit less first, if exactly one of the two neighbours fits take it.
+    // Small subnormals can land on a single digit here, so this has to run for s >= 10 too.
+    u64 s = vb >> 2;
+    if (s >= 10)
+    {
+        u64 sp10 = 10 * (s / 10);
+        u64 tp10 = sp10 + 10;
+        b32 upin = vbl + out <= sp10 << 2;
+        b32 wpin = (tp10 << 2) + out <= vbr;
+        if (upin != wpin)
+        {
+            return upin ? sp10 : tp10;
+        }
+    }
+
+    u64 t = s + 1;
+    b32 uin = vbl + out <= s << 2;
+    b32 win = (t << 2) + out <= vbr;
+    if (uin != win)
+    {
+        return uin ? s : t;
+    }
+
+    // NOTE(nick): both fit, take the closer one or the even one on a tie
+    i64 cmp = (i64)(vb - ((s + t) << 1));
+    return (cmp < 0 || (cmp == 0 && (s & 1) == 0)) ? s : t;
+}
+
+function i64 string_write_f64(u8 *dest, f64 value)
+{
+    u64 bits;
+    MemoryCopy(&bits, &value, sizeof(bits));
+
+    u8 *at = dest;
+    if (bits >> 63) *at++ = '-';
+
+    u64 exponent_bits = (bits >> 52) & 0x7ff;
+    u64 mantissa = bits & ((1ull << 52) - 1);
+
+    if (exponent_bits == 0x7ff)
+    {
+        if (mantissa)
+        {
+            MemoryCopy(dest, "nan", 3);
+            return 3;
+        }
+        MemoryCopy(at, "inf", 3);
+        return (at - dest) + 3;
+    }
+
+    if (exponent_bits == 0 && mantissa == 0)
+    {
+        MemoryCopy(at, "0.0", 3);
+        return (at - dest) + 3;
+    }
+
+    i32 k = 0;
+    u64 digits = string__schubfach(value, &k);
+    while (digits % 10 == 0)
+    {
+        digits /= 10;
+        k += 1;
+    }
+    i64 count = string_write_u64(at, digits);
+
+    // NOTE(nick): digits are at[0..count) * 10^k, lay them out like JavaScript does
+    i64 kk = count + k;
+    if (k >= 0 && kk <= 21)
+    {
+        // 1234e7 -> 12340000000.0
+        for (i64 i = count; i < kk; i += 1) at[i] = '0';
+        at[kk + 0] = '.';
+        at[kk + 1] = '0';
+        at += kk + 2;
+    }
+    else if (kk > 0 && kk <= 21)
+    {
+        // 1234e-2 -> 12.34
+        MemoryMove(at + kk + 1, at + kk, count - kk);
+        at[kk] = '.';
+        at += count + 1;
+    }
+    else if (kk > -6 && kk <= 0)
+    {
+        // 1234e-6 -> 0.001234
+        i64 offset = 2 - kk;
+        MemoryMove(at + offset, at, count);
+        at[0] = '0';
+        at[1] = '.';
+        for (i64 i = 2; i < offset; i += 1) at[i] = '0';
+        at += count + offset;
+    }
+    else
+    {
+        // 1234e30 -> 1.234e33
+        if (count > 1)
+        {
+            MemoryMove(at + 2, at + 1, count - 1);
+            at[1] = '.';
+            at += count + 1;
+        }
+        else
+        {
+            at += 1;
+        }
+
+        *at++ = 'e';
+        at += string_write_i64(at, kk - 1);
+    }
+
+    return at - dest;
+}
+
+function String string_from_u64(Arena *arena, u64 value)
+{
+    u8 buffer[STRING_NUMBER_MAX_SIZE];
+    return string_push(arena, Str8(buffer, string_write_u64(buffer, value)));
+}
+
+function String string_from_i64(Arena *arena, i64 value)
+{
+    u8 buffer[STRING_NUMBER_MAX_SIZE];
+    return string_push(arena, Str8(buffer, string_write_i64(buffer, value)));
+}
+
+function String string_from_hex(Arena *arena, u64 value, i32 min_digits)
+{
+    u8 buffer[STRING_NUMBER_MAX_SIZE];
+    return string_push(arena, Str8(buffer, string_write_hex(buffer, value, min_digits)));
+}
+
+function String string_from_f64(Arena *arena, f64 value)
+{
+    u8 buffer[STRING_NUMBER_MAX_SIZE];
+    return string_push(arena, Str8(buffer, string_write_f64(buffer, value)));
+}
+
+//
+// Formatting
+//
+
+function Fmt_Arg fmt_i64(i64 value)
+{
+    Fmt_Arg result = {0};
+    result.kind = FmtKind_I64;
+    result.i = value;
+    return result;
+}
+
+function Fmt_Arg fmt_u64(u64 value)
+{
+    Fmt_Arg result = {0};
+    result.kind = FmtKind_U64;
+    result.u = value;
+    return result;
+}
+
+function Fmt_Arg fmt_hex(u64 value, i32 min_digits)
+{
+    Fmt_Arg result = {0};
+    result.kind = FmtKind_Hex;
+    result.u = value;
+    result.min_digits = min_digits;
+    return result;
+}
+
+function Fmt_Arg fmt_f64(f64 value)
+{
+    Fmt_Arg result = {0};
+    result.kind = FmtKind_F64;
+    result.f = value;
+    return result;
+}
+
+function Fmt_Arg fmt_str(String value)
+{
+    Fmt_Arg result = {0};
+    result.kind = FmtKind_String;
+    result.string = value;
+    return result;
+}
+
+function Fmt_Arg fmt_cstr(const char *value)
+{
+    return fmt_str(string_from_cstr(value));
+}
+
+function void sb_push_arg(Arena *arena, String_Builder *sb, Fmt_Arg arg)
+{
+    switch (arg.kind)
+    {
+        case FmtKind_I64:    sb_push_i64(arena, sb, arg.i); break;
+        case FmtKind_U64:    sb_push_u64(arena, sb, arg.u); break;
+        case FmtKind_Hex:    sb_push_hex(arena, sb, arg.u, arg.min_digits); break;
+        case FmtKind_F64:    sb_push_f64(arena, sb, arg.f, -1); break;
+        case FmtKind_String: sb_push(arena, sb, arg.string); break;
+    }
+}
+
+function void sb_format_args(Arena *arena, String_Builder *sb, String fmt, Fmt_Args args)
+{
+    i64 arg_index = 0;
+    i64 at = 0;
+    for (;;)
+    {
+        // NOTE(nick): format strings are short, a plain loop beats setting up a vector scan
+        i64 index = at;
+        while (index < fmt.count && fmt.data[index] != '{' && fmt.data[index] != '}') index += 1;
+
+        sb_push(arena, sb, Str8(fmt.data + at, index - at));
+        if (index >= fmt.count) break;
+
+        u8 c = fmt.data[index];
+        u8 next = index + 1 < fmt.count ? fmt.data[index + 1] : 0;
+        if (c == '{' && next == '}')
+        {
+            assert(arg_index < args.count);
+            if (arg_index < args.count)
+            {
+                sb_push_arg(arena, sb, args.data[arg_index]);
+                arg_index += 1;
+            }
+            at = index + 2;
+        }
+        else
+        {
+            // NOTE(nick): "{{" and "}}" are escapes, a lone brace is written as is
+            sb_push_byte(arena, sb, c);
+            at = index + (next == c ? 2 : 1);
+        }
+    }
+
+    assert(arg_index == args.count);
+}
+
+function String string_format_args(Arena *arena, String fmt, Fmt_Args args)
+{
+    String_Builder sb = sb_begin(arena, fmt.count + args.count * 16);
+    sb_format_args(arena, &sb, fmt, args);
+    return sb_end(&sb);
+}
+
+//
+// String Lists
+//
+
+function void string_list_push_node(String_List *list, String_Node *n)
+{
+    QueuePush(list->first, list->last, n);
+    list->node_count += 1;
+    list->total_size += n->string.count;
+}
+
+function void string_list_push(Arena *arena, String_List *list, String str)
+{
+    String_Node *n = PushArrayZero(arena, String_Node, 1);
+    n->string = str;
+    string_list_push_node(list, n);
+}
+
+function void string_concat_list(String_List *list, String_List *to_push)
+{
+    if (to_push->first)
+    {
+        list->node_count += to_push->node_count;
+        list->total_size += to_push->total_size;
+        if (list->last == 0)
+        {
+            *list = *to_push;
+        }
+        else
+        {
+            list->last->next = to_push->first;
+            list->last = to_push->last;
+        }
+    }
+    MemoryZero(to_push, sizeof(*to_push));
+}
+
+function String_List string_list_splits(Arena *arena, String string, int split_count, String *splits)
+{
+    String_List list = {0};
+
+    // NOTE(nick): only stop at bytes that can start one of the splits
+    u8 firsts_data[256];
+    b8 seen[256] = {0};
+    String firsts = Str8(firsts_data, 0);
+    for (int split_idx = 0; split_idx < split_count; split_idx += 1)
+    {
+        if (splits[split_idx].count > 0)
+        {
+            u8 c = splits[split_idx].data[0];
+            if (!seen[c])
+            {
+                seen[c] = true;
+                firsts.data[firsts.count] = c;
+                firsts.count += 1;
+            }
+        }
+    }
+
+    i64 split_start = 0;
+    i64 i = 0;
+    while (i < string.count)
+    {
+        i = string_find_any(string, firsts, i, 0);
+        if (i >= string.count) break;
+
+        b32 was_split = 0;
+        for (int split_idx = 0; split_idx < split_count; split_idx += 1)
+        {
+            String split = splits[split_idx];
+            if (split.count > 0 && i + split.count <= string.count && MemoryEquals(string.data + i, split.data, split.count))
+            {
+                String split_string = Str8(string.data + split_start, i - split_start);
+                string_list_push(arena, &list, split_string);
+                split_start = i + split.count;
+                i = split_start;
+                was_split = 1;
+                break;
+            }
+        }
+
+        if (!was_split) i += 1;
+    }
+
+    if (split_start < string.count)
+    {
+        String split_string = Str8(string.data + split_start, string.count - split_start);
+        string_list_push(arena, &list, split_string);
+    }
+
+    return list;
 }
 
 function String_List string_list_split(Arena *arena, String string, String split)
 {
-    return string_list_splits(arena, string, 1, &split);
+    return string_list_splits(arena, string, 1, &split);
+}
+
+function String string_list_joins(Arena *arena, String_List list, String_Join_Params join)
+{
+    u64 sep_count = 0;
+    if (list.node_count > 1)
+    {
+        sep_count = list.node_count - 1;
+    }
+    String result = {0};
+    result.count = (list.total_size + join.pre.count +
+                   sep_count*join.sep.count + join.post.count);
+    result.data = PushArray(arena, u8, result.count);
+    
+    if (result.data)
+    {
+        u8 *ptr = result.data;
+        MemoryCopy(ptr, join.pre.data, join.pre.count);
+        ptr += join.pre.count;
+        for (String_Node *node = list.first; node; node = node->next)
+        {
+            MemoryCopy(ptr, node->string.data, node->string.count);
+            ptr += node->string.count;
+            if (node != list.last) {
+                MemoryCopy(ptr, join.sep.data, join.sep.count);
+                ptr += join.sep.count;
+            }
+        }
+        MemoryCopy(ptr, join.post.data, join.post.count);
+        ptr += join.post.count;
+    }
+    return result;
+}
+
+function String string_list_join(Arena *arena, String_List list, String join)
+{
+    String_Join_Params params = {0};
+    params.sep = join;
+    return string_list_joins(arena, list, params);
+}
+
+function String string_list_print(Arena *arena, String_List *list, char *fmt, ...)
+{
+    String result = {0};
+
+    va_list args;
+    va_start(args, fmt);
+    result = string_printv(arena, fmt, args);
+    va_end(args);
+
+    string_list_push(arena, list, result);
+    return result;
+}
+
+function String string_list_to_string(Arena *arena, String_List *list)
+{
+    String_Join_Params params = {0};
+    return string_list_joins(arena, *list, params);
+}
+
+function String_List string_list_from_array(Arena *arena, String_Array array)
+{
+    String_List result = {0};
+    for (i64 index = 0; index < array.count; index += 1)
+    {
+        String it = array.data[index];
+        string_list_push(arena, &result, it);
+    }
+    return result;
+}
+
+//
+// String Arrays
+//
+
+function String_Array string_array_from_list(Arena *arena, String_List list)
+{
+    String_Array result = {0};
+    result.data = PushArrayZero(arena, String, list.node_count);
+    result.count = list.node_count;
+    result.capacity = list.node_count;
+
+    i64 index = 0;
+    for (String_Node *it = list.first; it != NULL; it = it->next)
+    {
+        String str = string_push(arena, it->string);
+        result.data[index] = str;
+        index += 1;
+    }
+
+    return result;
+}
+
+function String_Array string_splits(Arena *arena, String string, int split_count, String *splits)
+{
+    String_Array result = {0};
+    result = string_array_from_list(arena, string_list_splits(arena, string, split_count, splits));
+    return result;
+}
+
+function String_Array string_split(Arena *arena, String string, String split)
+{
+    String_Array result = {0};
+    result = string_array_from_list(arena, string_list_splits(arena, string, 1, &split));
+    return result;
+}
+
+function String string_join(Arena *arena, String_Array array, String join)
+{
+    String_Join_Params params = {0};
+    params.sep = join;
+    String_List list = string_list_from_array(arena, array);
+    return string_list_joins(temp_arena(), list, params);
+}
+
+//
+// NOTE(nick): MSD radix sort. Each level buckets by the byte at depth, strings that end
+// there go in their own bucket ahead of the rest. The bytes are read once into keys so the
+// scatter doesn't chase every string pointer again. The largest bucket is handled by the
+// loop instead of recursing, which keeps the stack depth logarithmic no matter how long
+// the shared prefixes get. Small buckets finish with an insertion sort.
+//
+
+#define STRING__SORT_INSERTION_COUNT 32
+
+function void string__sort_insertion(String *data, i64 count, i64 depth)
+{
+    for (i64 i = 1; i < count; i += 1)
+    {
+        String it = data[i];
+
+        i64 j = i;
+        for (; j > 0; j -= 1)
+        {
+            String prev = data[j - 1];
+            i64 n = Min(prev.count, it.count) - depth;
+            i64 index = string__mismatch(prev.data + depth, it.data + depth, n, false);
+
+            b32 greater = index < n ? prev.data[depth + index] > it.data[depth + index] : prev.count > it.count;
+            if (!greater) break;
+
+            data[j] = prev;
+        }
+
+        data[j] = it;
+    }
+}
+
+function void string__sort_radix(String *data, String *temp, u16 *keys, i64 count, i64 depth)
+{
+    while (count > STRING__SORT_INSERTION_COUNT)
+    {
+        i64 offsets[257] = {0};
+        for (i64 i = 0; i < count; i += 1)
+        {
+            String it = data[i];
+            u16 key = depth < it.count ? it.data[depth] + 1 : 0;
+            keys[i] = key;
+            offsets[key] += 1;
+        }
+
+        // NOTE(nick): everyone shares this byte, go one deeper without moving anything
+        if (offsets[keys[0]] == count)
+        {
+            if (keys[0] == 0) return;
+            depth += 1;
+            continue;
+        }
+
+        i64 sum = 0;
+        for (u32 key = 0; key < 257; key += 1)
+        {
+            i64 n = offsets[key];
+            offsets[key] = sum;
+            sum += n;
+        }
+
+        for (i64 i = 0; i < count; i += 1)
+        {
+            temp[offsets[keys[i]]++] = data[i];
+        }
+        MemoryCopy(data, temp, sizeof(String) * count);
+
+        // NOTE(nick): offsets are bucket ends now. Bucket 0 ended at depth, so it's all equal.
+        i64 largest_start = 0;
+        i64 largest_count = 0;
+        i64 start = offsets[0];
+        for (u32 key = 1; key < 257; key += 1)
+        {
+            i64 n = offsets[key] - start;
+            if (n > largest_count)
+            {
+                if (largest_count > 1)
+                {
+                    string__sort_radix(data + largest_start, temp + largest_start, keys + largest_start, largest_count, depth + 1);
+                }
+                largest_start = start;
+                largest_count = n;
+            }
+            else if (n > 1)
+            {
+                string__sort_radix(data + start, temp + start, keys + start, n, depth + 1);
+            }
+            start = offsets[key];
+        }
+
+        data  += largest_start;
+        temp  += largest_start;
+        keys  += largest_start;
+        count  = largest_count;
+        depth += 1;
+    }
+
+    string__sort_insertion(data, count, depth);
+}
+
+function void string_array_sort(String_Array *array)
+{
+    if (array->count < 2) return;
+
+    M_Temp scratch = GetScratch(0, 0);
+    String *temp = PushArrayNoZero(scratch.arena, String, array->count);
+    u16 *keys = PushArrayNoZero(scratch.arena, u16, array->count);
+
+    string__sort_radix(array->data, temp, keys, array->count, 0);
+
+    ReleaseScratch(scratch);
+}
+
+//
+// Multi-Pattern Matching
+//
+
+//
+// NOTE(nick): Aho-Corasick compiled down to a full DFA over byte classes, so scanning
+// is one table lookup per input byte no matter how many patterns there are.
+// Only MatchFlag_IgnoreCase is supported (ASCII, same as string_match).
+//
+
+function String_Matcher *string_matcher_make(Arena *arena, String_Array patterns, Match_Flags flags)
+{
+    String_Matcher *result = PushStruct(arena, String_Matcher);
+    result->flags = flags;
+    result->pattern_count = patterns.count;
+    result->pattern_lengths = PushArray(arena, i64, patterns.count);
+    result->next_same_pattern = PushArrayNoZero(arena, u32, patterns.count);
+
+    b32 fold = (flags & MatchFlag_IgnoreCase) != 0;
+
+    // NOTE(nick): byte classes
+    u32 class_count = 1;
+    u64 max_state_count = 1;
+    for (i64 i = 0; i < patterns.count; i += 1)
+    {
+        String it = patterns.data[i];
+        result->pattern_lengths[i] = it.count;
+        max_state_count += it.count;
+
+        for (i64 j = 0; j < it.count; j += 1)
+        {
+            u8 c = fold ? char_to_lower(it.data[j]) : it.data[j];
+
+            // NOTE(nick): a 257th class can only come from the one byte left without a class
+            if (!result->classes[c] && class_count < 256)
+            {
+                result->classes[c] = class_count;
+                class_count += 1;
+            }
+        }
+    }
+
+    if (fold)
+    {
+        for (u32 c = 'A'; c <= 'Z'; c += 1)
+        {
+            result->classes[c] = result->classes[char_to_lower(c)];
+        }
+    }
+
+    result->class_count = class_count;
+
+    // NOTE(nick): trie, 0 doubles as "no edge" since nothing points back at the root
+    u32 *next = PushArray(arena, u32, max_state_count * class_count);
+    u32 *pattern_from_state = PushArrayNoZero(arena, u32, max_state_count);
+    u32 *next_match_state = PushArrayNoZero(arena, u32, max_state_count);
+    pattern_from_state[0] = U32_MAX;
+    next_match_state[0] = U32_MAX;
+
+    u32 state_count = 1;
+    for (i64 i = 0; i < patterns.count; i += 1)
+    {
+        String it = patterns.data[i];
+        result->next_same_pattern[i] = U32_MAX;
+        if (it.count == 0) continue;
+
+        u32 state = 0;
+        for (i64 j = 0; j < it.count; j += 1)
+        {
+            u32 *edge = &next[state * class_count + result->classes[it.data[j]]];
+            if (!*edge)
+            {
+                *edge = state_count;
+                pattern_from_state[state_count] = U32_MAX;
+                next_match_state[state_count] = U32_MAX;
+                state_count += 1;
+            }
+            state = *edge;
+        }
+
+        // NOTE(nick): duplicates (or patterns equal once folded) chain off the first one
+        if (pattern_from_state[state] == U32_MAX)
+        {
+            pattern_from_state[state] = (u32)i;
+        }
+        else
+        {
+            u32 last = pattern_from_state[state];
+            while (result->next_same_pattern[last] != U32_MAX) last = result->next_same_pattern[last];
+            result->next_same_pattern[last] = (u32)i;
+        }
+
+        u8 c = it.data[0];
+        u8 first[2] = {c, c};
+        if (fold)
+        {
+            first[0] = char_to_lower(c);
+            first[1] = char_to_upper(first[0]);
+        }
+        for (u32 k = 0; k < 2; k += 1)
+        {
+            String bytes = Str8(result->first_bytes_data, result->first_bytes.count);
+            if (string_find_byte(bytes, first[k], 0, 0) == bytes.count)
+            {
+                result->first_bytes_data[result->first_bytes.count] = first[k];
+                result->first_bytes.count += 1;
+            }
+        }
+    }
+    result->first_bytes.data = result->first_bytes_data;
+
+    // NOTE(nick): breadth-first pass to fill in failure transitions
+    M_Temp scratch = GetScratch(&arena, 1);
+    u32 *fail  = PushArray(scratch.arena, u32, state_count);
+    u32 *queue = PushArrayNoZero(scratch.arena, u32, state_count);
+    u32 queue_read = 0;
+    u32 queue_write = 0;
+
+    for (u32 c = 0; c < class_count; c += 1)
+    {
+        u32 child = next[c];
+        if (child)
+        {
+            fail[child] = 0;
+            queue[queue_write++] = child;
+        }
+    }
+
+    while (queue_read < queue_write)
+    {
+        u32 state = queue[queue_read++];
+        u32 f = fail[state];
+
+        next_match_state[state] = pattern_from_state[f] != U32_MAX ? f : next_match_state[f];
+
+        for (u32 c = 0; c < class_count; c += 1)
+        {
+            u32 *edge = &next[state * class_count + c];
+            if (*edge)
+            {
+                fail[*edge] = next[f * class_count + c];
+                queue[queue_write++] = *edge;
+            }
+            else
+            {
+                *edge = next[f * class_count + c];
+            }
+        }
+    }
+
+    ReleaseScratch(scratch);
+
+    // NOTE(nick): premultiply and tag the transitions so the scan loop is a single lookup
+    for (u64 i = 0; i < (u64)state_count * class_count; i += 1)
+    {
+        u32 target = next[i];
+        next[i] = target * class_count;
+        if (pattern_from_state[target] != U32_MAX || next_match_state[target] != U32_MAX)
+        {
+            next[i] |= STRING_MATCHER_OUTPUT_BIT;
+        }
+    }
+
+    result->state_count = state_count;
+    result->next = next;
+    result->pattern_from_state = pattern_from_state;
+    result->next_match_state = next_match_state;
+    return result;
+}
+
+function String_Match_Iter string_matcher_iter(String_Matcher *matcher, String text)
+{
+    String_Match_Iter result = {0};
+    result.matcher = matcher;
+    result.text = text;
+    result.pending = U32_MAX;
+    result.pending_pattern = U32_MAX;
+    return result;
+}
+
+function b32 string_matcher_next(String_Match_Iter *it, String_Match *match)
+{
+    String_Matcher *m = it->matcher;
+
+    // NOTE(nick): the compare chain in string_find_any is only worth it for a few bytes
+    b32 can_skip = m->first_bytes.count <= 8;
+
+    while (true)
+    {
+        if (it->pending_pattern != U32_MAX)
+        {
+            u32 pattern = it->pending_pattern;
+            it->pending_pattern = m->next_same_pattern[pattern];
+
+            match->pattern = pattern;
+            match->index = it->at - m->pattern_lengths[pattern];
+            return true;
+        }
+
+        if (it->pending != U32_MAX)
+        {
+            u32 state = it->pending;
+            it->pending = m->next_match_state[state];
+
+            u32 pattern = m->pattern_from_state[state];
+            it->pending_pattern = m->next_same_pattern[pattern];
+
+            match->pattern = pattern;
+            match->index = it->at - m->pattern_lengths[pattern];
+            return true;
+        }
+
+        if (it->state == 0 && can_skip)
+        {
+            it->at = string_find_any(it->text, m->first_bytes, it->at, 0);
+        }
+
+        if (it->at >= it->text.count)
+        {
+            return false;
+        }
+
+        u32 *next = m->next;
+        u8 *classes = m->classes;
+        u8 *at = it->text.data + it->at;
+        u8 *end = it->text.data + it->text.count;
+        u32 row = it->state;
+
+        // NOTE(nick): only stop when there is something to report, or to skip ahead again
+        if (can_skip)
+        {
+            do
+            {
+                row = next[row + classes[*at++]];
+            }
+            while (at < end && row != 0 && !(row & STRING_MATCHER_OUTPUT_BIT));
+        }
+        else
+        {
+            do
+            {
+                row = next[row + classes[*at++]];
+            }
+            while (at < end && !(row & STRING_MATCHER_OUTPUT_BIT));
+        }
+
+        b32 has_output = (row & STRING_MATCHER_OUTPUT_BIT) != 0;
+        row &= ~STRING_MATCHER_OUTPUT_BIT;
+
+        it->state = row;
+        it->at = at - it->text.data;
+
+        if (has_output)
+        {
+            u32 state = row / m->class_count;
+            it->pending = m->pattern_from_state[state] != U32_MAX ? state : m->next_match_state[state];
+        }
+    }
+}
+
+function String_Match_Array string_matcher_find_all(Arena *arena, String_Matcher *matcher, String text)
+{
+    String_Match_Array result = {0};
+
+    String_Match_Iter it = string_matcher_iter(matcher, text);
+    String_Match match;
+    while (string_matcher_next(&it, &match))
+    {
+        // NOTE(nick): not arena_realloc_ptr, that pushes unaligned and the matches hold i64s
+        if (result.count >= result.capacity)
+        {
+            i64 next_capacity = Max(result.capacity * 2, 16);
+            String_Match *data = PushArrayNoZero(arena, String_Match, next_capacity);
+            if (result.count > 0) MemoryCopy(data, result.data, result.count * sizeof(String_Match));
+            result.data = data;
+            result.capacity = next_capacity;
+        }
+
+        result.data[result.count] = match;
+        result.count += 1;
+    }
+
+    return result;
+}
+
+//
+// Misc Helpers
+//
+
+function String string_concat2(Arena *arena, String a, String b) {
+    u64 count = a.count + b.count;
+    u8 *data = PushArray(arena, u8, count);
+
+    if (data) {
+        MemoryCopy(data + 0      , a.data, a.count);
+        MemoryCopy(data + a.count, b.data, b.count);
+    }
+
+    return Str8(data, count);
+}
+
+function String string_concat3(Arena *arena, String a, String b, String c) {
+    u64 count = a.count + b.count + c.count;
+    u8 *data = PushArray(arena, u8, count);
+
+    if (data) {
+        MemoryCopy(data + 0                , a.data, a.count);
+        MemoryCopy(data + a.count          , b.data, b.count);
+        MemoryCopy(data + a.count + b.count, c.data, c.count);
+    }
+
+    return Str8(data, count);
+}
+
+function String string_concat4(Arena *arena, String a, String b, String c, String d) {
+    u64 count = a.count + b.count + c.count + d.count;
+    u8 *data = PushArray(arena, u8, count);
+
+    if (data) {
+        MemoryCopy(data + 0,                           a.data, a.count);
+        MemoryCopy(data + a.count,                     b.data, b.count);
+        MemoryCopy(data + a.count + b.count,           c.data, c.count);
+        MemoryCopy(data + a.count + b.count + c.count, d.data, d.count);
+    }
+
+    return Str8(data, count);
+}
+
+function String string_insert(Arena *arena, String text, i64 index, String insert, i64 replace_count)
+{
+    String pre = string_slice(text, 0, index);
+    String post = string_slice(text, index+replace_count, text.count);
+    return string_concat3(arena, pre, insert, post);
+}
+
+function String string_concat_array(Arena *arena, String *array, u32 count)
+{
+    String result = {0};
+    
+    u64 total_size_in_bytes = 0;
+    for (u32 i = 0; i < count; i += 1)
+    {
+        total_size_in_bytes += array[i].count;
+    }
+
+    u8 *data = PushArray(arena, u8, total_size_in_bytes);
+    if (data)
+    {
+        u8 *at = data;
+        for (u32 i = 0; i < count; i += 1)
+        {
+            String it = array[i];
+            MemoryCopy(at, it.data, it.count);
+            at += it.count;
+        }
+        result = string_make(data, at - data);
+    }
+
+    return result;
+}
+
+function String string_chop_last_period(String string)
+{
+    i64 pos = string_find_byte(string, '.', 0, MatchFlag_FindLast);
+    if (pos < string.count)
+    {
+        string.count = pos;
+    }
+    return string;
+}
+
+function String string_skip_last_period(String string)
+{
+    i64 pos = string_find_byte(string, '.', 0, MatchFlag_FindLast);
+    if (pos < string.count)
+    {
+        string.data += pos+1;
+        string.count -= pos+1;
+    }
+    return string;
+}
+
+function String string_chop_last_slash(String string)
+{
+    i64 pos = string_find_any(string, S("/\\"), 0, MatchFlag_FindLast);
+    if (pos < string.count)
+    {
+        string.count = pos;
+    }
+    return string;
+}
+
+function String string_skip_last_slash(String string)
+{
+    i64 pos = string_find_any(string, S("/\\"), 0, MatchFlag_FindLast);
+    if (pos < string.count)
+    {
+        string.data += pos+1;
+        string.count -= pos+1;
+    }
+    return string;
+}
+
+function String string_trim_whitespace(String str)
+{
+    String result = string_eat_whitespace(str);
+
+    i64 last = string_find_not_whitespace(result, 0, MatchFlag_FindLast);
+    result.count = last < result.count ? last + 1 : 0;
+    return result;
+}
+
+function String string_eat_whitespace(String str)
+{
+    i64 first = string_find_not_whitespace(str, 0, 0);
+    return string_slice(str, first, str.count);
+}
+
+function String string_remove(Arena *arena, String str, String remove)
+{
+    return string_replace(arena, str, remove, S(""), 0);
+}
+
+function String string_strip(Arena *arena, String str, String chars)
+{
+    if (chars.count == 0) return str;
+
+    String__Scanner it;
+    string__scanner_any(&it, chars);
+
+    i64 index = string__scan(str, 0, 0, &it);
+    if (index >= str.count) return str;
+
+    String_Builder sb = sb_begin(arena, str.count);
+
+    i64 at = 0;
+    while (index < str.count)
+    {
+        sb_push(arena, &sb, Str8(str.data + at, index - at));
+        at = index + 1;
+        index = string__scan(str, at, 0, &it);
+    }
+    sb_push(arena, &sb, Str8(str.data + at, str.count - at));
+
+    return sb_end(&sb);
+}
+
+function u64 string_hash(String str)
+{
+    // djb2
+    u64 result = 5381;
+    for (u64 i = 0; i < str.count; i += 1)
+    {
+        u8 c = str.data[i];
+        result = ((result << 5) + result) + c;
+    }
+    return result;
+}
+
+// NOTE(nick): ASCII lowercase 8 bytes at once, bytes >= 0x80 are left alone
+force_inline function u64 string__lower_u64(u64 x)
+{
+    u64 low_bits = x & 0x7f7f7f7f7f7f7f7full;
+    u64 above_z = low_bits + 0x2525252525252525ull; // high bit set if > 'Z'
+    u64 at_least_a = low_bits + 0x3f3f3f3f3f3f3f3full; // high bit set if >= 'A'
+    u64 is_upper = (at_least_a ^ above_z) & ~x & 0x8080808080808080ull;
+    return x | (is_upper >> 2);
+}
+
+function u64 string_hash_ignore_case(String str)
+{
+    // NOTE(nick): strings that string_match with MatchFlag_IgnoreCase hash the same
+    u64 result = 0x9e3779b97f4a7c15ull ^ (u64)str.count;
+
+    i64 i = 0;
+    for (; i + 8 <= str.count; i += 8)
+    {
+        u64 chunk;
+        MemoryCopy(&chunk, str.data + i, sizeof(chunk));
+        result = (result ^ string__lower_u64(chunk)) * 0xff51afd7ed558ccdull;
+        result ^= result >> 32;
+    }
+
+    if (i < str.count)
+    {
+        u64 chunk = 0;
+        MemoryCopy(&chunk, str.data + i, str.count - i);
+        result = (result ^ string__lower_u64(chunk)) * 0xff51afd7ed558ccdull;
+        result ^= result >> 32;
+    }
+
+    result *= 0xc4ceb9fe1a85ec53ull;
+    result ^= result >> 29;
+    return result;
+}
+
+function i32 string_compare(String a, String b, Match_Flags flags)
+{
+    b32 fold = (flags & MatchFlag_IgnoreCase) != 0;
+    i64 count = Min(a.count, b.count);
+    i64 index = string__mismatch(a.data, b.data, count, fold);
+
+    if (index < count)
+    {
+        u8 x = fold ? char_to_lower(a.data[index]) : a.data[index];
+        u8 y = fold ? char_to_lower(b.data[index]) : b.data[index];
+        return x < y ? -1 : 1;
+    }
+
+    return a.count < b.count ? -1 : (a.count > b.count ? 1 : 0);
+}
+
+function void string_to_lower(String *str)
+{
+    i64 i = 0;
+    for (; i + SIMD_WIDTH <= str->count; i += SIMD_WIDTH)
+    {
+        simd__store(str->data + i, simd__to_lower(simd__load(str->data + i)));
+    }
+    for (; i < str->count; i += 1)
+    {
+        str->data[i] = char_to_lower(str->data[i]);
+    }
+}
+
+function void string_to_upper(String *str)
+{
+    i64 i = 0;
+    for (; i + SIMD_WIDTH <= str->count; i += SIMD_WIDTH)
+    {
+        simd__store(str->data + i, simd__to_upper(simd__load(str->data + i)));
+    }
+    for (; i < str->count; i += 1)
+    {
+        str->data[i] = char_to_upper(str->data[i]);
+    }
+}
+
+function String string_lower(Arena *arena, String str)
+{
+    String result = string_push(arena, str);
+    string_to_lower(&result);
+    return result;
+}
+
+function String string_upper(Arena *arena, String str)
+{
+    String result = string_push(arena, str);
+    string_to_upper(&result);
+    return result;
+}
+
+//
+// String Builder
+//
+
+function String_Builder sb_begin(Arena *arena, i64 capacity)
+{
+    String_Builder result = {0};
+    result.arena = arena;
+    sb_reserve(&result, capacity);
+    return result;
+}
+
+function void sb_reserve(String_Builder *sb, i64 count)
+{
+    // NOTE(nick): always keep room for the null terminator
+    i64 needed = sb->count + count + 1;
+    if (sb->arena && needed > sb->capacity)
+    {
+        i64 capacity = Max(needed, sb->capacity * 2);
+        capacity = Max(capacity, 64);
+
+        // NOTE(nick): this grows in place as long as nothing else was pushed onto the arena
+        u8 *data = (u8 *)arena_realloc_ptr(sb->arena, capacity, sb->data, sb->capacity);
+        if (data)
+        {
+            sb->data = data;
+            sb->capacity = capacity;
+        }
+    }
+}
+
+function String sb_end(String_Builder *sb)
+{
+    String result = sb_to_string(sb->arena, *sb);
+
+    // NOTE(nick): give back whatever we over-reserved, but only while the buffer is still
+    // the top of the arena. Otherwise it's left as is, moving it would copy the whole string.
+    if (sb->data && sb->count + 1 < sb->capacity)
+    {
+        Arena *current = sb->arena->current;
+        if (sb->data + sb->capacity == current->data + current->pos)
+        {
+            arena_pop_to(sb->arena, arena_pos(sb->arena) - (sb->capacity - (sb->count + 1)));
+        }
+    }
+
+    sb->data = NULL;
+    sb->count = 0;
+    sb->capacity = 0;
+    return result;
+}
+
+function void sb_push(Arena *arena, String_Builder *sb, String str)
+{
+    if (sb->arena)
+    {
+        if (str.count <= 0) return;
+
+        sb_reserve(sb, str.count);
+        if (sb->count + str.count < sb->capacity)
+        {
+            MemoryCopy(sb->data + sb->count, str.data, str.count);
+            sb->count += str.count;
+        }
+    }
+    else
+    {
+        string_list_push(arena, &sb->list, str);
+    }
+}
+
+function void sb_push_byte(Arena *arena, String_Builder *sb, u8 byte)
+{
+    if (sb->arena)
+    {
+        sb_reserve(sb, 1);
+        if (sb->count + 1 < sb->capacity)
+        {
+            sb->data[sb->count] = byte;
+            sb->count += 1;
+        }
+    }
+    else
+    {
+        sb_push(arena, sb, string_push(arena, Str8(&byte, 1)));
+    }
+}
+
+function void sb_push_u64(Arena *arena, String_Builder *sb, u64 value)
+{
+    if (sb->arena)
+    {
+        sb_reserve(sb, STRING_NUMBER_MAX_SIZE);
+        if (sb->count + STRING_NUMBER_MAX_SIZE < sb->capacity)
+        {
+            sb->count += string_write_u64(sb->data + sb->count, value);
+        }
+    }
+    else
+    {
+        sb_push(arena, sb, string_from_u64(arena, value));
+    }
+}
+
+function void sb_push_i64(Arena *arena, String_Builder *sb, i64 value)
+{
+    if (sb->arena)
+    {
+        sb_reserve(sb, STRING_NUMBER_MAX_SIZE);
+        if (sb->count + STRING_NUMBER_MAX_SIZE < sb->capacity)
+        {
+            sb->count += string_write_i64(sb->data + sb->count, value);
+        }
+    }
+    else
+    {
+        sb_push(arena, sb, string_from_i64(arena, value));
+    }
+}
+
+function void sb_push_f64(Arena *arena, String_Builder *sb, f64 value, i32 precision)
+{
+    // NOTE(nick): a negative precision gives the shortest digits that round-trip
+    if (precision >= 0)
+    {
+        sb_print(arena, sb, "%.*f", precision, value);
+    }
+    else if (sb->arena)
+    {
+        sb_reserve(sb, STRING_NUMBER_MAX_SIZE);
+        if (sb->count + STRING_NUMBER_MAX_SIZE < sb->capacity)
+        {
+            sb->count += string_write_f64(sb->data + sb->count, value);
+        }
+    }
+    else
+    {
+        sb_push(arena, sb, string_from_f64(arena, value));
+    }
+}
+
+function void sb_push_hex(Arena *arena, String_Builder *sb, u64 value, i32 min_digits)
+{
+    if (sb->arena)
+    {
+        sb_reserve(sb, STRING_NUMBER_MAX_SIZE);
+        if (sb->count + STRING_NUMBER_MAX_SIZE < sb->capacity)
+        {
+            sb->count += string_write_hex(sb->data + sb->count, value, min_digits);
+        }
+    }
+    else
+    {
+        sb_push(arena, sb, string_from_hex(arena, value, min_digits));
+    }
+}
+
+function void sb_print(Arena *arena, String_Builder *sb, const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+
+    if (sb->arena)
+    {
+        // NOTE(nick): print straight into the buffer and only print again if it didn't fit
+        va_list args2;
+        va_copy(args2, args);
+
+        sb_reserve(sb, 64);
+        i64 available = sb->capacity - sb->count;
+        i64 size = PrintToBuffer((char *)sb->data + sb->count, (int)available, fmt, args);
+        if (size >= available)
+        {
+            sb_reserve(sb, size);
+            available = sb->capacity - sb->count;
+            if (size < available)
+            {
+                PrintToBuffer((char *)sb->data + sb->count, (int)available, fmt, args2);
+            }
+        }
+        if (size > 0 && size < available)
+        {
+            sb->count += size;
+        }
+
+        va_end(args2);
+    }
+    else
+    {
+        String str = string_printv(arena, fmt, args);
+        string_list_push(arena, &sb->list, str);
+    }
+
+    va_end(args);
+}
+
+function String sb_to_string(Arena *arena, String_Builder sb)
+{
+    if (sb.arena)
+    {
+        String result = {0};
+        if (sb.data)
+        {
+            // NOTE(nick): sb_reserve always leaves room for this
+            sb.data[sb.count] = '\0';
+            result = Str8(sb.data, sb.count);
+        }
+        return result;
+    }
+
+    return string_list_to_string(arena, &sb.list);
+}
+
+function void sb_reset(String_Builder *sb)
+{
+    sb->list = StructLit(String_List){0};
+    sb->count = 0;
+}
+
+//
+// Path Helpers
+//
+
+function String path_filename(String path)
+{
+    return string_skip_last_slash(path);
+}
+
+function String path_dirname(String in_path)
+{
+    String path = in_path;
+    if (path.count > 0 && char_is_slash(path.data[path.count - 1]))
+    {
+        path.count -= 1;
+        while (path.count > 0 && char_is_slash(path.data[path.count - 1]))
+        {
+            path.count -= 1;
+        }
+    }
+
+    String result = string_chop_last_slash(path);
+    if (!result.count)
+    {
+        if (path_is_absolute(in_path))
+        {
+            result = S("/");
+        }
+        else
+        {
+            result = S(".");
+        }
+    }
+    return result;
+}
+
+function String path_extension(String path)
+{
+    String result = {0};
+    i64 slash_pos = string_find(path, S("/"), 0, MatchFlag_SlashInsensitive|MatchFlag_FindLast);
+    if (slash_pos < path.count)
+    {
+        i64 dot_pos = string_find(path, S("."), slash_pos, MatchFlag_FindLast);
+        if (dot_pos < path.count)
+        {
+            result = string_slice(path, dot_pos, path.count);
+        }
+    }
+    return result;
+}
+
+function String path_strip_extension(String path)
+{
+    String result = {0};
+    i64 slash_pos = string_find(path, S("/"), 0, MatchFlag_SlashInsensitive|MatchFlag_FindLast);
+    if (slash_pos < path.count)
+    {
+        i64 dot_pos = string_find(path, S("."), slash_pos, MatchFlag_FindLast);
+        if (dot_pos < path.count)
+        {
+            result = string_slice(path, 0, dot_pos);
+        }
+        else
+        {
+            result = path;
+        }
+    }
+    return result;
+}
+
+function String path_sanitize(Arena *arena, String path)
+{
+    path = string_trim_whitespace(path);
+
+    String result = string_push(arena, path);
+
+    for (i64 i = 0; i < result.count; i++)
+    {
+        u8 c = result.data[i];
+        if (
+            c == '/' || c == '\\' || c == ':' || c == '*' ||
+            c == '?' || c == '"'  || c == '<' || c == '>' ||
+            c == '|' || c == '\0' || c < 32
+        )
+        {
+            result.data[i] = '_';
+        }
+    }
+
+    return result;
+}
+
+function String path_join2(Arena *arena, String a, String b)
+{
+    return string_print(arena, "%.*s%c%.*s", LIT(a), PATH_SEP, LIT(b));
+}
+
+function String path_join3(Arena *arena, String a, String b, String c)
+{
+    return string_print(arena, "%.*s%c%.*s%c%.*s", LIT(a), PATH_SEP, LIT(b), PATH_SEP, LIT(c));
+}
+
+function String path_join4(Arena *arena, String a, String b, String c, String d)
+{
+    return string_print(arena, "%.*s%c%.*s%c%.*s%c%.*s", LIT(a), PATH_SEP, LIT(b), PATH_SEP, LIT(c), PATH_SEP, LIT(d));
+}
+
+function b32 path_is_absolute(String path)
+{
+    b32 result = false;
+    if (path.count > 0 && path.data[0] == '/')
+    {
+        result = true;
+    }
+    else
+    {
+        // Windows drive root:
+        if (path.count >= 2)
+        {
+            result = char_is_alpha(path.data[0]) && path.data[1] == ':';
+
+            if (path.count > 2)
+            {
+                result |= (path.data[2] == '\\' || path.data[2] == '/');
+            }
+        }
+    }
+    return result;
+}
+
+//
+// Timing
+//
+
+function String string_from_time(f64 time_in_seconds, String_Time_Options options)
+{
+    f64 time = time_in_seconds;
+
+    f64 fractional_ms = (time - (u64)time);
+    time -= fractional_ms;
+    u32 ms = (u32)(fractional_ms * 1000.0);
+
+    i32 s = (i32)(time) % 60;
+    i32 m = (i32)(time / 60.0) % 60;
+    f64 hpart = time / (60.0 * 60.0);
+    i32 h = (i32)(hpart + 0.5);
+
+    if (time_in_seconds < 0)
+    {
+        s = -s;
+        m = -m;
+        h = -h;
+    }
+
+    const char *sign = "";
+    if (options.show_sign)
+    {
+        sign = time_in_seconds < 0 ? "+" : "-";
+    }
+
+    if (options.show_hours)
+    {
+        return sprint("%s%02d:%02d:%02d", sign,h,m,s);
+    }
+
+    m += h * 60.0;
+
+    if (options.show_miliseconds)
+    {
+        return sprint("%s%02d:%02d:%03d", sign,m,s,ms);
+    }
+
+    return sprint("%s%02d:%02d", sign,m,s);
+}
+
+//
+// CLI
+//
+
+function String_Array string_array_from_c_array(Arena *arena, char **data, int count)
+{
+    String_Array result = {0};
+    result.data = PushArrayZero(arena, String, count);
+
+    for (int i = 0; i < count; i += 1)
+    {
+        assert(result.count < count);
+        result.data[result.count] = string_push(arena, string_from_cstr(data[i]));
+        result.count += 1;
+    }
+
+    return result;
+}
+
+function CLI_Argument string_parse_argument(String_Array array, i64 index)
+{
+    CLI_Argument result = {0};
+
+    String key = array.data[index];
+    String val = S("");
+
+    bool consumes_next_index = false;
+    i64 equals = string_index(key, S("="), 0);
+    if (equals >= 0)
+    {
+        String str = key;
+        key = string_slice(str, 0, equals);
+        val = string_slice(str, equals+1, str.count);
+    }
+    else if (string_starts_with(key, S("-")))
+    {
+        if (index < array.count-1)
+        {
+            String maybe_val = array.data[index+1];
+            if (!string_starts_with(maybe_val, S("-")))
+            {
+                consumes_next_index = true;
+                val = maybe_val;
+            }
+        }
+    }
+
+    // NOTE(nick): normalize all options to start with a single -
+    if (string_starts_with(key, S("--")))
+    {
+        key = string_skip(key, 1);
+    }
+
+    result.name = key;
+    result.value = val;
+    result.consumes_next_index = consumes_next_index;
+    return result;
+}
+
+function bool string_is_option(CLI_Argument arg)
+{
+    return string_starts_with(arg.name, S("-"));
+}
+
+function bool string_option_match(String arg_name, String name, String alias)
+{
+    if (!string_starts_with(name, S("-"))) name = string_concat2(temp_arena(), S("-"), name);
+    if (alias.count > 0 && !string_starts_with(alias, S("-"))) alias = string_concat2(temp_arena(), S("-"), alias);
+
+    return string_equals(arg_name, name) || (alias.count > 0 && string_equals(arg_name, alias));
+}
+
+function void cli_option_parse_bool(CLI_Argument arg, String name, String alias, b32 *value)
+{
+    if (string_option_match(arg.name, name, alias))
+    {
+        if (arg.value.count) *value = string_to_b32(arg.value);
+        else *value = true;
+    }
+}
+
+//
+// String Conversions
+//
+
+function String b32_to_string(b32 x)   { if (x) return S("true"); return S("false"); }
+function String char_to_string(char x) { return sprint("%c", x); }
+function String cstr_to_string(char *x) { return string_from_cstr(x); }
+function String int_to_string(int x) { return sprint("%d", x); }
+function String i64_to_string(i64 x) { return sprint("%lld", x); }
+function String u64_to_string(u64 x) { return sprint("%llu", x); }
+function String f32_to_string(f32 x) { return sprint("%.2f", x); }
+function String f64_to_string(f64 x) { return sprint("%.4f", x); }
+function String ptr_to_string(void *x) { return sprint("%p", x); }
+function String String_to_string(String x) { return x; }
+
+#if LANG_CPP
+
+function String to_string(bool x)   { return b32_to_string(x); }
+function String to_string(char x)   { return char_to_string(x); }
+function String to_string(char *x)  { return cstr_to_string(x); }
+function String to_string(i8 x)     { return int_to_string(x); }
+function String to_string(u8 x)     { return int_to_string(x); }
+function String to_string(i16 x)    { return int_to_string(x); }
+function String to_string(u16 x)    { return int_to_string(x); }
+function String to_string(i32 x)    { return int_to_string(x); }
+function String to_string(u32 x)    { return int_to_string(x); }
+function String to_string(i64 x)    { return i64_to_string(x); }
+function String to_string(u64 x)    { return u64_to_string(x); }
+function String to_string(f32 x)    { return f32_to_string(x); }
+function String to_string(f64 x)    { return f64_to_string(x); }
+function String to_string(void *x)  { return ptr_to_string(x); }
+function String to_string(String x) { return String_to_string(x); }
+
+#else
+
+#define Array__to_string
+#define Math__to_string
+
+#define to_string(x) _Generic((x), \
+    bool: b32_to_string, \
+    char: char_to_string, \
+    int: int_to_string, \
+    f32: f32_to_string, \
+    f64: f64_to_string, \
+    void*: ptr_to_string, \
+    String: String_to_string, \
+    Array__to_string Math__to_string default: S("<Unknown>") \
+)( (x) )
+
+#endif // LANG_CPP
+
+//
+// Functions
+//
+
+function b32 is_power_of_two(i64 x) {
+    return (x & (x - 1)) == 0;
+}
+
+// NOTE(nick): if x is already a power of two this function just returns x
+function u64 u64_next_power_of_two(u64 x) {
+    if (x == 0) return 1;
+
+    --x;
+    x |= x >> 1;
+    x |= x >> 2;
+    x |= x >> 4;
+    x |= x >> 8;
+    x |= x >> 16;
+    x |= x >> 32;
+
+    return ++x;
+}
+
+function u64 u64_previous_power_of_two(u64 x) {
+    x |= x >> 1;
+    x |= x >> 2;
+    x |= x >> 4;
+    x |= x >> 8;
+    x |= x >> 16;
+    x |= x >> 32;
+    return x - (x >> 1);
+}
+
+function u16 endian_swap_u16(u16 i) {
+    return (i>>8) | (i<<8);
+}
+
+function u32 endian_swap_u32(u32 i) {
+    return (i>>24) |(i<<24) | ((i&0x00ff0000u)>>8)  | ((i&0x0000ff00u)<<8);
+}
+
+function u64 endian_swap_u64(u64 i) {
+    return (i>>56) | (i<<56) |
+           ((i&0x00ff000000000000ull)>>40) | ((i&0x000000000000ff00ull)<<40) |
+           ((i&0x0000ff0000000000ull)>>24) | ((i&0x0000000000ff0000ull)<<24) |
+           ((i&0x000000ff00000000ull)>>8)  | ((i&0x00000000ff000000ull)<<8);
+}
+
+function u16 u16_from_big_endian(u16 i)
+{
+    return ARCH_BIG_ENDIAN ? i : endian_swap_u16(i);
+}
+
+function u32 u32_from_big_endian(u32 i)
+{
+    return ARCH_BIG_ENDIAN ? i : endian_swap_u32(i);
+}
+
+function u64 u64_from_big_endian(u64 i)
+{
+    return ARCH_BIG_ENDIAN ? i : endian_swap_u64(i);
+}
+
+function u32 rotate_left_u32(u32 value, i32 amount) {
+#if COMPILER_MSVC
+    u32 result = _rotl(value, amount);
+#else
+    // TODO(casey): Actually port this to other compiler platforms!
+    amount &= 31;
+    u32 result = ((value << amount) | (value >> (32 - amount)));
+#endif
+
+    return result;
+}
+
+function u32 rotate_right_u32(u32 value, i32 amount) {
+#if COMPILER_MSVC
+    u32 result = _rotr(value, amount);
+#else
+    // TODO(casey): Actually port this to other compiler platforms!
+    amount &= 31;
+    u32 result = ((value >> amount) | (value << (32 - amount)));
+#endif
+
+    return result;
+}
+
+// NOTE(nick): returns the low 64 bits of the 128 bit product
+function u64 multiply_u64_wide(u64 a, u64 b, u64 *hi) {
+#if (COMPILER_GCC || COMPILER_CLANG) && defined(__SIZEOF_INT128__)
+    unsigned __int128 product = (unsigned __int128)a * b;
+    *hi = (u64)(product >> 64);
+    return (u64)product;
+#elif COMPILER_MSVC && ARCH_X64
+    return _umul128(a, b, hi);
+#elif COMPILER_MSVC && ARCH_ARM64
+    *hi = __umulh(a, b);
+    return a * b;
+#else
+    u64 a_lo = a & 0xffffffff, a_hi = a >> 32;
+    u64 b_lo = b & 0xffffffff, b_hi = b >> 32;
+    u64 lo_lo = a_lo * b_lo;
+    u64 hi_lo = a_hi * b_lo;
+    u64 lo_hi = a_lo * b_hi;
+    u64 cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+    *hi = a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+    return (cross << 32) | (lo_lo & 0xffffffff);
+#endif
+}
+
+// NOTE(nick): these return the bit width when x is zero
+function u32 count_leading_zeros_u64(u64 x) {
+    if (x == 0) return 64;
+#if COMPILER_MSVC
+    unsigned long index = 0;
+    _BitScanReverse64(&index, x);
+    return 63 - (u32)index;
+#else
+    return (u32)__builtin_clzll(x);
+#endif
+}
+
+function u32 count_trailing_zeros_u64(u64 x) {
+    if (x == 0) return 64;
+#if COMPILER_MSVC
+    unsigned long index = 0;
+    _BitScanForward64(&index, x);
+    return (u32)index;
+#else
+    return (u32)__builtin_ctzll(x);
+#endif
+}
+
+function u32 count_trailing_zeros_u32(u32 x) {
+    if (x == 0) return 32;
+#if COMPILER_MSVC
+    unsigned long index = 0;
+    _BitScanForward(&index, x);
+    return (u32)index;
+#else
+    return (u32)__builtin_ctz(x);
+#endif
+}
+
+function u32 count_set_bits_u64(u64 x) {
+#if COMPILER_MSVC
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return (u32)((x * 0x0101010101010101ull) >> 56);
+#else
+    return (u32)__builtin_popcountll(x);
+#endif
+}
+
+//
+// Comparisons
+//
+
+function i32 compare_i32(const void *a, const void *b)
+{
+    i32 a0 = *(i32 *)a;
+    i32 b0 = *(i32 *)b;
+
+    return (a0 > b0) - (a0 < b0);
 }
 
-function String string_list_joins(Arena *arena, String_List list, String_Join_Params join)
+function i32 compare_i64(const void *a, const void *b)
 {
-    u64 sep_count = 0;
-    if (list.node_count > 1)
-    {
-        sep_count = list.node_count - 1;
-    }
-    String result = {0};
-    result.count = (list.total_size + join.pre.count +
-                   sep_count*join.sep.count + join.post.count);
-    result.data = PushArray(arena, u8, result.count);
-    
-    if (result.data)
-    {
-        u8 *ptr = result.data;
-        MemoryCopy(ptr, join.pre.data, join.pre.count);
-        ptr += join.pre.count;
-        for (String_Node *node = list.first; node; node = node->next)
-        {
-            MemoryCopy(ptr, node->string.data, node->string.count);
-            ptr += node->string.count;
-            if (node != list.last) {
-                MemoryCopy(ptr, join.sep.data, join.sep.count);
-                ptr += join.sep.count;
-            }
-        }
-        MemoryCopy(ptr, join.post.data, join.post.count);
-        ptr += join.post.count;
-    }
-    return result;
+    i64 a0 = *(i64 *)a;
+    i64 b0 = *(i64 *)b;
+
+    return (a0 > b0) - (a0 < b0);
 }
 
-function String string_list_join(Arena *arena, String_List list, String join)
+function i32 compare_u32(const void *a, const void *b)
 {
-    String_Join_Params params = {0};
-    params.sep = join;
-    return string_list_joins(arena, list, params);
+    u32 a0 = *(u32 *)a;
+    u32 b0 = *(u32 *)b;
+
+    return (a0 > b0) - (a0 < b0);
 }
 
-function String string_list_print(Arena *arena, String_List *list, char *fmt, ...)
+function i32 compare_u64(const void *a, const void *b)
 {
-    String result = {0};
+    u64 a0 = *(u64 *)a;
+    u64 b0 = *(u64 *)b;
 
-    va_list args;
-    va_start(args, fmt);
-    result = string_printv(arena, fmt, args);
-    va_end(args);
+    return (a0 > b0) - (a0 < b0);
+}
 
-    string_list_push(arena, list, result);
-    return result;
+function i32 compare_f32(const void *a, const void *b)
+{
+    f32 a0 = *(f32 *)a;
+    f32 b0 = *(f32 *)b;
+
+    return (a0 > b0) - (a0 < b0);
 }
 
-function String string_list_to_string(Arena *arena, String_List *list)
+function i32 compare_f64(const void *a, const void *b)
 {
-    String_Join_Params params = {0};
-    return string_list_joins(arena, *list, params);
+    f64 a0 = *(f64 *)a;
+    f64 b0 = *(f64 *)b;
+
+    return (a0 > b0) - (a0 < b0);
 }
 
-function String_List string_list_from_array(Arena *arena, String_Array array)
+function i32 compare_string(const void *a, const void *b)
 {
-    String_List result = {0};
-    for (i64 index = 0; index < array.count; index += 1)
-    {
-        String it = array.data[index];
-        string_list_push(arena, &result, it);
-    }
-    return result;
+    return string_compare(*(String *)a, *(String *)b, 0);
 }
 
 //
-// String Arrays
+// Radix Sort
 //
 
-function String_Array string_array_from_list(Arena *arena, String_List list)
-{
-    String_Array result = {0};
-    result.data = PushArrayZero(arena, String, list.node_count);
-    result.count = list.node_count;
-    result.capacity = list.node_count;
+//
+// NOTE(nick): LSD radix sort with 8-bit digits. Keys are first mapped to unsigned integers
+// that sort in the same order: signed keys flip the sign bit, floats flip every bit when
+// negative and only the sign bit otherwise. All the digit histograms come out of that one
+// pass, and a digit that's the same for every key skips its scatter pass entirely, so
+// small ranges of 64-bit keys only pay for the bytes that actually differ.
+//
 
-    i64 index = 0;
-    for (String_Node *it = list.first; it != NULL; it = it->next)
-    {
-        String str = string_push(arena, it->string);
-        result.data[index] = str;
-        index += 1;
-    }
+#define RADIX__INSERTION_SORT_COUNT 64
 
-    return result;
+enum {
+    Radix__Unsigned,
+    Radix__Signed,
+    Radix__Float,
+};
+
+force_inline function u32 radix__encode_u32(u32 key, u32 mode)
+{
+    if (mode == Radix__Signed) return key ^ 0x80000000u;
+    if (mode == Radix__Float)  return key ^ ((u32)((i32)key >> 31) | 0x80000000u);
+    return key;
 }
 
-function String_Array string_splits(Arena *arena, String string, int split_count, String *splits)
+force_inline function u32 radix__decode_u32(u32 key, u32 mode)
 {
-    String_Array result = {0};
-    result = string_array_from_list(arena, string_list_splits(arena, string, split_count, splits));
-    return result;
+    if (mode == Radix__Signed) return key ^ 0x80000000u;
+    if (mode == Radix__Float)  return key ^ ((u32)((i32)~key >> 31) | 0x80000000u);
+    return key;
 }
 
-function String_Array string_split(Arena *arena, String string, String split)
+force_inline function u64 radix__encode_u64(u64 key, u32 mode)
 {
-    String_Array result = {0};
-    result = string_array_from_list(arena, string_list_splits(arena, string, 1, &split));
-    return result;
+    if (mode == Radix__Signed) return key ^ 0x8000000000000000ull;
+    if (mode == Radix__Float)  return key ^ ((u64)((i64)key >> 63) | 0x8000000000000000ull);
+    return key;
 }
 
-function String string_join(Arena *arena, String_Array array, String join)
+force_inline function u64 radix__decode_u64(u64 key, u32 mode)
 {
-    String_Join_Params params = {0};
-    params.sep = join;
-    String_List list = string_list_from_array(arena, array);
-    return string_list_joins(temp_arena(), list, params);
+    if (mode == Radix__Signed) return key ^ 0x8000000000000000ull;
+    if (mode == Radix__Float)  return key ^ ((u64)((i64)~key >> 63) | 0x8000000000000000ull);
+    return key;
 }
 
-//
-// Misc Helpers
-//
+function void radix__sort_u32(u32 *keys, u32 *values, i64 count, u32 mode)
+{
+    if (count < 2) return;
 
-function String string_concat2(Arena *arena, String a, String b) {
-    u64 count = a.count + b.count;
-    u8 *data = PushArray(arena, u8, count);
+    if (count <= RADIX__INSERTION_SORT_COUNT)
+    {
+        for (i64 i = 0; i < count; i += 1)
+        {
+            keys[i] = radix__encode_u32(keys[i], mode);
+        }
 
-    if (data) {
-        MemoryCopy(data + 0      , a.data, a.count);
-        MemoryCopy(data + a.count, b.data, b.count);
+        for (i64 i = 1; i < count; i += 1)
+        {
+            u32 key = keys[i];
+            u32 value = values ? values[i] : 0;
+
+            i64 j = i;
+            for (; j > 0 && keys[j - 1] > key; j -= 1)
+            {
+                keys[j] = keys[j - 1];
+                if (values) values[j] = values[j - 1];
+            }
+
+            keys[j] = key;
+            if (values) values[j] = value;
+        }
     }
+    else
+    {
+        i64 hist[4][256] = {0};
+        for (i64 i = 0; i < count; i += 1)
+        {
+            u32 key = radix__encode_u32(keys[i], mode);
+            keys[i] = key;
 
-    return Str8(data, count);
-}
+            hist[0][(key >>  0) & 0xff] += 1;
+            hist[1][(key >>  8) & 0xff] += 1;
+            hist[2][(key >> 16) & 0xff] += 1;
+            hist[3][(key >> 24) & 0xff] += 1;
+        }
 
-function String string_concat3(Arena *arena, String a, String b, String c) {
-    u64 count = a.count + b.count + c.count;
-    u8 *data = PushArray(arena, u8, count);
+        M_Temp scratch = GetScratch(0, 0);
 
-    if (data) {
-        MemoryCopy(data + 0                , a.data, a.count);
-        MemoryCopy(data + a.count          , b.data, b.count);
-        MemoryCopy(data + a.count + b.count, c.data, c.count);
-    }
+        u32 *src_keys = keys;
+        u32 *dst_keys = PushArrayNoZero(scratch.arena, u32, count);
+        u32 *src_values = values;
+        u32 *dst_values = values ? PushArrayNoZero(scratch.arena, u32, count) : NULL;
 
-    return Str8(data, count);
-}
+        for (u32 pass = 0; pass < 4; pass += 1)
+        {
+            u32 shift = pass * 8;
+            i64 *offsets = hist[pass];
+            if (offsets[(src_keys[0] >> shift) & 0xff] == count) continue;
 
-function String string_concat4(Arena *arena, String a, String b, String c, String d) {
-    u64 count = a.count + b.count + c.count + d.count;
-    u8 *data = PushArray(arena, u8, count);
+            i64 sum = 0;
+            for (u32 digit = 0; digit < 256; digit += 1)
+            {
+                i64 n = offsets[digit];
+                offsets[digit] = sum;
+                sum += n;
+            }
 
-    if (data) {
-        MemoryCopy(data + 0,                           a.data, a.count);
-        MemoryCopy(data + a.count,                     b.data, b.count);
-        MemoryCopy(data + a.count + b.count,           c.data, c.count);
-        MemoryCopy(data + a.count + b.count + c.count, d.data, d.count);
+            if (values)
+            {
+                for (i64 i = 0; i < count; i += 1)
+                {
+                    u32 key = src_keys[i];
+                    i64 at = offsets[(key >> shift) & 0xff]++;
+                    dst_keys[at] = key;
+                    dst_values[at] = src_values[i];
+                }
+                Swap(u32 *, src_values, dst_values);
+            }
+            else
+            {
+                for (i64 i = 0; i < count; i += 1)
+                {
+                    u32 key = src_keys[i];
+                    dst_keys[offsets[(key >> shift) & 0xff]++] = key;
+                }
+            }
+            Swap(u32 *, src_keys, dst_keys);
+        }
+
+        if (src_keys != keys)
+        {
+            MemoryCopy(keys, src_keys, sizeof(u32) * count);
+            if (values) MemoryCopy(values, src_values, sizeof(u32) * count);
+        }
+
+        ReleaseScratch(scratch);
     }
 
-    return Str8(data, count);
+    if (mode != Radix__Unsigned)
+    {
+        for (i64 i = 0; i < count; i += 1)
+        {
+            keys[i] = radix__decode_u32(keys[i], mode);
+        }
+    }
 }
 
-function String string_insert(Arena *arena, String text, i64 index, String insert, i64 replace_count)
+function void radix__sort_u64(u64 *keys, u64 *values, i64 count, u32 mode)
 {
-    String pre = string_slice(text, 0, index);
-    String post = string_slice(text, index+replace_count, text.count);
-    return string_concat3(arena, pre, insert, post);
-}
+    if (count < 2) return;
 
-function String string_concat_array(Arena *arena, String *array, u32 count)
-{
-    String result = {0};
-    
-    u64 total_size_in_bytes = 0;
-    for (u32 i = 0; i < count; i += 1)
+    if (count <= RADIX__INSERTION_SORT_COUNT)
     {
-        total_size_in_bytes += array[i].count;
+        for (i64 i = 0; i < count; i += 1)
+        {
+            keys[i] = radix__encode_u64(keys[i], mode);
+        }
+
+        for (i64 i = 1; i < count; i += 1)
+        {
+            u64 key = keys[i];
+            u64 value = values ? values[i] : 0;
+
+            i64 j = i;
+            for (; j > 0 && keys[j - 1] > key; j -= 1)
+            {
+                keys[j] = keys[j - 1];
+                if (values) values[j] = values[j - 1];
+            }
+
+            keys[j] = key;
+            if (values) values[j] = value;
+        }
     }
+    else
+    {
+        i64 hist[8][256] = {0};
+        for (i64 i = 0; i < count; i += 1)
+        {
+            u64 key = radix__encode_u64(keys[i], mode);
+            keys[i] = key;
+
+            hist[0][(key >>  0) & 0xff] += 1;
+            hist[1][(key >>  8) & 0xff] += 1;
+            hist[2][(key >> 16) & 0xff] += 1;
+            hist[3][(key >> 24) & 0xff] += 1;
+            hist[4][(key >> 32) & 0xff] += 1;
+            hist[5][(key >> 40) & 0xff] += 1;
+            hist[6][(key >> 48) & 0xff] += 1;
+            hist[7][(key >> 56) & 0xff] += 1;
+        }
 
-    u8 *data = PushArray(arena, u8, total_size_in_bytes);
-    if (data)
+        M_Temp scratch = GetScratch(0, 0);
+
+        u64 *src_keys = keys;
+        u64 *dst_keys = PushArrayNoZero(scratch.arena, u64, count);
+        u64 *src_values = values;
+        u64 *dst_values = values ? PushArrayNoZero(scratch.arena, u64, count) : NULL;
+
+        for (u32 pass = 0; pass < 8; pass += 1)
+        {
+            u32 shift = pass * 8;
+            i64 *offsets = hist[pass];
+            if (offsets[(src_keys[0] >> shift) & 0xff] == count) continue;
+
+            i64 sum = 0;
+            for (u32 digit = 0; digit < 256; digit += 1)
+            {
+                i64 n = offsets[digit];
+                offsets[digit] = sum;
+                sum += n;
+            }
+
+            if (values)
+            {
+                for (i64 i = 0; i < count; i += 1)
+                {
+                    u64 key = src_keys[i];
+                    i64 at = offsets[(key >> shift) & 0xff]++;
+                    dst_keys[at] = key;
+                    dst_values[at] = src_values[i];
+                }
+                Swap(u64 *, src_values, dst_values);
+            }
+            else
+            {
+                for (i64 i = 0; i < count; i += 1)
+                {
+                    u64 key = src_keys[i];
+                    dst_keys[offsets[(key >> shift) & 0xff]++] = key;
+                }
+            }
+            Swap(u64 *, src_keys, dst_keys);
+        }
+
+        if (src_keys != keys)
+        {
+            MemoryCopy(keys, src_keys, sizeof(u64) * count);
+            if (values) MemoryCopy(values, src_values, sizeof(u64) * count);
+        }
+
+        ReleaseScratch(scratch);
+    }
+
+    if (mode != Radix__Unsigned)
     {
-        u8 *at = data;
-        for (u32 i = 0; i < count; i += 1)
+        for (i64 i = 0; i < count; i += 1)
         {
-            String it = array[i];
-            MemoryCopy(at, it.data, it.count);
-            at += it.count;
+            keys[i] = radix__decode_u64(keys[i], mode);
         }
-        result = string_make(data, at - data);
+    }
+}
+
+function void radix_sort_u32(u32 *keys, i64 count) { radix__sort_u32(keys, NULL, count, Radix__Unsigned); }
+function void radix_sort_i32(i32 *keys, i64 count) { radix__sort_u32((u32 *)keys, NULL, count, Radix__Signed); }
+function void radix_sort_f32(f32 *keys, i64 count) { radix__sort_u32((u32 *)keys, NULL, count, Radix__Float); }
+function void radix_sort_u64(u64 *keys, i64 count) { radix__sort_u64(keys, NULL, count, Radix__Unsigned); }
+function void radix_sort_i64(i64 *keys, i64 count) { radix__sort_u64((u64 *)keys, NULL, count, Radix__Signed); }
+function void radix_sort_f64(f64 *keys, i64 count) { radix__sort_u64((u64 *)keys, NULL, count, Radix__Float); }
+
+function void radix_sort_u32_pairs(u32 *keys, u32 *values, i64 count) { radix__sort_u32(keys, values, count, Radix__Unsigned); }
+function void radix_sort_i32_pairs(i32 *keys, u32 *values, i64 count) { radix__sort_u32((u32 *)keys, values, count, Radix__Signed); }
+function void radix_sort_f32_pairs(f32 *keys, u32 *values, i64 count) { radix__sort_u32((u32 *)keys, values, count, Radix__Float); }
+function void radix_sort_u64_pairs(u64 *keys, u64 *values, i64 count) { radix__sort_u64(keys, values, count, Radix__Unsigned); }
+function void radix_sort_i64_pairs(i64 *keys, u64 *values, i64 count) { radix__sort_u64((u64 *)keys, values, count, Radix__Signed); }
+function void radix_sort_f64_pairs(f64 *keys, u64 *values, i64 count) { radix__sort_u64((u64 *)keys, values, count, Radix__Float); }
+
+//
+// Hashing
+//
+
+function u32 murmur32_seed(void const *data, i64 len, u32 seed) {
+    u32 const c1 = 0xcc9e2d51;
+    u32 const c2 = 0x1b873593;
+    u32 const r1 = 15;
+    u32 const r2 = 13;
+    u32 const m  = 5;
+    u32 const n  = 0xe6546b64;
+
+    i64 i, nblocks = len / 4;
+    u32 hash = seed, k1 = 0;
+    u32 const *blocks = cast(u32 const*)data;
+    u8 const *tail = cast(u8 const *)(data) + nblocks*4;
+
+    for (i = 0; i < nblocks; i++) {
+        u32 k = blocks[i];
+        k *= c1;
+        k = (k << r1) | (k >> (32 - r1));
+        k *= c2;
+
+        hash ^= k;
+        hash = ((hash << r2) | (hash >> (32 - r2))) * m + n;
+    }
+
+    switch (len & 3) {
+    case 3:
+        k1 ^= tail[2] << 16;
+    case 2:
+        k1 ^= tail[1] << 8;
+    case 1:
+        k1 ^= tail[0];
+
+        k1 *= c1;
+        k1 = (k1 << r1) | (k1 >> (32 - r1));
+        k1 *= c2;
+        hash ^= k1;
     }
 
-    return result;
-}
+    hash ^= len;
+    hash ^= (hash >> 16);
+    hash *= 0x85ebca6b;
+    hash ^= (hash >> 13);
+    hash *= 0xc2b2ae35;
+    hash ^= (hash >> 16);
 
-function String string_chop_last_period(String string)
-{
-    i64 pos = string_find(string, S("."), 0, MatchFlag_FindLast);
-    if (pos < string.count)
-    {
-        string.count = pos;
-    }
-    return string;
+    return hash;
 }
 
-function String string_skip_last_period(String string)
-{
-    i64 pos = string_find(string, S("."), 0, MatchFlag_FindLast);
-    if (pos < string.count)
-    {
-        string.data += pos+1;
-        string.count -= pos+1;
-    }
-    return string;
-}
+function u64 murmur64_seed(void const *data_, i64 len, u64 seed) {
+    const u64 m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
 
-function String string_chop_last_slash(String string)
-{
-    i64 pos = string_find(string, S("/"), 0, MatchFlag_SlashInsensitive|MatchFlag_FindLast);
-    if (pos < string.count)
-    {
-        string.count = pos;
-    }
-    return string;
-}
+    u64 h = seed ^ (len * m);
 
-function String string_skip_last_slash(String string)
-{
-    i64 pos = string_find(string, S("/"), 0, MatchFlag_SlashInsensitive|MatchFlag_FindLast);
-    if (pos < string.count)
-    {
-        string.data += pos+1;
-        string.count -= pos+1;
-    }
-    return string;
-}
+    u64 const *data = cast(u64 const *)data_;
+    u8  const *data2 = cast(u8 const *)data_;
+    u64 const* end = data + (len / 8);
 
-function String string_trim_whitespace(String str)
-{
-    String result = str;
-    while (result.count > 0 && char_is_whitespace(result.data[0]))
-    {
-        result.data  += 1;
-        result.count -= 1;
-    }
+    while (data != end) {
+        u64 k = *data++;
 
-    while (result.count > 0 && char_is_whitespace(result.data[result.count - 1]))
-    {
-        result.count -= 1;
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+
+        h ^= k;
+        h *= m;
     }
-    return result;
+
+    switch (len & 7) {
+    case 7: h ^= cast(u64)(data2[6]) << 48;
+    case 6: h ^= cast(u64)(data2[5]) << 40;
+    case 5: h ^= cast(u64)(data2[4]) << 32;
+    case 4: h ^= cast(u64)(data2[3]) << 24;
+    case 3: h ^= cast(u64)(data2[2]) << 16;
+    case 2: h ^= cast(u64)(data2[1]) << 8;
+    case 1: h ^= cast(u64)(data2[0]);
+        h *= m;
+    };
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+
+    return h;
 }
 
-function String string_eat_whitespace(String str)
+function u32 murmur32(void const *data, i64 len)
 {
-    String result = str;
-    while (result.count > 0 && char_is_whitespace(result.data[0]))
-    {
-        result.data  += 1;
-        result.count -= 1;
-    }
-    return result;
+    return murmur32_seed(data, len, 0x9747b28c);
 }
 
-function String string_remove(Arena *arena, String str, String remove)
+function u64 murmur64(void const *data, i64 len)
 {
-    return string_replace(arena, str, remove, S(""), 0);
+    return murmur64_seed(data, len, 0x9747b28c);
 }
 
-function String string_strip(Arena *arena, String str, String chars)
-{
-    String result = str;
-    for (i64 i = 0; i < chars.count; i += 1)
-    {
-        String character = Str8(chars.data+i,1);
-        result = string_remove(arena,result,character);
+function u32 fnv32a(void const *data, i64 len) {
+    u8 const *bytes = cast(u8 const *)data;
+    u32 h = 0x811c9dc5;
+    
+    for (; len >= 8; len -= 8, bytes += 8) {
+        h = (h ^ bytes[0]) * 0x01000193;
+        h = (h ^ bytes[1]) * 0x01000193;
+        h = (h ^ bytes[2]) * 0x01000193;
+        h = (h ^ bytes[3]) * 0x01000193;
+        h = (h ^ bytes[4]) * 0x01000193;
+        h = (h ^ bytes[5]) * 0x01000193;
+        h = (h ^ bytes[6]) * 0x01000193;
+        h = (h ^ bytes[7]) * 0x01000193;
     }
-    return result;
-}
 
-function u64 string_hash(String str)
-{
-    // djb2
-    u64 result = 5381;
-    for (u64 i = 0; i < str.count; i += 1)
-    {
-        u8 c = str.data[i];
-        result = ((result << 5) + result) + c;
+    while (len--) {
+        h = (h ^ *bytes++) * 0x01000193;
     }
-    return result;
+    return h;
 }
 
-function void string_to_lower(String *str)
-{
-    for (i64 i = 0; i < str->count; i += 1)
-    {
-        str->data[i] = char_to_lower(str->data[i]);
+function u64 fnv64a(void const *data, i64 len) {
+    u8 const *bytes = cast(u8 const *)data;
+    u64 h = 0xcbf29ce484222325ull;
+    
+    for (; len >= 8; len -= 8, bytes += 8) {
+        h = (h ^ bytes[0]) * 0x100000001b3ull;
+        h = (h ^ bytes[1]) * 0x100000001b3ull;
+        h = (h ^ bytes[2]) * 0x100000001b3ull;
+        h = (h ^ bytes[3]) * 0x100000001b3ull;
+        h = (h ^ bytes[4]) * 0x100000001b3ull;
+        h = (h ^ bytes[5]) * 0x100000001b3ull;
+        h = (h ^ bytes[6]) * 0x100000001b3ull;
+        h = (h ^ bytes[7]) * 0x100000001b3ull;
     }
-}
 
-function void string_to_upper(String *str)
-{
-    for (i64 i = 0; i < str->count; i += 1)
-    {
-        str->data[i] = char_to_upper(str->data[i]);
+    while (len--) {
+        h = (h ^ *bytes++) * 0x100000001b3ull;
     }
+    return h;
 }
 
-function String string_lower(Arena *arena, String str)
+function u64 murmur64_from_string(String str)
 {
-    String result = string_push(arena, str);
-    string_to_lower(&result);
-    return result;
+    return murmur64(str.data, str.count);
 }
 
-function String string_upper(Arena *arena, String str)
+function u64 fnv64a_from_string(String str)
 {
-    String result = string_push(arena, str);
-    string_to_upper(&result);
-    return result;
+    return fnv64a(str.data, str.count);
 }
 
 //
-// String Builder
+// NOTE(nick): hash64 is modeled on wyhash (final4): 48 bytes per round across three lanes,
+// each folding a 64x64->128 multiply. The streaming version gives the same result as hash64_seed
+// for the same bytes however they're split up.
 //
 
-function void sb_push(Arena *arena, String_Builder *sb, String str)
-{
-    string_list_push(arena, &sb->list, str);
-}
+static const u64 hash64__secret[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull,
+};
 
-function void sb_print(Arena *arena, String_Builder *sb, const char *fmt, ...)
+force_inline function u64 hash64__mix(u64 a, u64 b)
 {
-    va_list args;
-    va_start(args, fmt);
-    String str = string_printv(arena, fmt, args);
-    va_end(args);
-    string_list_push(arena, &sb->list, str);
+    u64 hi;
+    u64 lo = multiply_u64_wide(a, b, &hi);
+    return lo ^ hi;
 }
 
-function String sb_to_string(Arena *arena, String_Builder sb)
+force_inline function u64 hash64__read8(u8 const *at)
 {
-    return string_list_to_string(arena, &sb.list);
+    u64 result;
+    MemoryCopy(&result, at, sizeof(result));
+    if (ARCH_BIG_ENDIAN) result = endian_swap_u64(result);
+    return result;
 }
 
-function void sb_reset(String_Builder *sb)
+force_inline function u64 hash64__read4(u8 const *at)
 {
-    sb->list = StructLit(String_List){0};
+    u32 result;
+    MemoryCopy(&result, at, sizeof(result));
+    if (ARCH_BIG_ENDIAN) result = endian_swap_u32(result);
+    return result;
 }
 
-//
-// Path Helpers
-//
-
-function String path_filename(String path)
+force_inline function u64 hash64__seed(u64 seed)
 {
-    return string_skip_last_slash(path);
+    return seed ^ hash64__mix(seed ^ hash64__secret[0], hash64__secret[1]);
 }
 
-function String path_dirname(String in_path)
+force_inline function void hash64__rounds(u64 *seed, u64 *see1, u64 *see2, u8 const *at, i64 count)
 {
-    String path = in_path;
-    if (path.count > 0 && char_is_slash(path.data[path.count - 1]))
+    const u64 *secret = hash64__secret;
+    u64 s0 = *seed, s1 = *see1, s2 = *see2;
+
+    for (u8 const *end = at + count; at < end; at += 48)
     {
-        path.count -= 1;
-        while (path.count > 0 && char_is_slash(path.data[path.count - 1]))
-        {
-            path.count -= 1;
-        }
+        s0 = hash64__mix(hash64__read8(at +  0) ^ secret[1], hash64__read8(at +  8) ^ s0);
+        s1 = hash64__mix(hash64__read8(at + 16) ^ secret[2], hash64__read8(at + 24) ^ s1);
+        s2 = hash64__mix(hash64__read8(at + 32) ^ secret[3], hash64__read8(at + 40) ^ s2);
     }
 
-    String result = string_chop_last_slash(path);
-    if (!result.count)
+    *seed = s0; *see1 = s1; *see2 = s2;
+}
+
+// NOTE(nick): at most 48 bytes are left here, and at[-16..-1] must be readable when len > 16
+function u64 hash64__finish(u8 const *at, i64 count, u64 seed, u64 len)
+{
+    const u64 *secret = hash64__secret;
+    u64 a = 0, b = 0;
+
+    if (len <= 16)
     {
-        if (path_is_absolute(in_path))
+        if (count >= 4)
         {
-            result = S("/");
+            i64 step = (count >> 3) << 2;
+            a = (hash64__read4(at) << 32) | hash64__read4(at + step);
+            b = (hash64__read4(at + count - 4) << 32) | hash64__read4(at + count - 4 - step);
         }
-        else
+        else if (count > 0)
         {
-            result = S(".");
+            a = ((u64)at[0] << 16) | ((u64)at[count >> 1] << 8) | at[count - 1];
         }
     }
-    return result;
-}
-
-function String path_extension(String path)
-{
-    String result = {0};
-    i64 slash_pos = string_find(path, S("/"), 0, MatchFlag_SlashInsensitive|MatchFlag_FindLast);
-    if (slash_pos < path.count)
+    else
     {
-        i64 dot_pos = string_find(path, S("."), slash_pos, MatchFlag_FindLast);
-        if (dot_pos < path.count)
+        while (count > 16)
         {
-            result = string_slice(path, dot_pos, path.count);
+            seed = hash64__mix(hash64__read8(at) ^ secret[1], hash64__read8(at + 8) ^ seed);
+            at += 16;
+            count -= 16;
         }
+
+        a = hash64__read8(at + count - 16);
+        b = hash64__read8(at + count - 8);
     }
-    return result;
+
+    a ^= secret[1];
+    b ^= seed;
+    a = multiply_u64_wide(a, b, &b);
+    return hash64__mix(a ^ secret[0] ^ len, b ^ secret[1]);
 }
 
-function String path_strip_extension(String path)
+function u64 hash64_seed(void const *data, i64 len, u64 seed)
 {
-    String result = {0};
-    i64 slash_pos = string_find(path, S("/"), 0, MatchFlag_SlashInsensitive|MatchFlag_FindLast);
-    if (slash_pos < path.count)
+    u8 const *at = (u8 const *)data;
+    seed = hash64__seed(seed);
+
+    i64 count = len;
+    if (count > 48)
     {
-        i64 dot_pos = string_find(path, S("."), slash_pos, MatchFlag_FindLast);
-        if (dot_pos < path.count)
-        {
-            result = string_slice(path, 0, dot_pos);
-        }
-        else
-        {
-            result = path;
-        }
+        u64 see1 = seed, see2 = seed;
+        i64 blocks = ((count - 1) / 48) * 48;
+        hash64__rounds(&seed, &see1, &see2, at, blocks);
+        seed ^= see1 ^ see2;
+        at += blocks;
+        count -= blocks;
     }
+
+    return hash64__finish(at, count, seed, (u64)len);
+}
+
+function u64 hash64(void const *data, i64 len)
+{
+    return hash64_seed(data, len, 0);
+}
+
+function u64 hash64_from_string(String str)
+{
+    return hash64(str.data, str.count);
+}
+
+function Hash64_State hash64_begin(u64 seed)
+{
+    Hash64_State result = {0};
+    result.seed = hash64__seed(seed);
+    result.see1 = result.seed;
+    result.see2 = result.seed;
     return result;
 }
 
-function String path_sanitize(Arena *arena, String path)
+// NOTE(nick): a block only runs once we know more bytes follow it, the last 1-48 bytes
+// always go through hash64__finish like they do in hash64_seed.
+function void hash64_update(Hash64_State *state, void const *data, i64 len)
 {
-    path = string_trim_whitespace(path);
+    u8 const *at = (u8 const *)data;
+    if (len <= 0) return;
+    state->total += len;
 
-    String result = string_push(arena, path);
+    u8 *pending = state->buffer + 16;
 
-    for (i64 i = 0; i < result.count; i++)
+    if (state->buffered + len <= 48)
     {
-        u8 c = result.data[i];
-        if (
-            c == '/' || c == '\\' || c == ':' || c == '*' ||
-            c == '?' || c == '"'  || c == '<' || c == '>' ||
-            c == '|' || c == '\0' || c < 32
-        )
-        {
-            result.data[i] = '_';
-        }
+        MemoryCopy(pending + state->buffered, at, len);
+        state->buffered += len;
+        return;
+    }
+
+    if (state->buffered > 0)
+    {
+        i64 fill = 48 - state->buffered;
+        MemoryCopy(pending + state->buffered, at, fill);
+        at += fill;
+        len -= fill;
+        hash64__rounds(&state->seed, &state->see1, &state->see2, pending, 48);
+        MemoryCopy(state->buffer, pending + 32, 16);
+        state->buffered = 0;
     }
 
-    return result;
-}
+    if (len > 48)
+    {
+        i64 blocks = ((len - 1) / 48) * 48;
+        hash64__rounds(&state->seed, &state->see1, &state->see2, at, blocks);
+        MemoryCopy(state->buffer, at + blocks - 16, 16);
+        at += blocks;
+        len -= blocks;
+    }
 
-function String path_join2(Arena *arena, String a, String b)
-{
-    return string_print(arena, "%.*s%c%.*s", LIT(a), PATH_SEP, LIT(b));
+    MemoryCopy(pending, at, len);
+    state->buffered = len;
 }
 
-function String path_join3(Arena *arena, String a, String b, String c)
+function u64 hash64_end(Hash64_State *state)
 {
-    return string_print(arena, "%.*s%c%.*s%c%.*s", LIT(a), PATH_SEP, LIT(b), PATH_SEP, LIT(c));
+    u64 seed = state->seed;
+    if (state->total > 48)
+    {
+        seed ^= state->see1 ^ state->see2;
+    }
+    return hash64__finish(state->buffer + 16, state->buffered, seed, state->total);
 }
 
-function String path_join4(Arena *arena, String a, String b, String c, String d)
+
+function u32 hash_number_u32(const uint32_t offset, const uint32_t seed)
 {
-    return string_print(arena, "%.*s%c%.*s%c%.*s%c%.*s", LIT(a), PATH_SEP, LIT(b), PATH_SEP, LIT(c), PATH_SEP, LIT(d));
+    u32 hash = seed;
+    hash += (offset + 48);
+    hash += (hash << 10);
+    hash ^= (hash >> 6);
+
+    hash += (hash << 3);
+    hash ^= (hash >> 11);
+    hash += (hash << 15);
+    return hash;
 }
 
-function b32 path_is_absolute(String path)
+function u32 hash_mix_u32(u32 id, u32 number)
 {
-    b32 result = false;
-    if (path.count > 0 && path.data[0] == '/')
-    {
-        result = true;
-    }
-    else
-    {
-        // Windows drive root:
-        if (path.count >= 2)
-        {
-            result = char_is_alpha(path.data[0]) && path.data[1] == ':';
+    id += number;
+    id += (id << 10);
+    id ^= (id >> 6);
 
-            if (path.count > 2)
-            {
-                result |= (path.data[2] == '\\' || path.data[2] == '/');
-            }
-        }
-    }
-    return result;
+    id += (id << 3);
+    id ^= (id >> 11);
+    id += (id << 15);
+    return id;
 }
 
 //
-// Timing
+// Checksums
 //
 
-function String string_from_time(f64 time_in_seconds, String_Time_Options options)
-{
-    f64 time = time_in_seconds;
-
-    f64 fractional_ms = (time - (u64)time);
-    time -= fractional_ms;
-    u32 ms = (u32)(fractional_ms * 1000.0);
-
-    i32 s = (i32)(time) % 60;
-    i32 m = (i32)(time / 60.0) % 60;
-    f64 hpart = time / (60.0 * 60.0);
-    i32 h = (i32)(hpart + 0.5);
+//
+// NOTE(nick): the _update versions take the value returned for the bytes so far, so
+// crc32_update(crc32(a, n), b, m) is the crc32 of a followed by b. Chunks from os_file_read
+// or a socket can go straight in. CRC32 starts from 0 and Adler-32 from 1.
+//
+// CRC32 is the zlib/PNG/Ethernet one, CRC32C (Castagnoli) the iSCSI/ext4 one. Without the
+// hardware instructions both run slicing-by-8: table[k][b] is the crc of byte b followed
+// by k zero bytes, so eight bytes cost eight lookups and no dependency between them.
+//
 
-    if (time_in_seconds < 0)
+static const u32 crc32__table[8][256] = {
     {
-        s = -s;
-        m = -m;
-        h = -h;
-    }
+        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+        0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+        0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+        0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+        0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+        0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+        0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+        0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+        0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+        0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+        0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+        0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+        0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+        0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+        0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+        0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+        0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+        0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+        0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+        0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+        0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+        0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
+    },
+    {
+        0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445, 0x565aa786, 0x4f4196c7,
+        0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb, 0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf,
+        0x4ac21251, 0x53d92310, 0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+        0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c, 0xd4413fdf, 0xcd5a0e9e,
+        0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761, 0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265,
+        0x5d5daeaa, 0x44469feb, 0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+        0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6, 0x891c9175, 0x9007a034,
+        0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38, 0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c,
+        0xf0794f05, 0xe9627e44, 0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+        0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148, 0x6efa628b, 0x77e153ca,
+        0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97, 0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93,
+        0x7262d75c, 0x6b79e61d, 0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+        0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2, 0x33a7cc21, 0x2abcfd60,
+        0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c, 0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768,
+        0x2f3f79f6, 0x362448b7, 0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+        0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb, 0xb1bc5478, 0xa8a76539,
+        0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88, 0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c,
+        0xf35a1243, 0xea412302, 0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+        0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f, 0x271b2d9c, 0x3e001cdd,
+        0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1, 0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5,
+        0xae07bce9, 0xb71c8da8, 0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+        0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4, 0x30849167, 0x299fa026,
+        0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b, 0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f,
+        0x2c1c24b0, 0x350715f1, 0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+        0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b, 0x9da070c8, 0x84bb4189,
+        0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85, 0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81,
+        0x8138c51f, 0x9823f45e, 0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+        0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52, 0x1fbbe891, 0x06a0d9d0,
+        0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f, 0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b,
+        0x96a779e4, 0x8fbc48a5, 0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+        0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8, 0x42e6463b, 0x5bfd777a,
+        0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876, 0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72,
+    },
+    {
+        0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb, 0x048d7cb2, 0x054f1685,
+        0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1, 0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d,
+        0x1c26a370, 0x1de4c947, 0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+        0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023, 0x16b88e7a, 0x177ae44d,
+        0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9, 0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065,
+        0x365e1758, 0x379c7d6f, 0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+        0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b, 0x20e69922, 0x2124f315,
+        0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71, 0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad,
+        0x709a8dc0, 0x7158e7f7, 0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+        0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93, 0x7a04a0ca, 0x7bc6cafd,
+        0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9, 0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835,
+        0x62af7f08, 0x636d153f, 0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+        0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb, 0x4c5ab792, 0x4d98dda5,
+        0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1, 0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d,
+        0x54f16850, 0x55330267, 0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+        0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03, 0x5e6f455a, 0x5fad2f6d,
+        0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9, 0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05,
+        0xef264a38, 0xeee4200f, 0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+        0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b, 0xf99ec442, 0xf85cae75,
+        0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711, 0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd,
+        0xd9785d60, 0xd8ba3757, 0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+        0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33, 0xd3e6706a, 0xd2241a5d,
+        0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049, 0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895,
+        0xcb4dafa8, 0xca8fc59f, 0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+        0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab, 0x9522eaf2, 0x94e080c5,
+        0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1, 0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d,
+        0x8d893530, 0x8c4b5f07, 0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+        0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663, 0x8717183a, 0x86d5720d,
+        0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9, 0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625,
+        0xa7f18118, 0xa633eb2f, 0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+        0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b, 0xb1490f62, 0xb08b6555,
+        0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31, 0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed,
+    },
+    {
+        0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032, 0x256b5fdc, 0x9dd738b9,
+        0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701, 0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056,
+        0x5019579f, 0xe8a530fa, 0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+        0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42, 0xb0c620ac, 0x087a47c9,
+        0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0, 0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787,
+        0x658687d1, 0xdd3ae0b4, 0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+        0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893, 0xd540a77d, 0x6dfcc018,
+        0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0, 0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7,
+        0x9b14583d, 0x23a83f58, 0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+        0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0, 0x7bcb2f0e, 0xc377486b,
+        0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c, 0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b,
+        0x0eb9274d, 0xb6054028, 0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+        0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731, 0x1e4da8df, 0xa6f1cfba,
+        0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002, 0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755,
+        0x6b3fa09c, 0xd383c7f9, 0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+        0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841, 0x8be0d7af, 0x335cb0ca,
+        0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5, 0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82,
+        0x28ed9ed4, 0x9051f9b1, 0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+        0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196, 0x982bbe78, 0x2097d91d,
+        0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5, 0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2,
+        0x4d6b1905, 0xf5d77e60, 0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+        0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8, 0xadb46e36, 0x15080953,
+        0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174, 0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623,
+        0xd8c66675, 0x607a0110, 0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+        0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34, 0x5326b1da, 0xeb9ad6bf,
+        0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907, 0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50,
+        0x2654b999, 0x9ee8defc, 0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+        0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144, 0xc68bceaa, 0x7e37a9cf,
+        0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6, 0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981,
+        0x13cb69d7, 0xab770eb2, 0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+        0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695, 0xa30d497b, 0x1bb12e1e,
+        0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6, 0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1,
+    },
+    {
+        0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70, 0x8f40f5a0, 0xb220dc10,
+        0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111, 0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1,
+        0x60e09782, 0x5d80be32, 0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+        0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333, 0xdfd029e3, 0xe2b00053,
+        0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4, 0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314,
+        0xf1b164c5, 0xccd14d75, 0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+        0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6, 0x2e614d26, 0x13016496,
+        0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997, 0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57,
+        0x58f35849, 0x659371f9, 0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+        0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8, 0xe7c3e628, 0xdaa3cf98,
+        0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b, 0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db,
+        0x0863840a, 0x3503adba, 0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+        0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d, 0x167282ed, 0x2b12ab5d,
+        0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c, 0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c,
+        0xf9d2e0cf, 0xc4b2c97f, 0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+        0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e, 0x46e25eae, 0x7b82771e,
+        0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42, 0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82,
+        0x8196fb53, 0xbcf6d2e3, 0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+        0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860, 0x5e46d2b0, 0x6326fb00,
+        0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601, 0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1,
+        0x70279f96, 0x4d47b626, 0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+        0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27, 0xcf1721f7, 0xf2770847,
+        0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4, 0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404,
+        0x20b743d5, 0x1dd76a65, 0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+        0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab, 0x66551d7b, 0x5b3534cb,
+        0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca, 0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a,
+        0x89f57f59, 0xb49556e9, 0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+        0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8, 0x36c5c138, 0x0ba5e888,
+        0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f, 0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf,
+        0x18a48c1e, 0x25c4a5ae, 0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+        0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d, 0xc774a5fd, 0xfa148c4d,
+        0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c, 0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c,
+    },
+    {
+        0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3, 0xd659e31d, 0x1d0530b8,
+        0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3, 0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5,
+        0x03d6029b, 0xc88ad13e, 0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+        0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145, 0x39dc63eb, 0xf280b04e,
+        0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798, 0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e,
+        0xebff875b, 0x20a354fe, 0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+        0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e, 0xd223e4b0, 0x197f3715,
+        0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e, 0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578,
+        0x0f580a6c, 0xc404d9c9, 0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+        0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2, 0x35526b1c, 0xfe0eb8b9,
+        0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59, 0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f,
+        0xe0dd8a9a, 0x2b81593f, 0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+        0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9, 0xdeadec47, 0x15f13fe2,
+        0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99, 0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f,
+        0x0b220dc1, 0xc07ede64, 0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+        0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f, 0x31286cb1, 0xfa74bf14,
+        0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676, 0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460,
+        0xf2e396b5, 0x39bf4510, 0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+        0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0, 0xcb3ff55e, 0x006326fb,
+        0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680, 0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496,
+        0x191c11ee, 0xd240c24b, 0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+        0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230, 0x2316709e, 0xe84aa33b,
+        0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db, 0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd,
+        0xf6999118, 0x3dc542bd, 0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+        0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07, 0xc7b1fda9, 0x0ced2e0c,
+        0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77, 0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61,
+        0x123e1c2f, 0xd962cf8a, 0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+        0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1, 0x28347d5f, 0xe368aefa,
+        0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c, 0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a,
+        0xfa1799ef, 0x314b4a4a, 0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+        0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa, 0xc3cbfa04, 0x089729a1,
+        0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da, 0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc,
+    },
+    {
+        0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7, 0x63d0353a, 0xc5a73e8e,
+        0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa, 0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9,
+        0x67de9cce, 0xc1a9977a, 0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+        0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e, 0x37e1e793, 0x9196ec27,
+        0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301, 0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712,
+        0xfc5277fb, 0x5a257c4f, 0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+        0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5, 0xcbb39068, 0x6dc49bdc,
+        0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8, 0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb,
+        0x440b7579, 0xe27c7ecd, 0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+        0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9, 0x14340e24, 0xb2430590,
+        0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a, 0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739,
+        0x103aa7d0, 0xb64dac64, 0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+        0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342, 0xe86679df, 0x4e11726b,
+        0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f, 0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c,
+        0xec68d02b, 0x4a1fdb9f, 0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+        0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb, 0xbc57ab76, 0x1a20a0c2,
+        0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f, 0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c,
+        0xbbf9a495, 0x1d8eaf21, 0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+        0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b, 0x8c184306, 0x2a6f48b2,
+        0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6, 0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5,
+        0x47abd36e, 0xe1dcd8da, 0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+        0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae, 0x1794a833, 0xb1e3a387,
+        0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d, 0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e,
+        0x139a01c7, 0xb5ed0a73, 0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+        0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c, 0xafcdaab1, 0x09baa105,
+        0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71, 0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62,
+        0xabc30345, 0x0db408f1, 0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+        0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285, 0xfbfc7818, 0x5d8b73ac,
+        0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a, 0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899,
+        0x304fe870, 0x9638e3c4, 0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+        0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e, 0x07ae0fe3, 0xa1d90457,
+        0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23, 0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30,
+    },
+    {
+        0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64, 0xc66f0987, 0x0ac50919,
+        0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56, 0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac,
+        0x7cbb312b, 0xb01131b5, 0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+        0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa, 0x69312319, 0xa59b2387,
+        0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5, 0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f,
+        0x2a9379e3, 0xe639797d, 0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+        0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19, 0x43a25afa, 0x8f085a64,
+        0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b, 0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1,
+        0x299dc2ed, 0xe537c273, 0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+        0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c, 0x3c17d0df, 0xf0bdd041,
+        0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425, 0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf,
+        0x86c3e873, 0x4a69e8ed, 0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+        0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf, 0x1684a93c, 0xda2ea9a2,
+        0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced, 0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217,
+        0xac509190, 0x60fa910e, 0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+        0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441, 0xb9da83a2, 0x7570833c,
+        0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239, 0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3,
+        0x80de9e6f, 0x4c749ef1, 0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+        0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95, 0xe9efbd76, 0x2545bde8,
+        0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7, 0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d,
+        0xaa4de78c, 0x66e7e712, 0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+        0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d, 0xbfc7f5be, 0x736df520,
+        0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144, 0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe,
+        0x0513cd12, 0xc9b9cd8c, 0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+        0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953, 0xbcc94eb0, 0x70634e2e,
+        0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61, 0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b,
+        0x061d761c, 0xcab77682, 0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+        0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd, 0x1397642e, 0xdf3d64b0,
+        0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282, 0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78,
+        0x50353ed4, 0x9c9f3e4a, 0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+        0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e, 0x39041dcd, 0xf5ae1d53,
+        0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c, 0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6,
+    },
+};
 
-    const char *sign = "";
-    if (options.show_sign)
+static const u32 crc32c__table[8][256] = {
     {
-        sign = time_in_seconds < 0 ? "+" : "-";
-    }
+        0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
+        0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24,
+        0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+        0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc, 0xbc267848, 0x4e4dfb4b,
+        0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+        0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+        0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59, 0xe4292d5a,
+        0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a, 0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595,
+        0x417b1dbc, 0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+        0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+        0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38,
+        0xdbfc821c, 0x2997011f, 0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+        0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789,
+        0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46,
+        0x7198540d, 0x83f3d70e, 0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+        0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de, 0xdde0eb2a, 0x2f8b6829,
+        0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93,
+        0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+        0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b, 0xb4091bff, 0x466298fc,
+        0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+        0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+        0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81, 0xfc588982,
+        0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d, 0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622,
+        0x38cc2a06, 0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+        0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+        0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0,
+        0xd3d3e1ab, 0x21b862a8, 0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+        0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f,
+        0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1,
+        0x69e9f0d5, 0x9b8273d6, 0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+        0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69, 0xd5cf889d, 0x27a40b9e,
+        0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+    },
+    {
+        0x00000000, 0x13a29877, 0x274530ee, 0x34e7a899, 0x4e8a61dc, 0x5d28f9ab, 0x69cf5132, 0x7a6dc945,
+        0x9d14c3b8, 0x8eb65bcf, 0xba51f356, 0xa9f36b21, 0xd39ea264, 0xc03c3a13, 0xf4db928a, 0xe7790afd,
+        0x3fc5f181, 0x2c6769f6, 0x1880c16f, 0x0b225918, 0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4,
+        0xa2d13239, 0xb173aa4e, 0x859402d7, 0x96369aa0, 0xec5b53e5, 0xfff9cb92, 0xcb1e630b, 0xd8bcfb7c,
+        0x7f8be302, 0x6c297b75, 0x58ced3ec, 0x4b6c4b9b, 0x310182de, 0x22a31aa9, 0x1644b230, 0x05e62a47,
+        0xe29f20ba, 0xf13db8cd, 0xc5da1054, 0xd6788823, 0xac154166, 0xbfb7d911, 0x8b507188, 0x98f2e9ff,
+        0x404e1283, 0x53ec8af4, 0x670b226d, 0x74a9ba1a, 0x0ec4735f, 0x1d66eb28, 0x298143b1, 0x3a23dbc6,
+        0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2, 0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e,
+        0xff17c604, 0xecb55e73, 0xd852f6ea, 0xcbf06e9d, 0xb19da7d8, 0xa23f3faf, 0x96d89736, 0x857a0f41,
+        0x620305bc, 0x71a19dcb, 0x45463552, 0x56e4ad25, 0x2c896460, 0x3f2bfc17, 0x0bcc548e, 0x186eccf9,
+        0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c, 0x8e585659, 0x9dface2e, 0xa91d66b7, 0xbabffec0,
+        0x5dc6f43d, 0x4e646c4a, 0x7a83c4d3, 0x69215ca4, 0x134c95e1, 0x00ee0d96, 0x3409a50f, 0x27ab3d78,
+        0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f, 0xce1644da, 0xddb4dcad, 0xe9537434, 0xfaf1ec43,
+        0x1d88e6be, 0x0e2a7ec9, 0x3acdd650, 0x296f4e27, 0x53028762, 0x40a01f15, 0x7447b78c, 0x67e52ffb,
+        0xbf59d487, 0xacfb4cf0, 0x981ce469, 0x8bbe7c1e, 0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+        0x224d173f, 0x31ef8f48, 0x050827d1, 0x16aabfa6, 0x6cc776e3, 0x7f65ee94, 0x4b82460d, 0x5820de7a,
+        0xfbc3faf9, 0xe861628e, 0xdc86ca17, 0xcf245260, 0xb5499b25, 0xa6eb0352, 0x920cabcb, 0x81ae33bc,
+        0x66d73941, 0x7575a136, 0x419209af, 0x523091d8, 0x285d589d, 0x3bffc0ea, 0x0f186873, 0x1cbaf004,
+        0xc4060b78, 0xd7a4930f, 0xe3433b96, 0xf0e1a3e1, 0x8a8c6aa4, 0x992ef2d3, 0xadc95a4a, 0xbe6bc23d,
+        0x5912c8c0, 0x4ab050b7, 0x7e57f82e, 0x6df56059, 0x1798a91c, 0x043a316b, 0x30dd99f2, 0x237f0185,
+        0x844819fb, 0x97ea818c, 0xa30d2915, 0xb0afb162, 0xcac27827, 0xd960e050, 0xed8748c9, 0xfe25d0be,
+        0x195cda43, 0x0afe4234, 0x3e19eaad, 0x2dbb72da, 0x57d6bb9f, 0x447423e8, 0x70938b71, 0x63311306,
+        0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3, 0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f,
+        0x26992bc2, 0x353bb3b5, 0x01dc1b2c, 0x127e835b, 0x68134a1e, 0x7bb1d269, 0x4f567af0, 0x5cf4e287,
+        0x04d43cfd, 0x1776a48a, 0x23910c13, 0x30339464, 0x4a5e5d21, 0x59fcc556, 0x6d1b6dcf, 0x7eb9f5b8,
+        0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc, 0xd74a9e99, 0xc4e806ee, 0xf00fae77, 0xe3ad3600,
+        0x3b11cd7c, 0x28b3550b, 0x1c54fd92, 0x0ff665e5, 0x759baca0, 0x663934d7, 0x52de9c4e, 0x417c0439,
+        0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d, 0xe88f6f18, 0xfb2df76f, 0xcfca5ff6, 0xdc68c781,
+        0x7b5fdfff, 0x68fd4788, 0x5c1aef11, 0x4fb87766, 0x35d5be23, 0x26772654, 0x12908ecd, 0x013216ba,
+        0xe64b1c47, 0xf5e98430, 0xc10e2ca9, 0xd2acb4de, 0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+        0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7, 0x0a104fa2, 0x19b2d7d5, 0x2d557f4c, 0x3ef7e73b,
+        0xd98eedc6, 0xca2c75b1, 0xfecbdd28, 0xed69455f, 0x97048c1a, 0x84a6146d, 0xb041bcf4, 0xa3e32483,
+    },
+    {
+        0x00000000, 0xa541927e, 0x4f6f520d, 0xea2ec073, 0x9edea41a, 0x3b9f3664, 0xd1b1f617, 0x74f06469,
+        0x38513ec5, 0x9d10acbb, 0x773e6cc8, 0xd27ffeb6, 0xa68f9adf, 0x03ce08a1, 0xe9e0c8d2, 0x4ca15aac,
+        0x70a27d8a, 0xd5e3eff4, 0x3fcd2f87, 0x9a8cbdf9, 0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x045219e3,
+        0x48f3434f, 0xedb2d131, 0x079c1142, 0xa2dd833c, 0xd62de755, 0x736c752b, 0x9942b558, 0x3c032726,
+        0xe144fb14, 0x4405696a, 0xae2ba919, 0x0b6a3b67, 0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d,
+        0xd915c5d1, 0x7c5457af, 0x967a97dc, 0x333b05a2, 0x47cb61cb, 0xe28af3b5, 0x08a433c6, 0xade5a1b8,
+        0x91e6869e, 0x34a714e0, 0xde89d493, 0x7bc846ed, 0x0f382284, 0xaa79b0fa, 0x40577089, 0xe516e2f7,
+        0xa9b7b85b, 0x0cf62a25, 0xe6d8ea56, 0x43997828, 0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32,
+        0xc76580d9, 0x622412a7, 0x880ad2d4, 0x2d4b40aa, 0x59bb24c3, 0xfcfab6bd, 0x16d476ce, 0xb395e4b0,
+        0xff34be1c, 0x5a752c62, 0xb05bec11, 0x151a7e6f, 0x61ea1a06, 0xc4ab8878, 0x2e85480b, 0x8bc4da75,
+        0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20, 0x29195949, 0x8c58cb37, 0x66760b44, 0xc337993a,
+        0x8f96c396, 0x2ad751e8, 0xc0f9919b, 0x65b803e5, 0x1148678c, 0xb409f5f2, 0x5e273581, 0xfb66a7ff,
+        0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe, 0xb8ffdfd7, 0x1dbe4da9, 0xf7908dda, 0x52d11fa4,
+        0x1e704508, 0xbb31d776, 0x511f1705, 0xf45e857b, 0x80aee112, 0x25ef736c, 0xcfc1b31f, 0x6a802161,
+        0x56830647, 0xf3c29439, 0x19ec544a, 0xbcadc634, 0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+        0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1, 0xf00c9c98, 0x554d0ee6, 0xbf63ce95, 0x1a225ceb,
+        0x8b277743, 0x2e66e53d, 0xc448254e, 0x6109b730, 0x15f9d359, 0xb0b84127, 0x5a968154, 0xffd7132a,
+        0xb3764986, 0x1637dbf8, 0xfc191b8b, 0x595889f5, 0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def,
+        0xfb850ac9, 0x5ec498b7, 0xb4ea58c4, 0x11abcaba, 0x655baed3, 0xc01a3cad, 0x2a34fcde, 0x8f756ea0,
+        0xc3d4340c, 0x6695a672, 0x8cbb6601, 0x29faf47f, 0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065,
+        0x6a638c57, 0xcf221e29, 0x250cde5a, 0x804d4c24, 0xf4bd284d, 0x51fcba33, 0xbbd27a40, 0x1e93e83e,
+        0x5232b292, 0xf77320ec, 0x1d5de09f, 0xb81c72e1, 0xccec1688, 0x69ad84f6, 0x83834485, 0x26c2d6fb,
+        0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae, 0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4,
+        0x2290cf18, 0x87d15d66, 0x6dff9d15, 0xc8be0f6b, 0xbc4e6b02, 0x190ff97c, 0xf321390f, 0x5660ab71,
+        0x4c42f79a, 0xe90365e4, 0x032da597, 0xa66c37e9, 0xd29c5380, 0x77ddc1fe, 0x9df3018d, 0x38b293f3,
+        0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c, 0xeacd6d45, 0x4f8cff3b, 0xa5a23f48, 0x00e3ad36,
+        0x3ce08a10, 0x99a1186e, 0x738fd81d, 0xd6ce4a63, 0xa23e2e0a, 0x077fbc74, 0xed517c07, 0x4810ee79,
+        0x04b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6, 0x9a6f10cf, 0x3f2e82b1, 0xd50042c2, 0x7041d0bc,
+        0xad060c8e, 0x08479ef0, 0xe2695e83, 0x4728ccfd, 0x33d8a894, 0x96993aea, 0x7cb7fa99, 0xd9f668e7,
+        0x9557324b, 0x3016a035, 0xda386046, 0x7f79f238, 0x0b899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+        0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177, 0x437ad51e, 0xe63b4760, 0x0c158713, 0xa954156d,
+        0xe5f54fc1, 0x40b4ddbf, 0xaa9a1dcc, 0x0fdb8fb2, 0x7b2bebdb, 0xde6a79a5, 0x3444b9d6, 0x91052ba8,
+    },
+    {
+        0x00000000, 0xdd45aab8, 0xbf672381, 0x62228939, 0x7b2231f3, 0xa6679b4b, 0xc4451272, 0x1900b8ca,
+        0xf64463e6, 0x2b01c95e, 0x49234067, 0x9466eadf, 0x8d665215, 0x5023f8ad, 0x32017194, 0xef44db2c,
+        0xe964b13d, 0x34211b85, 0x560392bc, 0x8b463804, 0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7,
+        0x1f20d2db, 0xc2657863, 0xa047f15a, 0x7d025be2, 0x6402e328, 0xb9474990, 0xdb65c0a9, 0x06206a11,
+        0xd725148b, 0x0a60be33, 0x6842370a, 0xb5079db2, 0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41,
+        0x2161776d, 0xfc24ddd5, 0x9e0654ec, 0x4343fe54, 0x5a43469e, 0x8706ec26, 0xe524651f, 0x3861cfa7,
+        0x3e41a5b6, 0xe3040f0e, 0x81268637, 0x5c632c8f, 0x45639445, 0x98263efd, 0xfa04b7c4, 0x27411d7c,
+        0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69, 0xb327f7a3, 0x6e625d1b, 0x0c40d422, 0xd1057e9a,
+        0xaba65fe7, 0x76e3f55f, 0x14c17c66, 0xc984d6de, 0xd0846e14, 0x0dc1c4ac, 0x6fe34d95, 0xb2a6e72d,
+        0x5de23c01, 0x80a796b9, 0xe2851f80, 0x3fc0b538, 0x26c00df2, 0xfb85a74a, 0x99a72e73, 0x44e284cb,
+        0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3, 0x39e0df29, 0xe4a57591, 0x8687fca8, 0x5bc25610,
+        0xb4868d3c, 0x69c32784, 0x0be1aebd, 0xd6a40405, 0xcfa4bccf, 0x12e11677, 0x70c39f4e, 0xad8635f6,
+        0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255, 0x07a17a9f, 0xdae4d027, 0xb8c6591e, 0x6583f3a6,
+        0x8ac7288a, 0x57828232, 0x35a00b0b, 0xe8e5a1b3, 0xf1e51979, 0x2ca0b3c1, 0x4e823af8, 0x93c79040,
+        0x95e7fa51, 0x48a250e9, 0x2a80d9d0, 0xf7c57368, 0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+        0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x0181108e, 0x1881a844, 0xc5c402fc, 0xa7e68bc5, 0x7aa3217d,
+        0x52a0c93f, 0x8fe56387, 0xedc7eabe, 0x30824006, 0x2982f8cc, 0xf4c75274, 0x96e5db4d, 0x4ba071f5,
+        0xa4e4aad9, 0x79a10061, 0x1b838958, 0xc6c623e0, 0xdfc69b2a, 0x02833192, 0x60a1b8ab, 0xbde41213,
+        0xbbc47802, 0x6681d2ba, 0x04a35b83, 0xd9e6f13b, 0xc0e649f1, 0x1da3e349, 0x7f816a70, 0xa2c4c0c8,
+        0x4d801be4, 0x90c5b15c, 0xf2e73865, 0x2fa292dd, 0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e,
+        0x8585ddb4, 0x58c0770c, 0x3ae2fe35, 0xe7a7548d, 0xfea7ec47, 0x23e246ff, 0x41c0cfc6, 0x9c85657e,
+        0x73c1be52, 0xae8414ea, 0xcca69dd3, 0x11e3376b, 0x08e38fa1, 0xd5a62519, 0xb784ac20, 0x6ac10698,
+        0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0x0ec3e5b0, 0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443,
+        0x9aa50f6f, 0x47e0a5d7, 0x25c22cee, 0xf8878656, 0xe1873e9c, 0x3cc29424, 0x5ee01d1d, 0x83a5b7a5,
+        0xf90696d8, 0x24433c60, 0x4661b559, 0x9b241fe1, 0x8224a72b, 0x5f610d93, 0x3d4384aa, 0xe0062e12,
+        0x0f42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07, 0x7460c4cd, 0xa9256e75, 0xcb07e74c, 0x16424df4,
+        0x106227e5, 0xcd278d5d, 0xaf050464, 0x7240aedc, 0x6b401616, 0xb605bcae, 0xd4273597, 0x09629f2f,
+        0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a, 0x9d0475f0, 0x4041df48, 0x22635671, 0xff26fcc9,
+        0x2e238253, 0xf36628eb, 0x9144a1d2, 0x4c010b6a, 0x5501b3a0, 0x88441918, 0xea669021, 0x37233a99,
+        0xd867e1b5, 0x05224b0d, 0x6700c234, 0xba45688c, 0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+        0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57, 0xbc65029d, 0x6120a825, 0x0302211c, 0xde478ba4,
+        0x31035088, 0xec46fa30, 0x8e647309, 0x5321d9b1, 0x4a21617b, 0x9764cbc3, 0xf54642fa, 0x2803e842,
+    },
+    {
+        0x00000000, 0x38116fac, 0x7022df58, 0x4833b0f4, 0xe045beb0, 0xd854d11c, 0x906761e8, 0xa8760e44,
+        0xc5670b91, 0xfd76643d, 0xb545d4c9, 0x8d54bb65, 0x2522b521, 0x1d33da8d, 0x55006a79, 0x6d1105d5,
+        0x8f2261d3, 0xb7330e7f, 0xff00be8b, 0xc711d127, 0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97,
+        0x4a456a42, 0x725405ee, 0x3a67b51a, 0x0276dab6, 0xaa00d4f2, 0x9211bb5e, 0xda220baa, 0xe2336406,
+        0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f, 0x539b05a3, 0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13,
+        0xdecfbec6, 0xe6ded16a, 0xaeed619e, 0x96fc0e32, 0x3e8a0076, 0x069b6fda, 0x4ea8df2e, 0x76b9b082,
+        0x948ad484, 0xac9bbb28, 0xe4a80bdc, 0xdcb96470, 0x74cf6a34, 0x4cde0598, 0x04edb56c, 0x3cfcdac0,
+        0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1, 0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151,
+        0x37516aae, 0x0f400502, 0x4773b5f6, 0x7f62da5a, 0xd714d41e, 0xef05bbb2, 0xa7360b46, 0x9f2764ea,
+        0xf236613f, 0xca270e93, 0x8214be67, 0xba05d1cb, 0x1273df8f, 0x2a62b023, 0x625100d7, 0x5a406f7b,
+        0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89, 0x5836b5cd, 0x6027da61, 0x28146a95, 0x10050539,
+        0x7d1400ec, 0x45056f40, 0x0d36dfb4, 0x3527b018, 0x9d51be5c, 0xa540d1f0, 0xed736104, 0xd5620ea8,
+        0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d, 0xccbc6149, 0xf4ad0ee5, 0xbc9ebe11, 0x848fd1bd,
+        0xe99ed468, 0xd18fbbc4, 0x99bc0b30, 0xa1ad649c, 0x09db6ad8, 0x31ca0574, 0x79f9b580, 0x41e8da2c,
+        0xa3dbbe2a, 0x9bcad186, 0xd3f96172, 0xebe80ede, 0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0x0badb06e,
+        0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f, 0x86f90b0b, 0xbee864a7, 0xf6dbd453, 0xcecabbff,
+        0x6ea2d55c, 0x56b3baf0, 0x1e800a04, 0x269165a8, 0x8ee76bec, 0xb6f60440, 0xfec5b4b4, 0xc6d4db18,
+        0xabc5decd, 0x93d4b161, 0xdbe70195, 0xe3f66e39, 0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x03b3d089,
+        0xe180b48f, 0xd991db23, 0x91a26bd7, 0xa9b3047b, 0x01c50a3f, 0x39d46593, 0x71e7d567, 0x49f6bacb,
+        0x24e7bf1e, 0x1cf6d0b2, 0x54c56046, 0x6cd40fea, 0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a,
+        0x750a600b, 0x4d1b0fa7, 0x0528bf53, 0x3d39d0ff, 0x954fdebb, 0xad5eb117, 0xe56d01e3, 0xdd7c6e4f,
+        0xb06d6b9a, 0x887c0436, 0xc04fb4c2, 0xf85edb6e, 0x5028d52a, 0x6839ba86, 0x200a0a72, 0x181b65de,
+        0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c, 0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c,
+        0x3f4f0a49, 0x075e65e5, 0x4f6dd511, 0x777cbabd, 0xdf0ab4f9, 0xe71bdb55, 0xaf286ba1, 0x9739040d,
+        0x59f3bff2, 0x61e2d05e, 0x29d160aa, 0x11c00f06, 0xb9b60142, 0x81a76eee, 0xc994de1a, 0xf185b1b6,
+        0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497, 0x7cd10ad3, 0x44c0657f, 0x0cf3d58b, 0x34e2ba27,
+        0xd6d1de21, 0xeec0b18d, 0xa6f30179, 0x9ee26ed5, 0x36946091, 0x0e850f3d, 0x46b6bfc9, 0x7ea7d065,
+        0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544, 0xf3f36b00, 0xcbe204ac, 0x83d1b458, 0xbbc0dbf4,
+        0x425b0aa5, 0x7a4a6509, 0x3279d5fd, 0x0a68ba51, 0xa21eb415, 0x9a0fdbb9, 0xd23c6b4d, 0xea2d04e1,
+        0x873c0134, 0xbf2d6e98, 0xf71ede6c, 0xcf0fb1c0, 0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+        0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82, 0x2d3cd5c6, 0x152dba6a, 0x5d1e0a9e, 0x650f6532,
+        0x081e60e7, 0x300f0f4b, 0x783cbfbf, 0x402dd013, 0xe85bde57, 0xd04ab1fb, 0x9879010f, 0xa0686ea3,
+    },
+    {
+        0x00000000, 0xef306b19, 0xdb8ca0c3, 0x34bccbda, 0xb2f53777, 0x5dc55c6e, 0x697997b4, 0x8649fcad,
+        0x6006181f, 0x8f367306, 0xbb8ab8dc, 0x54bad3c5, 0xd2f32f68, 0x3dc34471, 0x097f8fab, 0xe64fe4b2,
+        0xc00c303e, 0x2f3c5b27, 0x1b8090fd, 0xf4b0fbe4, 0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93,
+        0xa00a2821, 0x4f3a4338, 0x7b8688e2, 0x94b6e3fb, 0x12ff1f56, 0xfdcf744f, 0xc973bf95, 0x2643d48c,
+        0x85f4168d, 0x6ac47d94, 0x5e78b64e, 0xb148dd57, 0x370121fa, 0xd8314ae3, 0xec8d8139, 0x03bdea20,
+        0xe5f20e92, 0x0ac2658b, 0x3e7eae51, 0xd14ec548, 0x570739e5, 0xb83752fc, 0x8c8b9926, 0x63bbf23f,
+        0x45f826b3, 0xaac84daa, 0x9e748670, 0x7144ed69, 0xf70d11c4, 0x183d7add, 0x2c81b107, 0xc3b1da1e,
+        0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576, 0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201,
+        0x0e045beb, 0xe13430f2, 0xd588fb28, 0x3ab89031, 0xbcf16c9c, 0x53c10785, 0x677dcc5f, 0x884da746,
+        0x6e0243f4, 0x813228ed, 0xb58ee337, 0x5abe882e, 0xdcf77483, 0x33c71f9a, 0x077bd440, 0xe84bbf59,
+        0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f, 0x7cfd5ca2, 0x93cd37bb, 0xa771fc61, 0x48419778,
+        0xae0e73ca, 0x413e18d3, 0x7582d309, 0x9ab2b810, 0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e, 0x28478f67,
+        0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc, 0x39057a11, 0xd6351108, 0xe289dad2, 0x0db9b1cb,
+        0xebf65579, 0x04c63e60, 0x307af5ba, 0xdf4a9ea3, 0x5903620e, 0xb6330917, 0x828fc2cd, 0x6dbfa9d4,
+        0x4bfc7d58, 0xa4cc1641, 0x9070dd9b, 0x7f40b682, 0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+        0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d, 0x990f5230, 0x763f3929, 0x4283f2f3, 0xadb399ea,
+        0x1c08b7d6, 0xf338dccf, 0xc7841715, 0x28b47c0c, 0xaefd80a1, 0x41cdebb8, 0x75712062, 0x9a414b7b,
+        0x7c0eafc9, 0x933ec4d0, 0xa7820f0a, 0x48b26413, 0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364,
+        0xdc0487e8, 0x3334ecf1, 0x0788272b, 0xe8b84c32, 0x6ef1b09f, 0x81c1db86, 0xb57d105c, 0x5a4d7b45,
+        0xbc029ff7, 0x5332f4ee, 0x678e3f34, 0x88be542d, 0x0ef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a,
+        0x99fca15b, 0x76ccca42, 0x42700198, 0xad406a81, 0x2b09962c, 0xc439fd35, 0xf08536ef, 0x1fb55df6,
+        0xf9fab944, 0x16cad25d, 0x22761987, 0xcd46729e, 0x4b0f8e33, 0xa43fe52a, 0x90832ef0, 0x7fb345e9,
+        0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf, 0xeb05a612, 0x0435cd0b, 0x308906d1, 0xdfb96dc8,
+        0x39f6897a, 0xd6c6e263, 0xe27a29b9, 0x0d4a42a0, 0x8b03be0d, 0x6433d514, 0x508f1ece, 0xbfbf75d7,
+        0x120cec3d, 0xfd3c8724, 0xc9804cfe, 0x26b027e7, 0xa0f9db4a, 0x4fc9b053, 0x7b757b89, 0x94451090,
+        0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8, 0xc0ffc355, 0x2fcfa84c, 0x1b736396, 0xf443088f,
+        0xd200dc03, 0x3d30b71a, 0x098c7cc0, 0xe6bc17d9, 0x60f5eb74, 0x8fc5806d, 0xbb794bb7, 0x544920ae,
+        0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6, 0x00f3f36b, 0xefc39872, 0xdb7f53a8, 0x344f38b1,
+        0x97f8fab0, 0x78c891a9, 0x4c745a73, 0xa344316a, 0x250dcdc7, 0xca3da6de, 0xfe816d04, 0x11b1061d,
+        0xf7fee2af, 0x18ce89b6, 0x2c72426c, 0xc3422975, 0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+        0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154, 0xe501fdf9, 0x0a3196e0, 0x3e8d5d3a, 0xd1bd3623,
+        0x37f2d291, 0xd8c2b988, 0xec7e7252, 0x034e194b, 0x8507e5e6, 0x6a378eff, 0x5e8b4525, 0xb1bb2e3c,
+    },
+    {
+        0x00000000, 0x68032cc8, 0xd0065990, 0xb8057558, 0xa5e0c5d1, 0xcde3e919, 0x75e69c41, 0x1de5b089,
+        0x4e2dfd53, 0x262ed19b, 0x9e2ba4c3, 0xf628880b, 0xebcd3882, 0x83ce144a, 0x3bcb6112, 0x53c84dda,
+        0x9c5bfaa6, 0xf458d66e, 0x4c5da336, 0x245e8ffe, 0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f,
+        0xd27607f5, 0xba752b3d, 0x02705e65, 0x6a7372ad, 0x7796c224, 0x1f95eeec, 0xa7909bb4, 0xcf93b77c,
+        0x3d5b83bd, 0x5558af75, 0xed5dda2d, 0x855ef6e5, 0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334,
+        0x73767eee, 0x1b755226, 0xa370277e, 0xcb730bb6, 0xd696bb3f, 0xbe9597f7, 0x0690e2af, 0x6e93ce67,
+        0xa100791b, 0xc90355d3, 0x7106208b, 0x19050c43, 0x04e0bcca, 0x6ce39002, 0xd4e6e55a, 0xbce5c992,
+        0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110, 0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1,
+        0x7ab7077a, 0x12b42bb2, 0xaab15eea, 0xc2b27222, 0xdf57c2ab, 0xb754ee63, 0x0f519b3b, 0x6752b7f3,
+        0x349afa29, 0x5c99d6e1, 0xe49ca3b9, 0x8c9f8f71, 0x917a3ff8, 0xf9791330, 0x417c6668, 0x297f4aa0,
+        0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884, 0x430c380d, 0x2b0f14c5, 0x930a619d, 0xfb094d55,
+        0xa8c1008f, 0xc0c22c47, 0x78c7591f, 0x10c475d7, 0x0d21c55e, 0x6522e996, 0xdd279cce, 0xb524b006,
+        0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f, 0xe20c4116, 0x8a0f6dde, 0x320a1886, 0x5a09344e,
+        0x09c17994, 0x61c2555c, 0xd9c72004, 0xb1c40ccc, 0xac21bc45, 0xc422908d, 0x7c27e5d5, 0x1424c91d,
+        0xdbb77e61, 0xb3b452a9, 0x0bb127f1, 0x63b20b39, 0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+        0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a, 0x307a46e3, 0x58796a2b, 0xe07c1f73, 0x887f33bb,
+        0xf56e0ef4, 0x9d6d223c, 0x25685764, 0x4d6b7bac, 0x508ecb25, 0x388de7ed, 0x808892b5, 0xe88bbe7d,
+        0xbb43f3a7, 0xd340df6f, 0x6b45aa37, 0x034686ff, 0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e,
+        0x6935f452, 0x0136d89a, 0xb933adc2, 0xd130810a, 0xccd53183, 0xa4d61d4b, 0x1cd36813, 0x74d044db,
+        0x27180901, 0x4f1b25c9, 0xf71e5091, 0x9f1d7c59, 0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988,
+        0xc8358d49, 0xa036a181, 0x1833d4d9, 0x7030f811, 0x6dd54898, 0x05d66450, 0xbdd31108, 0xd5d03dc0,
+        0x8618701a, 0xee1b5cd2, 0x561e298a, 0x3e1d0542, 0x23f8b5cb, 0x4bfb9903, 0xf3feec5b, 0x9bfdc093,
+        0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7, 0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766,
+        0x1a438abc, 0x7240a674, 0xca45d32c, 0xa246ffe4, 0xbfa34f6d, 0xd7a063a5, 0x6fa516fd, 0x07a63a35,
+        0x8fd9098e, 0xe7da2546, 0x5fdf501e, 0x37dc7cd6, 0x2a39cc5f, 0x423ae097, 0xfa3f95cf, 0x923cb907,
+        0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185, 0x6414310c, 0x0c171dc4, 0xb412689c, 0xdc114454,
+        0x1382f328, 0x7b81dfe0, 0xc384aab8, 0xab878670, 0xb66236f9, 0xde611a31, 0x66646f69, 0x0e6743a1,
+        0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23, 0xf84fcbaa, 0x904ce762, 0x2849923a, 0x404abef2,
+        0xb2828a33, 0xda81a6fb, 0x6284d3a3, 0x0a87ff6b, 0x17624fe2, 0x7f61632a, 0xc7641672, 0xaf673aba,
+        0xfcaf7760, 0x94ac5ba8, 0x2ca92ef0, 0x44aa0238, 0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+        0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd, 0x8b39b544, 0xe33a998c, 0x5b3fecd4, 0x333cc01c,
+        0x60f48dc6, 0x08f7a10e, 0xb0f2d456, 0xd8f1f89e, 0xc5144817, 0xad1764df, 0x15121187, 0x7d113d4f,
+    },
+    {
+        0x00000000, 0x493c7d27, 0x9278fa4e, 0xdb448769, 0x211d826d, 0x6821ff4a, 0xb3657823, 0xfa590504,
+        0x423b04da, 0x0b0779fd, 0xd043fe94, 0x997f83b3, 0x632686b7, 0x2a1afb90, 0xf15e7cf9, 0xb86201de,
+        0x847609b4, 0xcd4a7493, 0x160ef3fa, 0x5f328edd, 0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0,
+        0xc64d0d6e, 0x8f717049, 0x5435f720, 0x1d098a07, 0xe7508f03, 0xae6cf224, 0x7528754d, 0x3c14086a,
+        0x0d006599, 0x443c18be, 0x9f789fd7, 0xd644e2f0, 0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d,
+        0x4f3b6143, 0x06071c64, 0xdd439b0d, 0x947fe62a, 0x6e26e32e, 0x271a9e09, 0xfc5e1960, 0xb5626447,
+        0x89766c2d, 0xc04a110a, 0x1b0e9663, 0x5232eb44, 0xa86bee40, 0xe1579367, 0x3a13140e, 0x732f6929,
+        0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e, 0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3,
+        0x1a00cb32, 0x533cb615, 0x8878317c, 0xc1444c5b, 0x3b1d495f, 0x72213478, 0xa965b311, 0xe059ce36,
+        0x583bcfe8, 0x1107b2cf, 0xca4335a6, 0x837f4881, 0x79264d85, 0x301a30a2, 0xeb5eb7cb, 0xa262caec,
+        0x9e76c286, 0xd74abfa1, 0x0c0e38c8, 0x453245ef, 0xbf6b40eb, 0xf6573dcc, 0x2d13baa5, 0x642fc782,
+        0xdc4dc65c, 0x9571bb7b, 0x4e353c12, 0x07094135, 0xfd504431, 0xb46c3916, 0x6f28be7f, 0x2614c358,
+        0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2, 0x361d2cc6, 0x7f2151e1, 0xa465d688, 0xed59abaf,
+        0x553baa71, 0x1c07d756, 0xc743503f, 0x8e7f2d18, 0x7426281c, 0x3d1a553b, 0xe65ed252, 0xaf62af75,
+        0x9376a71f, 0xda4ada38, 0x010e5d51, 0x48322076, 0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+        0xd14da3c5, 0x9871dee2, 0x4335598b, 0x0a0924ac, 0xf05021a8, 0xb96c5c8f, 0x6228dbe6, 0x2b14a6c1,
+        0x34019664, 0x7d3deb43, 0xa6796c2a, 0xef45110d, 0x151c1409, 0x5c20692e, 0x8764ee47, 0xce589360,
+        0x763a92be, 0x3f06ef99, 0xe44268f0, 0xad7e15d7, 0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba,
+        0xb0779fd0, 0xf94be2f7, 0x220f659e, 0x6b3318b9, 0x916a1dbd, 0xd856609a, 0x0312e7f3, 0x4a2e9ad4,
+        0xf24c9b0a, 0xbb70e62d, 0x60346144, 0x29081c63, 0xd3511967, 0x9a6d6440, 0x4129e329, 0x08159e0e,
+        0x3901f3fd, 0x703d8eda, 0xab7909b3, 0xe2457494, 0x181c7190, 0x51200cb7, 0x8a648bde, 0xc358f6f9,
+        0x7b3af727, 0x32068a00, 0xe9420d69, 0xa07e704e, 0x5a27754a, 0x131b086d, 0xc85f8f04, 0x8163f223,
+        0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20, 0x9c6a7824, 0xd5560503, 0x0e12826a, 0x472eff4d,
+        0xff4cfe93, 0xb67083b4, 0x6d3404dd, 0x240879fa, 0xde517cfe, 0x976d01d9, 0x4c2986b0, 0x0515fb97,
+        0x2e015d56, 0x673d2071, 0xbc79a718, 0xf545da3f, 0x0f1cdf3b, 0x4620a21c, 0x9d642575, 0xd4585852,
+        0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5, 0x4d27dbe1, 0x041ba6c6, 0xdf5f21af, 0x96635c88,
+        0xaa7754e2, 0xe34b29c5, 0x380faeac, 0x7133d38b, 0x8b6ad68f, 0xc256aba8, 0x19122cc1, 0x502e51e6,
+        0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751, 0xc951d255, 0x806daf72, 0x5b29281b, 0x1215553c,
+        0x230138cf, 0x6a3d45e8, 0xb179c281, 0xf845bfa6, 0x021cbaa2, 0x4b20c785, 0x906440ec, 0xd9583dcb,
+        0x613a3c15, 0x28064132, 0xf342c65b, 0xba7ebb7c, 0x4027be78, 0x091bc35f, 0xd25f4436, 0x9b633911,
+        0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612, 0x866ab316, 0xcf56ce31, 0x14124958, 0x5d2e347f,
+        0xe54c35a1, 0xac704886, 0x7734cfef, 0x3e08b2c8, 0xc451b7cc, 0x8d6dcaeb, 0x56294d82, 0x1f1530a5,
+    },
+};
 
-    if (options.show_hours)
+force_inline function u32 crc__read_u32(u8 const *at)
+{
+    u32 result;
+    MemoryCopy(&result, at, sizeof(result));
+    if (ARCH_BIG_ENDIAN) result = endian_swap_u32(result);
+    return result;
+}
+
+function u32 crc__slice8(u32 crc, const u32 (*table)[256], u8 const *at, i64 len)
+{
+    for (; len >= 8; len -= 8, at += 8)
     {
-        return sprint("%s%02d:%02d:%02d", sign,h,m,s);
+        u32 lo = crc ^ crc__read_u32(at);
+        u32 hi = crc__read_u32(at + 4);
+        crc = table[7][lo & 0xff] ^ table[6][(lo >> 8) & 0xff] ^ table[5][(lo >> 16) & 0xff] ^ table[4][lo >> 24] ^
+              table[3][hi & 0xff] ^ table[2][(hi >> 8) & 0xff] ^ table[1][(hi >> 16) & 0xff] ^ table[0][hi >> 24];
     }
 
-    m += h * 60.0;
-
-    if (options.show_miliseconds)
+    for (; len > 0; len -= 1, at += 1)
     {
-        return sprint("%s%02d:%02d:%03d", sign,m,s,ms);
+        crc = (crc >> 8) ^ table[0][(crc ^ *at) & 0xff];
     }
 
-    return sprint("%s%02d:%02d", sign,m,s);
+    return crc;
 }
 
-//
-// CLI
-//
-
-function String_Array string_array_from_c_array(Arena *arena, char **data, int count)
+function u32 crc32_update(u32 crc, void const *data, i64 len)
 {
-    String_Array result = {0};
-    result.data = PushArrayZero(arena, String, count);
+    u8 const *at = (u8 const *)data;
+    crc = ~crc;
 
-    for (int i = 0; i < count; i += 1)
+    #if ARCH_ARM_CRC32
+    for (; len >= 8; len -= 8, at += 8)
     {
-        assert(result.count < count);
-        result.data[result.count] = string_push(arena, string_from_cstr(data[i]));
-        result.count += 1;
+        u64 chunk;
+        MemoryCopy(&chunk, at, sizeof(chunk));
+        crc = __crc32d(crc, chunk);
     }
+    for (; len > 0; len -= 1, at += 1)
+    {
+        crc = __crc32b(crc, *at);
+    }
+    #else
+    crc = crc__slice8(crc, crc32__table, at, len);
+    #endif
 
-    return result;
+    return ~crc;
 }
 
-function CLI_Argument string_parse_argument(String_Array array, i64 index)
+function u32 crc32c_update(u32 crc, void const *data, i64 len)
 {
-    CLI_Argument result = {0};
-
-    String key = array.data[index];
-    String val = S("");
+    u8 const *at = (u8 const *)data;
+    crc = ~crc;
 
-    bool consumes_next_index = false;
-    i64 equals = string_index(key, S("="), 0);
-    if (equals >= 0)
+    #if ARCH_SSE42 && ARCH_X64
+    u64 crc64 = crc;
+    for (; len >= 8; len -= 8, at += 8)
     {
-        String str = key;
-        key = string_slice(str, 0, equals);
-        val = string_slice(str, equals+1, str.count);
+        u64 chunk;
+        MemoryCopy(&chunk, at, sizeof(chunk));
+        crc64 = _mm_crc32_u64(crc64, chunk);
     }
-    else if (string_starts_with(key, S("-")))
+    crc = (u32)crc64;
+    for (; len > 0; len -= 1, at += 1)
     {
-        if (index < array.count-1)
-        {
-            String maybe_val = array.data[index+1];
-            if (!string_starts_with(maybe_val, S("-")))
-            {
-                consumes_next_index = true;
-                val = maybe_val;
-            }
-        }
+        crc = _mm_crc32_u8(crc, *at);
     }
-
-    // NOTE(nick): normalize all options to start with a single -
-    if (string_starts_with(key, S("--")))
+    #elif ARCH_ARM_CRC32
+    for (; len >= 8; len -= 8, at += 8)
     {
-        key = string_skip(key, 1);
+        u64 chunk;
+        MemoryCopy(&chunk, at, sizeof(chunk));
+        crc = __crc32cd(crc, chunk);
+    }
+    for (; len > 0; len -= 1, at += 1)
+    {
+        crc = __crc32cb(crc, *at);
     }
+    #else
+    crc = crc__slice8(crc, crc32c__table, at, len);
+    #endif
 
-    result.name = key;
-    result.value = val;
-    result.consumes_next_index = consumes_next_index;
-    return result;
+    return ~crc;
 }
 
-function bool string_is_option(CLI_Argument arg)
+function u32 crc32(void const *data, i64 len)
 {
-    return string_starts_with(arg.name, S("-"));
+    return crc32_update(0, data, len);
 }
 
-function bool string_option_match(String arg_name, String name, String alias)
+function u32 crc32c(void const *data, i64 len)
 {
-    if (!string_starts_with(name, S("-"))) name = string_concat2(temp_arena(), S("-"), name);
-    if (alias.count > 0 && !string_starts_with(alias, S("-"))) alias = string_concat2(temp_arena(), S("-"), alias);
-
-    return string_equals(arg_name, name) || (alias.count > 0 && string_equals(arg_name, alias));
+    return crc32c_update(0, data, len);
 }
 
-function void cli_option_parse_bool(CLI_Argument arg, String name, String alias, b32 *value)
+// NOTE(nick): 5552 is the most bytes that can be summed before b can overflow 32 bits
+#define ADLER32_MOD 65521
+#define ADLER32_NMAX 5552
+
+function u32 adler32_update(u32 adler, void const *data, i64 len)
 {
-    if (string_option_match(arg.name, name, alias))
-    {
-        if (arg.value.count) *value = string_to_b32(arg.value);
-        else *value = true;
-    }
-}
+    u8 const *at = (u8 const *)data;
+    u32 a = adler & 0xffff;
+    u32 b = adler >> 16;
 
-//
-// String Conversions
-//
+    while (len > 0)
+    {
+        i64 n = Min(len, ADLER32_NMAX);
+        len -= n;
 
-function String b32_to_string(b32 x)   { if (x) return S("true"); return S("false"); }
-function String char_to_string(char x) { return sprint("%c", x); }
-function String cstr_to_string(char *x) { return string_from_cstr(x); }
-function String int_to_string(int x) { return sprint("%d", x); }
-function String i64_to_string(i64 x) { return sprint("%lld", x); }
-function String u64_to_string(u64 x) { return sprint("%llu", x); }
-function String f32_to_string(f32 x) { return sprint("%.2f", x); }
-function String f64_to_string(f64 x) { return sprint("%.4f", x); }
-function String ptr_to_string(void *x) { return sprint("%p", x); }
-function String String_to_string(String x) { return x; }
+        for (; n >= 8; n -= 8, at += 8)
+        {
+            a += at[0]; b += a;
+            a += at[1]; b += a;
+            a += at[2]; b += a;
+            a += at[3]; b += a;
+            a += at[4]; b += a;
+            a += at[5]; b += a;
+            a += at[6]; b += a;
+            a += at[7]; b += a;
+        }
+        for (; n > 0; n -= 1, at += 1)
+        {
+            a += *at; b += a;
+        }
 
-#if LANG_CPP
+        a %= ADLER32_MOD;
+        b %= ADLER32_MOD;
+    }
 
-function String to_string(bool x)   { return b32_to_string(x); }
-function String to_string(char x)   { return char_to_string(x); }
-function String to_string(char *x)  { return cstr_to_string(x); }
-function String to_string(i8 x)     { return int_to_string(x); }
-function String to_string(u8 x)     { return int_to_string(x); }
-function String to_string(i16 x)    { return int_to_string(x); }
-function String to_string(u16 x)    { return int_to_string(x); }
-function String to_string(i32 x)    { return int_to_string(x); }
-function String to_string(u32 x)    { return int_to_string(x); }
-function String to_string(i64 x)    { return i64_to_string(x); }
-function String to_string(u64 x)    { return u64_to_string(x); }
-function String to_string(f32 x)    { return f32_to_string(x); }
-function String to_string(f64 x)    { return f64_to_string(x); }
-function String to_string(void *x)  { return ptr_to_string(x); }
-function String to_string(String x) { return String_to_string(x); }
+    return (b << 16) | a;
+}
 
-#else
+function u32 adler32(void const *data, i64 len)
+{
+    return adler32_update(1, data, len);
+}
 
-#define Array__to_string
-#define Math__to_string
+function u32 crc32_from_string(String str)
+{
+    return crc32(str.data, str.count);
+}
 
-#define to_string(x) _Generic((x), \
-    bool: b32_to_string, \
-    char: char_to_string, \
-    int: int_to_string, \
-    f32: f32_to_string, \
-    f64: f64_to_string, \
-    void*: ptr_to_string, \
-    String: String_to_string, \
-    Array__to_string Math__to_string default: S("<Unknown>") \
-)( (x) )
+function u32 crc32c_from_string(String str)
+{
+    return crc32c(str.data, str.count);
+}
 
-#endif // LANG_CPP
+function u32 adler32_from_string(String str)
+{
+    return adler32(str.data, str.count);
+}
 
 //
-// Functions
+// Random
 //
 
-function b32 is_power_of_two(i64 x) {
-    return (x & (x - 1)) == 0;
-}
+function Random_LCG random_make_lcg()
+{
+    Random_LCG result = {0};
 
-// NOTE(nick): if x is already a power of two this function just returns x
-function u64 u64_next_power_of_two(u64 x) {
-    if (x == 0) return 1;
+    f64 time = os_time();
+    u64 seed =  *(u64 *)&time;
+    random_lcg_set_seed(&result, (u32)seed);
 
-    --x;
-    x |= x >> 1;
-    x |= x >> 2;
-    x |= x >> 4;
-    x |= x >> 8;
-    x |= x >> 16;
-    x |= x >> 32;
+    return result;
+}
 
-    return ++x;
+function void random_lcg_set_seed(Random_LCG *it, u32 state)
+{
+    it->state = state;
+}
+
+function u32 random_lcg_u32(Random_LCG *it)
+{
+    u32 result = (it->state * 1103515245 + 12345) & U32_MAX;
+    it->state = result;
+    return result;
 }
 
-function u64 u64_previous_power_of_two(u64 x) {
-    x |= x >> 1;
-    x |= x >> 2;
-    x |= x >> 4;
-    x |= x >> 8;
-    x |= x >> 16;
-    x |= x >> 32;
-    return x - (x >> 1);
+function f32 random_lcg_f32(Random_LCG *it) 
+{
+    f32 divisor = 1.0f / (f32)U32_MAX;
+    return divisor * (f32)random_lcg_u32(it);
 }
 
-function u16 endian_swap_u16(u16 i) {
-    return (i>>8) | (i<<8);
+function f32 random_lcg_between_f32(Random_LCG *it, f32 min, f32 max) {
+    return min + (max - min) * random_lcg_f32(it);
 }
 
-function u32 endian_swap_u32(u32 i) {
-    return (i>>24) |(i<<24) | ((i&0x00ff0000u)>>8)  | ((i&0x0000ff00u)<<8);
+function i32 random_lcg_between_i32(Random_LCG *it, i32 min, i32 max) {
+    assert(max >= min);
+    return min + (i32)(random_lcg_u32(it) % (max - min + 1));
 }
 
-function u64 endian_swap_u64(u64 i) {
-    return (i>>56) | (i<<56) |
-           ((i&0x00ff000000000000ull)>>40) | ((i&0x000000000000ff00ull)<<40) |
-           ((i&0x0000ff0000000000ull)>>24) | ((i&0x0000000000ff0000ull)<<24) |
-           ((i&0x000000ff00000000ull)>>8)  | ((i&0x00000000ff000000ull)<<8);
+function void random_lcg_shuffle(Random_LCG *it, void *base, u64 count, u64 size) {
+    u8 *at = cast(u8 *)base + (count-1) * size;
+    for (i64 i = count; i > 1; i--)
+    {
+        i64 j = random_lcg_u32(it) % i;
+        memory_swap(at, (u8 *)base + j*size, size);
+        at -= size;
+    }
 }
 
-function u16 u16_from_big_endian(u16 i)
+function Random_PCG random_make_pcg()
 {
-    return ARCH_BIG_ENDIAN ? i : endian_swap_u16(i);
+    Random_PCG result = {0};
+
+    f64 time = os_time();
+    u64 seed =  *(u64 *)&time;
+    random_pcg_set_seed(&result, seed, 6364136223846793005u);
+
+    return result;
 }
 
-function u32 u32_from_big_endian(u32 i)
+function void random_pcg_set_seed(Random_PCG *it, u64 state, u64 selector)
 {
-    return ARCH_BIG_ENDIAN ? i : endian_swap_u32(i);
+    it->state = state;
+    it->selector = (selector << 1) | 1;
 }
 
-function u64 u64_from_big_endian(u64 i)
+function u32 random_pcg_u32(Random_PCG *it)
 {
-    return ARCH_BIG_ENDIAN ? i : endian_swap_u64(i);
-}
+    u64 state = it->state;
+    state = state * 6364136223846793005ULL + it->selector;
+    it->state = state;
 
-function u32 rotate_left_u32(u32 value, i32 amount) {
-#if COMPILER_MSVC
-    u32 result = _rotl(value, amount);
-#else
-    // TODO(casey): Actually port this to other compiler platforms!
-    amount &= 31;
-    u32 result = ((value << amount) | (value >> (32 - amount)));
-#endif
+    u32 pre_rotate = (u32)((state ^ (state >> 18)) >> 27);
+    u32 result = rotate_right_u32(pre_rotate, (i32)(state >> 59));
 
     return result;
 }
 
-function u32 rotate_right_u32(u32 value, i32 amount) {
-#if COMPILER_MSVC
-    u32 result = _rotr(value, amount);
-#else
-    // TODO(casey): Actually port this to other compiler platforms!
-    amount &= 31;
-    u32 result = ((value >> amount) | (value << (32 - amount)));
-#endif
+function f32 random_pcg_f32(Random_PCG *it) 
+{
+    f32 divisor = 1.0f / (f32)U32_MAX;
+    return divisor * (f32)random_pcg_u32(it);
+}
 
-    return result;
+function f32 random_pcg_between_f32(Random_PCG *it, f32 min, f32 max) {
+    return min + (max - min) * random_pcg_f32(it);
+}
+
+function i32 random_pcg_between_i32(Random_PCG *it, i32 min, i32 max) {
+    assert(max >= min);
+    return min + (i32)(random_pcg_u32(it) % (max - min + 1));
+}
+
+function void random_pcg_shuffle(Random_PCG *it, void *base, u64 count, u64 size) {
+    u8 *at = cast(u8 *)base + (count-1) * size;
+    for (i64 i = count; i > 1; i--)
+    {
+        i64 j = random_pcg_u32(it) % i;
+        memory_swap(at, (u8 *)base + j*size, size);
+        at -= size;
+    }
 }
 
 //
-// Comparisons
+// NOTE(nick): Random_Xoshiro runs RANDOM_XOSHIRO_LANES xoshiro256+ generators next to each
+// other. The step is only adds, xors, shifts and rotates over the lane arrays, so the compiler
+// turns it into vector code and the fill functions get a whole row of numbers per step.
+// Lanes start 2^128 steps apart, and random_xoshiro_split hands out generators 2^192 steps
+// apart, one per worker thread.
+//
+// Only the top bits of xoshiro256+ are used: the lowest few bits are weak linear ones.
 //
 
-function i32 compare_i32(const void *a, const void *b)
-{
-    i32 a0 = *(i32 *)a;
-    i32 b0 = *(i32 *)b;
+#define RANDOM__XOSHIRO_BLOCK 256
 
-    return a0 - b0;
+force_inline function u64 random__rotl(u64 x, int k)
+{
+    return (x << k) | (x >> (64 - k));
 }
 
-function i64 compare_i64(const void *a, const void *b)
+force_inline function u64 random__xoshiro_next(u64 s[4])
 {
-    i64 a0 = *(i64 *)a;
-    i64 b0 = *(i64 *)b;
+    u64 result = s[0] + s[3];
+    u64 t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = random__rotl(s[3], 45);
 
-    return a0 - b0;
+    return result;
 }
 
-//
-// Hashing
-//
+#if ARCH_AVX2
+    typedef __m256i Random__U64x;
+    #define RANDOM__U64X_WIDTH 4
+    #define random__u64x_load(p)     _mm256_loadu_si256((__m256i *)(p))
+    #define random__u64x_store(p, x) _mm256_storeu_si256((__m256i *)(p), (x))
+    #define random__u64x_add(a, b)   _mm256_add_epi64((a), (b))
+    #define random__u64x_xor(a, b)   _mm256_xor_si256((a), (b))
+    #define random__u64x_shl(x, k)   _mm256_slli_epi64((x), (k))
+    #define random__u64x_shr(x, k)   _mm256_srli_epi64((x), (k))
+#elif ARCH_SSE2
+    typedef __m128i Random__U64x;
+    #define RANDOM__U64X_WIDTH 2
+    #define random__u64x_load(p)     _mm_loadu_si128((__m128i *)(p))
+    #define random__u64x_store(p, x) _mm_storeu_si128((__m128i *)(p), (x))
+    #define random__u64x_add(a, b)   _mm_add_epi64((a), (b))
+    #define random__u64x_xor(a, b)   _mm_xor_si128((a), (b))
+    #define random__u64x_shl(x, k)   _mm_slli_epi64((x), (k))
+    #define random__u64x_shr(x, k)   _mm_srli_epi64((x), (k))
+#elif ARCH_NEON
+    typedef uint64x2_t Random__U64x;
+    #define RANDOM__U64X_WIDTH 2
+    #define random__u64x_load(p)     vld1q_u64(p)
+    #define random__u64x_store(p, x) vst1q_u64((p), (x))
+    #define random__u64x_add(a, b)   vaddq_u64((a), (b))
+    #define random__u64x_xor(a, b)   veorq_u64((a), (b))
+    #define random__u64x_shl(x, k)   vshlq_n_u64((x), (k))
+    #define random__u64x_shr(x, k)   vshrq_n_u64((x), (k))
+#endif
 
-function u32 murmur32_seed(void const *data, i64 len, u32 seed) {
-    u32 const c1 = 0xcc9e2d51;
-    u32 const c2 = 0x1b873593;
-    u32 const r1 = 15;
-    u32 const r2 = 13;
-    u32 const m  = 5;
-    u32 const n  = 0xe6546b64;
+// NOTE(nick): [0, 1) from the top bits by filling in the mantissa of a number in [1, 2).
+// Unlike an integer conversion this vectorizes, for one bit less resolution.
+force_inline function f64 random__unit_f64(u64 bits)
+{
+    u64 x = (bits >> 12) | 0x3ff0000000000000ull;
+    f64 result;
+    MemoryCopy(&result, &x, sizeof(result));
+    return result - 1.0;
+}
 
-    i64 i, nblocks = len / 4;
-    u32 hash = seed, k1 = 0;
-    u32 const *blocks = cast(u32 const*)data;
-    u8 const *tail = cast(u8 const *)(data) + nblocks*4;
+force_inline function f32 random__unit_f32(u64 bits)
+{
+    u32 x = (u32)(bits >> 41) | 0x3f800000;
+    f32 result;
+    MemoryCopy(&result, &x, sizeof(result));
+    return result - 1.0f;
+}
 
-    for (i = 0; i < nblocks; i++) {
-        u32 k = blocks[i];
-        k *= c1;
-        k = (k << r1) | (k >> (32 - r1));
-        k *= c2;
+// NOTE(nick): writes rows * RANDOM_XOSHIRO_LANES numbers, lane by lane within each row
+function void random__xoshiro_rows(Random_Xoshiro *it, u64 *dest, i64 rows)
+{
+    const i64 lanes = RANDOM_XOSHIRO_LANES;
 
-        hash ^= k;
-        hash = ((hash << r2) | (hash >> (32 - r2))) * m + n;
+    #if defined(RANDOM__U64X_WIDTH)
+    #define RANDOM__VECTORS (RANDOM_XOSHIRO_LANES / RANDOM__U64X_WIDTH)
+    Random__U64x s0[RANDOM__VECTORS], s1[RANDOM__VECTORS], s2[RANDOM__VECTORS], s3[RANDOM__VECTORS];
+    for (i64 v = 0; v < RANDOM__VECTORS; v += 1)
+    {
+        s0[v] = random__u64x_load(it->s[0] + v * RANDOM__U64X_WIDTH);
+        s1[v] = random__u64x_load(it->s[1] + v * RANDOM__U64X_WIDTH);
+        s2[v] = random__u64x_load(it->s[2] + v * RANDOM__U64X_WIDTH);
+        s3[v] = random__u64x_load(it->s[3] + v * RANDOM__U64X_WIDTH);
     }
 
-    switch (len & 3) {
-    case 3:
-        k1 ^= tail[2] << 16;
-    case 2:
-        k1 ^= tail[1] << 8;
-    case 1:
-        k1 ^= tail[0];
-
-        k1 *= c1;
-        k1 = (k1 << r1) | (k1 >> (32 - r1));
-        k1 *= c2;
-        hash ^= k1;
+    // NOTE(nick): spelled out with constant indices so the state stays in registers
+    #define RANDOM__STEP(v) \
+    { \
+        random__u64x_store(dest + (v) * RANDOM__U64X_WIDTH, random__u64x_add(s0[v], s3[v])); \
+        Random__U64x t = random__u64x_shl(s1[v], 17); \
+        s2[v] = random__u64x_xor(s2[v], s0[v]); \
+        s3[v] = random__u64x_xor(s3[v], s1[v]); \
+        s1[v] = random__u64x_xor(s1[v], s2[v]); \
+        s0[v] = random__u64x_xor(s0[v], s3[v]); \
+        s2[v] = random__u64x_xor(s2[v], t); \
+        s3[v] = random__u64x_xor(random__u64x_shl(s3[v], 45), random__u64x_shr(s3[v], 19)); \
     }
 
-    hash ^= len;
-    hash ^= (hash >> 16);
-    hash *= 0x85ebca6b;
-    hash ^= (hash >> 13);
-    hash *= 0xc2b2ae35;
-    hash ^= (hash >> 16);
+    for (i64 row = 0; row < rows; row += 1, dest += lanes)
+    {
+        RANDOM__STEP(0);
+        RANDOM__STEP(1);
+        #if RANDOM__VECTORS > 2
+        RANDOM__STEP(2);
+        RANDOM__STEP(3);
+        #endif
+    }
+    #undef RANDOM__STEP
 
-    return hash;
+    for (i64 v = 0; v < RANDOM__VECTORS; v += 1)
+    {
+        random__u64x_store(it->s[0] + v * RANDOM__U64X_WIDTH, s0[v]);
+        random__u64x_store(it->s[1] + v * RANDOM__U64X_WIDTH, s1[v]);
+        random__u64x_store(it->s[2] + v * RANDOM__U64X_WIDTH, s2[v]);
+        random__u64x_store(it->s[3] + v * RANDOM__U64X_WIDTH, s3[v]);
+    }
+    #undef RANDOM__VECTORS
+    #else
+    for (i64 row = 0; row < rows; row += 1, dest += lanes)
+    {
+        for (i64 i = 0; i < lanes; i += 1)
+        {
+            u64 s[4] = {it->s[0][i], it->s[1][i], it->s[2][i], it->s[3][i]};
+            dest[i] = random__xoshiro_next(s);
+            it->s[0][i] = s[0]; it->s[1][i] = s[1]; it->s[2][i] = s[2]; it->s[3][i] = s[3];
+        }
+    }
+    #endif
 }
 
-function u64 murmur64_seed(void const *data_, i64 len, u64 seed) {
-    const u64 m = 0xc6a4a7935bd1e995ULL;
-    const int r = 47;
-
-    u64 h = seed ^ (len * m);
-
-    u64 const *data = cast(u64 const *)data_;
-    u8  const *data2 = cast(u8 const *)data_;
-    u64 const* end = data + (len / 8);
-
-    while (data != end) {
-        u64 k = *data++;
+function void random__xoshiro_jump(Random_Xoshiro *it, const u64 jump[4])
+{
+    for (i64 lane = 0; lane < RANDOM_XOSHIRO_LANES; lane += 1)
+    {
+        u64 s[4] = {it->s[0][lane], it->s[1][lane], it->s[2][lane], it->s[3][lane]};
+        u64 r[4] = {0};
 
-        k *= m;
-        k ^= k >> r;
-        k *= m;
+        for (int i = 0; i < 4; i += 1)
+        {
+            for (int b = 0; b < 64; b += 1)
+            {
+                if (jump[i] & ((u64)1 << b))
+                {
+                    r[0] ^= s[0]; r[1] ^= s[1]; r[2] ^= s[2]; r[3] ^= s[3];
+                }
+                random__xoshiro_next(s);
+            }
+        }
 
-        h ^= k;
-        h *= m;
+        it->s[0][lane] = r[0]; it->s[1][lane] = r[1]; it->s[2][lane] = r[2]; it->s[3][lane] = r[3];
     }
+}
 
-    switch (len & 7) {
-    case 7: h ^= cast(u64)(data2[6]) << 48;
-    case 6: h ^= cast(u64)(data2[5]) << 40;
-    case 5: h ^= cast(u64)(data2[4]) << 32;
-    case 4: h ^= cast(u64)(data2[3]) << 24;
-    case 3: h ^= cast(u64)(data2[2]) << 16;
-    case 2: h ^= cast(u64)(data2[1]) << 8;
-    case 1: h ^= cast(u64)(data2[0]);
-        h *= m;
-    };
+static const u64 random__xoshiro_jump_128[4] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+static const u64 random__xoshiro_jump_192[4] = {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635};
 
-    h ^= h >> r;
-    h *= m;
-    h ^= h >> r;
+function Random_Xoshiro random_make_xoshiro()
+{
+    Random_Xoshiro result = {0};
 
-    return h;
-}
+    f64 time = os_time();
+    u64 seed =  *(u64 *)&time;
+    random_xoshiro_set_seed(&result, seed);
 
-function u32 murmur32(void const *data, i64 len)
-{
-    return murmur32_seed(data, len, 0x9747b28c);
+    return result;
 }
 
-function u64 murmur64(void const *data, i64 len)
+function void random_xoshiro_set_seed(Random_Xoshiro *it, u64 seed)
 {
-    return murmur64_seed(data, len, 0x9747b28c);
-}
-
-function u32 fnv32a(void const *data, i64 len) {
-    u8 const *bytes = cast(u8 const *)data;
-    u32 h = 0x811c9dc5;
-    
-    for (; len >= 8; len -= 8, bytes += 8) {
-        h = (h ^ bytes[0]) * 0x01000193;
-        h = (h ^ bytes[1]) * 0x01000193;
-        h = (h ^ bytes[2]) * 0x01000193;
-        h = (h ^ bytes[3]) * 0x01000193;
-        h = (h ^ bytes[4]) * 0x01000193;
-        h = (h ^ bytes[5]) * 0x01000193;
-        h = (h ^ bytes[6]) * 0x01000193;
-        h = (h ^ bytes[7]) * 0x01000193;
-    }
-
-    while (len--) {
-        h = (h ^ *bytes++) * 0x01000193;
+    // NOTE(nick): splitmix64 fills the first lane, which is never all zeros
+    u64 s[4];
+    for (int i = 0; i < 4; i += 1)
+    {
+        u64 z = (seed += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        s[i] = z ^ (z >> 31);
     }
-    return h;
-}
 
-function u64 fnv64a(void const *data, i64 len) {
-    u8 const *bytes = cast(u8 const *)data;
-    u64 h = 0xcbf29ce484222325ull;
-    
-    for (; len >= 8; len -= 8, bytes += 8) {
-        h = (h ^ bytes[0]) * 0x100000001b3ull;
-        h = (h ^ bytes[1]) * 0x100000001b3ull;
-        h = (h ^ bytes[2]) * 0x100000001b3ull;
-        h = (h ^ bytes[3]) * 0x100000001b3ull;
-        h = (h ^ bytes[4]) * 0x100000001b3ull;
-        h = (h ^ bytes[5]) * 0x100000001b3ull;
-        h = (h ^ bytes[6]) * 0x100000001b3ull;
-        h = (h ^ bytes[7]) * 0x100000001b3ull;
+    for (i64 lane = 0; lane < RANDOM_XOSHIRO_LANES; lane += 1)
+    {
+        for (int i = 0; i < 4; i += 1) it->s[i][lane] = s[i];
     }
 
-    while (len--) {
-        h = (h ^ *bytes++) * 0x100000001b3ull;
+    // NOTE(nick): lane n ends up n jumps of 2^128 ahead of lane 0
+    Random_Xoshiro jumped = *it;
+    for (i64 lane = 1; lane < RANDOM_XOSHIRO_LANES; lane += 1)
+    {
+        random__xoshiro_jump(&jumped, random__xoshiro_jump_128);
+        for (int i = 0; i < 4; i += 1) it->s[i][lane] = jumped.s[i][lane];
     }
-    return h;
+
+    it->buffered = 0;
 }
 
-function u64 murmur64_from_string(String str)
+function void random_xoshiro_long_jump(Random_Xoshiro *it)
 {
-    return murmur64(str.data, str.count);
+    random__xoshiro_jump(it, random__xoshiro_jump_192);
+    it->buffered = 0;
 }
 
-function u64 fnv64a_from_string(String str)
+function Random_Xoshiro random_xoshiro_split(Random_Xoshiro *it)
 {
-    return fnv64a(str.data, str.count);
+    Random_Xoshiro result = *it;
+    result.buffered = 0;
+    random_xoshiro_long_jump(it);
+    return result;
 }
 
-
-function u32 hash_number_u32(const uint32_t offset, const uint32_t seed)
+function u64 random_xoshiro_u64(Random_Xoshiro *it)
 {
-    u32 hash = seed;
-    hash += (offset + 48);
-    hash += (hash << 10);
-    hash ^= (hash >> 6);
+    if (it->buffered == 0)
+    {
+        random__xoshiro_rows(it, it->buffer, 1);
+        it->buffered = RANDOM_XOSHIRO_LANES;
+    }
 
-    hash += (hash << 3);
-    hash ^= (hash >> 11);
-    hash += (hash << 15);
-    return hash;
+    it->buffered -= 1;
+    return it->buffer[it->buffered];
 }
 
-function u32 hash_mix_u32(u32 id, u32 number)
+function u32 random_xoshiro_u32(Random_Xoshiro *it)
 {
-    id += number;
-    id += (id << 10);
-    id ^= (id >> 6);
+    return (u32)(random_xoshiro_u64(it) >> 32);
+}
 
-    id += (id << 3);
-    id ^= (id >> 11);
-    id += (id << 15);
-    return id;
+function f32 random_xoshiro_f32(Random_Xoshiro *it)
+{
+    return random__unit_f32(random_xoshiro_u64(it));
 }
 
-//
-// Random
-//
+function f64 random_xoshiro_f64(Random_Xoshiro *it)
+{
+    return random__unit_f64(random_xoshiro_u64(it));
+}
 
-function Random_LCG random_make_lcg()
+// NOTE(nick): uniform in [0, bound) by multiply-shift, rejecting the few values that would bias it
+function u64 random_xoshiro_below(Random_Xoshiro *it, u64 bound)
 {
-    Random_LCG result = {0};
+    u64 hi;
+    u64 lo = multiply_u64_wide(random_xoshiro_u64(it), bound, &hi);
 
-    f64 time = os_time();
-    u64 seed =  *(u64 *)&time;
-    random_lcg_set_seed(&result, (u32)seed);
+    if (lo < bound)
+    {
+        u64 threshold = (0 - bound) % bound;
+        while (lo < threshold)
+        {
+            lo = multiply_u64_wide(random_xoshiro_u64(it), bound, &hi);
+        }
+    }
 
-    return result;
+    return hi;
 }
 
-function void random_lcg_set_seed(Random_LCG *it, u32 state)
-{
-    it->state = state;
+function void random_xoshiro_shuffle(Random_Xoshiro *it, void *base, u64 count, u64 size) {
+    u8 *at = cast(u8 *)base + (count-1) * size;
+    for (i64 i = count; i > 1; i--)
+    {
+        i64 j = (i64)random_xoshiro_below(it, (u64)i);
+        memory_swap(at, (u8 *)base + j*size, size);
+        at -= size;
+    }
 }
 
-function u32 random_lcg_u32(Random_LCG *it)
+function void random_xoshiro_fill_u64(Random_Xoshiro *it, u64 *dest, i64 count)
 {
-    u32 result = (it->state * 1103515245 + 12345) & U32_MAX;
-    it->state = result;
-    return result;
+    i64 rows = count / RANDOM_XOSHIRO_LANES;
+    random__xoshiro_rows(it, dest, rows);
+
+    for (i64 i = rows * RANDOM_XOSHIRO_LANES; i < count; i += 1)
+    {
+        dest[i] = random_xoshiro_u64(it);
+    }
 }
 
-function f32 random_lcg_f32(Random_LCG *it) 
+// NOTE(nick): the converting fills go through a small block so the generator loop stays the same
+#define random__xoshiro_fill_block(it, dest, count, expr) \
+    u64 block[RANDOM__XOSHIRO_BLOCK]; \
+    for (i64 at = 0; at < (count); at += RANDOM__XOSHIRO_BLOCK) \
+    { \
+        i64 n = Min((count) - at, RANDOM__XOSHIRO_BLOCK); \
+        random_xoshiro_fill_u64((it), block, n); \
+        for (i64 i = 0; i < n; i += 1) (dest)[at + i] = (expr); \
+    }
+
+function void random_xoshiro_fill_u32(Random_Xoshiro *it, u32 *dest, i64 count)
 {
-    f32 divisor = 1.0f / (f32)U32_MAX;
-    return divisor * (f32)random_lcg_u32(it);
+    random__xoshiro_fill_block(it, dest, count, (u32)(block[i] >> 32));
 }
 
-function f32 random_lcg_between_f32(Random_LCG *it, f32 min, f32 max) {
-    return min + (max - min) * random_lcg_f32(it);
+function void random_xoshiro_fill_f32(Random_Xoshiro *it, f32 *dest, i64 count)
+{
+    random__xoshiro_fill_block(it, dest, count, random__unit_f32(block[i]));
 }
 
-function i32 random_lcg_between_i32(Random_LCG *it, i32 min, i32 max) {
-    assert(max >= min);
-    return min + (i32)(random_lcg_u32(it) % (max - min + 1));
+function void random_xoshiro_fill_f64(Random_Xoshiro *it, f64 *dest, i64 count)
+{
+    random__xoshiro_fill_block(it, dest, count, random__unit_f64(block[i]));
 }
 
-function void random_lcg_shuffle(Random_LCG *it, void *base, u64 count, u64 size) {
-    u8 *at = cast(u8 *)base + (count-1) * size;
-    for (i64 i = count; i > 1; i--)
+//
+// NOTE(nick): normal and exponential samples use the 256 layer ziggurat (Marsaglia & Tsang).
+// x[i] are the layer edges with x[0] the width of the base strip, f[i] the density there.
+// About 99% of draws take one random number, a multiply and a compare.
+//
+
+//
+// NOTE(nick): the rare slow paths need exp and log. These are good to a few ulp over the
+// ranges used here and keep na.h from needing libm.
+//
+
+function f64 random__exp(f64 x)
+{
+    if (x < -700.0) return 0;
+
+    // NOTE(nick): x = k*ln2 + r with |r| <= ln2/2, ln2 split in two so r stays exact
+    f64 k = (f64)(i64)(x * 1.4426950408889634 + (x < 0 ? -0.5 : 0.5));
+    f64 r = (x - k * 6.93147180369123816490e-01) - k * 1.90821492927058770002e-10;
+
+    f64 term = 1.0, sum = 1.0;
+    for (int n = 1; n <= 13; n += 1)
     {
-        i64 j = random_lcg_u32(it) % i;
-        memory_swap(at, (u8 *)base + j*size, size);
-        at -= size;
+        term *= r / n;
+        sum += term;
     }
+
+    u64 bits = (u64)((i64)k + 1023) << 52;
+    f64 scale;
+    MemoryCopy(&scale, &bits, sizeof(scale));
+    return sum * scale;
 }
 
-function Random_PCG random_make_pcg()
+// NOTE(nick): x > 0
+function f64 random__log(f64 x)
 {
-    Random_PCG result = {0};
+    u64 bits;
+    MemoryCopy(&bits, &x, sizeof(bits));
 
-    f64 time = os_time();
-    u64 seed =  *(u64 *)&time;
-    random_pcg_set_seed(&result, seed, 6364136223846793005u);
+    i64 e = (i64)((bits >> 52) & 0x7ff) - 1023;
+    bits = (bits & 0x000fffffffffffffull) | 0x3ff0000000000000ull;
 
-    return result;
-}
+    f64 m;
+    MemoryCopy(&m, &bits, sizeof(m));
+    if (m > 1.4142135623730951)
+    {
+        m *= 0.5;
+        e += 1;
+    }
 
-function void random_pcg_set_seed(Random_PCG *it, u64 state, u64 selector)
+    // NOTE(nick): log(m) = 2 atanh(s), |s| < 0.172
+    f64 s = (m - 1.0) / (m + 1.0);
+    f64 s2 = s * s;
+    f64 term = s, sum = s;
+    for (int n = 3; n <= 23; n += 2)
+    {
+        term *= s2;
+        sum += term / n;
+    }
+
+    return (f64)e * 0.6931471805599453 + 2.0 * sum;
+}
+
+static const f64 random__normal_x[257] = {
+    3.9107579595249167, 3.6541528853610092, 3.4492782985614316, 3.320244733839826,
+    3.2245750520478023, 3.1478892895180013, 3.083526132002144, 3.027837791769594,
+    2.9786032798818436, 2.934366867208888, 2.8941210536134125, 2.857138730873225,
+    2.8228773968264433, 2.790921174001928, 2.760944005279987, 2.7326853590440123,
+    2.7059336561230634, 2.680514643285746, 2.656283037576744, 2.6331163936315836,
+    2.6109105184888244, 2.5895759867082875, 2.5690354526818444, 2.5492215503247837,
+    2.5300752321598545, 2.5115444416266945, 2.4935830412710467, 2.476149939670523,
+    2.459208374334705, 2.442725318200364, 2.4266709849371466, 2.4110184139011195,
+    2.3957431197819274, 2.3808227951720857, 2.366237056717291, 2.3519672273791445,
+    2.3379961487965284, 2.3243080188711325, 2.310888250601372, 2.2977233489028634,
+    2.284800802724492, 2.2721089902283818, 2.2596370951737876, 2.247375032947389,
+    2.235313384929921, 2.22344334009251, 2.2117566428841604, 2.200245546611276,
+    2.1889027716263603, 2.1777214677402923, 2.1666951803543077, 2.1558178198767366,
+    2.145083634047888, 2.134487182846016, 2.1240233156895227, 2.1136871506866526,
+    2.1034740557148766, 2.0933796311387916, 2.083399693998304, 2.0735302635187427,
+    2.063767547811732, 2.054107931650652, 2.0445479652175313, 2.035084353729619,
+    2.025713947863854, 2.016433734906204, 2.0072408305605287, 1.9981324713584196,
+    1.989106007617438, 1.9801588969004766, 1.9712886979336592, 1.962493064944363,
+    1.9537697423846467, 1.9451165600086784, 1.9365314282756947, 1.9280123340526658,
+    1.9195573365931882, 1.9111645637712535, 1.9028322085504297, 1.8945585256707052,
+    1.8863418285367834, 1.8781804862929965, 1.8700729210712674, 1.8620176053996749,
+    1.8540130597602025, 1.846057850285186, 1.8381505865828072, 1.8302899196827576,
+    1.8224745400938864, 1.8147031759662833, 1.8069745913508215, 1.7992875845497207,
+    1.791640986552163, 1.784033659549442, 1.7764644955245235, 1.768932414911269,
+    1.7614363653189107, 1.753975320317672, 1.7465482782817228, 1.739154261285912,
+    1.7317923140529636, 1.7244615029480455, 1.7171609150178238, 1.7098896570713025,
+    1.7026468547999238, 1.6954316519345622, 1.6882432094371962, 1.6810807047251746,
+    1.6739433309261256, 1.6668302961616661, 1.6597408228581831, 1.6526741470830566,
+    1.645629517904783, 1.6386061967755485, 1.6316034569348743, 1.6246205828330356,
+    1.6176568695730162, 1.6107116223698308, 1.6037841560260953, 1.5968737944227889,
+    1.5899798700241916, 1.58310172339603, 1.5762387027359073, 1.5693901634151246,
+    1.5625554675310458, 1.5557339834691772, 1.5489250854741743, 1.542128153229003,
+    1.5353425714415152, 1.5285677294377134, 1.5218030207609992, 1.5150478427767158,
+    1.5083015962813129, 1.501563685115465, 1.494833515780495, 1.488110497057449,
+    1.4813940396281888, 1.4746835556978568, 1.4679784586180809, 1.4612781625102769,
+    1.4545820818884116, 1.4478896312805773, 1.4412002248487252, 1.4345132760058934,
+    1.427828197030257, 1.4211443986753103, 1.4144612897754725, 1.4077782768464002,
+    1.4010947636792523, 1.3944101509281424, 1.3877238356899773, 1.3810352110758566,
+    1.3743436657731674, 1.3676485835974772, 1.3609493430332842, 1.354245316762636,
+    1.3475358711805883, 1.340820365896405, 1.334098153219361, 1.327368577627927,
+    1.3206309752210572, 1.3138846731502214, 1.307128989030732, 1.3003632303308381,
+    1.2935866937369487, 1.2867986644932445, 1.279998415713819, 1.2731852076653574,
+    1.2663582870182304, 1.2595168860637151, 1.2526602218948981, 1.245787495548628,
+    1.2388978911056883, 1.2319905747461368, 1.2250646937565315, 1.2181193754854824,
+    1.2111537262437, 1.2041668301443824, 1.1971577478794424, 1.1901255154266928,
+    1.1830691426826876, 1.1759876120154529, 1.1688798767308342, 1.1617448594456123,
+    1.1545814503599288, 1.1473885054208501, 1.1401648443681522, 1.132909248652535,
+    1.1256204592155346, 1.1182971741193461, 1.110938046013577, 1.103541679424641,
+    1.0961066278520228, 1.0886313906539813, 1.0811144097034053, 1.0735540657924376,
+    1.0659486747621238, 1.0582964833306765, 1.0505956645909313, 1.0428443131441505,
+    1.0350404398334425, 1.0271819660356476, 1.019266717465486, 1.0112924174399973,
+    1.0032566795446747, 0.9951569996350926, 0.9869907470990642, 0.9787551552942263,
+    0.9704473110642261, 0.9620641432230422, 0.9536024098810878, 0.9450586844681672,
+    0.9364293402865769, 0.9277105334020018, 0.9188981836495924, 0.9099879534967203,
+    0.9009752244612236, 0.8918550707329435, 0.8826222295851675, 0.8732710680888626,
+    0.8637955455533108, 0.8541891710081658, 0.8444449549091559, 0.8345553540863843,
+    0.8245122087522943, 0.8143066701352175, 0.8039291169899736, 0.7933690588406257,
+    0.7826150233072355, 0.7716544242245705, 0.7604734064301106, 0.749056662017818,
+    0.7373872114342983, 0.7254461409100025, 0.7132122851909788, 0.7006618411068181,
+    0.6877678927957916, 0.674499822837297, 0.660822574244423, 0.6466957148949973,
+    0.6320722363860648, 0.6168969900077552, 0.6011046177559964, 0.5846167661063835,
+    0.5673382570538232, 0.5491517023271699, 0.5299097206615632, 0.5094233296020972,
+    0.48744396613924196, 0.4636343367908887, 0.4375184022078789, 0.4083891346119995,
+    0.3751213328783903, 0.33573751921443695, 0.28617459179208804, 0.2152418959849064,
+    0.0,
+};
+static const f64 random__normal_f[257] = {
+    0.0004774677646093862, 0.0012602859304985956, 0.0026090727461021593, 0.0040379725933630236,
+    0.005522403299250986, 0.007050875471373216, 0.00861658276939872, 0.010214971439701459,
+    0.011842757857907879, 0.013497450601739867, 0.01517708830793531, 0.016880083152543142,
+    0.018605121275724622, 0.020351096230044483, 0.02211706270730882, 0.023902203305795823,
+    0.025705804008548817, 0.027527235669603013, 0.029365939758133255, 0.03122141719192019,
+    0.03309321945857846, 0.03498094146171602, 0.03688421568856722, 0.038802707404526064,
+    0.0407361106559409, 0.042684144916474424, 0.044646552251294463, 0.04662309490193038,
+    0.04861355321586854, 0.05061772386094778, 0.05263541827679219, 0.05466646132488892,
+    0.0567106901062029, 0.05876795292093374, 0.06083810834953988, 0.06292102443775814,
+    0.0650165779712429, 0.0671246538277885, 0.06924514439700676, 0.0713779490588904,
+    0.07352297371398132, 0.07568013035892711, 0.07784933670209605, 0.08003051581466307,
+    0.0822235958132029, 0.08442850957035347, 0.08664519445055807, 0.08887359206827589,
+    0.09111364806637376, 0.09336531191269101, 0.095628536713009, 0.09790327903886246,
+    0.10018949876881002, 0.10248715894193525, 0.10479622562248707, 0.1071166677746838,
+    0.1094484571468118, 0.11179156816383809, 0.11414597782783849, 0.11651166562561087,
+    0.11888861344291006, 0.1212768054847903, 0.12367622820159657, 0.1260868702201859,
+    0.12850872227999957, 0.13094177717364436, 0.13338602969166916, 0.13584147657125376,
+    0.13830811644855073, 0.1407859498144447, 0.14327497897351346, 0.14577520800599403,
+    0.14828664273257455, 0.15080929068184568, 0.15334316106026286, 0.1558882647244792,
+    0.15844461415592428, 0.161012223437511, 0.16359110823236558, 0.1661812857644819,
+    0.1687827748012113, 0.17139559563750575, 0.17401977008183855, 0.17665532144373478,
+    0.1793022745228475, 0.18196065559952238, 0.1846304924267991, 0.18731181422380005,
+    0.1900046516704648, 0.19270903690358893, 0.1954250035141341, 0.19815258654577494,
+    0.20089182249465645, 0.20364274931033471, 0.20640540639788052, 0.20917983462112485,
+    0.21196607630703004, 0.21476417525117344, 0.21757417672433102, 0.22039612748015178,
+    0.22323007576391726, 0.22607607132237997, 0.22893416541467998, 0.23180441082433836,
+    0.23468686187232965, 0.23758157443123773, 0.2404886059405001, 0.2434080154227499,
+    0.24633986350126344, 0.24928421241852802, 0.2522411260559417, 0.2552106699546614,
+    0.2581929113376186, 0.26118791913272055, 0.26419576399726047, 0.2672165183435608,
+    0.27025025636587496, 0.2732970540685766, 0.2763569892956678, 0.27943014176163744,
+    0.2825165930837071, 0.2856164268155012, 0.2887297284821823, 0.2918565856170946,
+    0.29499708779996126, 0.298151326696685, 0.3013193961008025, 0.3045013919766494,
+    0.30769741250429145, 0.3109075581262859, 0.3141319315963365, 0.3173706380299129,
+    0.3206237849569047, 0.3238914823763904, 0.32717384281360057, 0.33047098137916275,
+    0.33378301583071757, 0.3371100666370053, 0.34045225704452103, 0.34380971314684994,
+    0.34718256395679287, 0.35057094148140533, 0.35397498080007594, 0.3573948201457797,
+    0.3608306009896472, 0.3642824681290031, 0.36775056977903164, 0.37123505766823856,
+    0.3747360871378902, 0.3782538172456183, 0.3817884108733928, 0.3853400348400765,
+    0.388908860018788, 0.39249506145931484, 0.3960988185158316, 0.3997203149801965,
+    0.4033597392211138, 0.40701728432947265, 0.41069314827018755, 0.4143875340408904,
+    0.4181006498378475, 0.4218327092294953, 0.4255839313380213, 0.4293545410294408,
+    0.43314476911265165, 0.4369548525479849, 0.44078503466580327, 0.4446355653957386,
+    0.4485067015072023, 0.4523987068618478, 0.45631185267871566, 0.4602464178128421,
+    0.4642026890481735, 0.4681809614056928, 0.4721815384677294, 0.47620473271950514,
+    0.480250865909046, 0.48432026942668244, 0.4884132847054572, 0.49253026364386776,
+    0.49667156905248894, 0.5008375751261479, 0.5050286679434673, 0.509245245995747,
+    0.513487720747326, 0.5177565172297554, 0.5220520746723208, 0.5263748471716834,
+    0.530725304403661, 0.5351039323804565, 0.5395112342569509, 0.543947731190025,
+    0.5484139632552646, 0.5529104904258311, 0.5574378936187647, 0.5619967758145232,
+    0.5665877632561631, 0.5712115067352519, 0.5758686829723524, 0.5805599961007896,
+    0.5852861792633699, 0.5900479963328245, 0.594846243767986, 0.5996817526191239,
+    0.6045553906974664, 0.6094680649257721, 0.6144207238889126, 0.619414360605833,
+    0.6244500155470252, 0.6295287799248354, 0.6346517992876223, 0.6398202774530553,
+    0.645035480820821, 0.6502987431108154, 0.6556114705796959, 0.6609751477766618,
+    0.6663913439087488, 0.6718617198970807, 0.677388036218772, 0.6829721616449933,
+    0.6886160830046703, 0.6943219161261152, 0.7000919181365101, 0.7059285013327526,
+    0.7118342488782468, 0.7178119326307203, 0.7238645334686284, 0.7299952645614745,
+    0.7362075981268609, 0.7425052963401493, 0.748892447219155, 0.7553735065070942,
+    0.7619533468367934, 0.7686373157984843, 0.7754313049811852, 0.7823418326548004,
+    0.7893761435660225, 0.7965423304229569, 0.8038494831709622, 0.811307874312654,
+    0.8189291916037001, 0.8267268339462192, 0.8347162929868812, 0.8429156531122018,
+    0.8513462584586755, 0.860033621196329, 0.8690086880368544, 0.8783096558089146,
+    0.8879846607558305, 0.8980959218983404, 0.9087264400521277, 0.9199915050393436,
+    0.9320600759592268, 0.9451989534422957, 0.9598790918001021, 0.977101701267666,
+    1.0,
+};
+static const f64 random__exp_x[257] = {
+    8.697117470131051, 7.69711747013105, 6.941033629377213, 6.47837849383257,
+    6.144164665772473, 5.8821443157954, 5.666410167454034, 5.4828906275260625,
+    5.323090505754398, 5.1814872813015, 5.054288489981304, 4.9387770859012505,
+    4.832939741025112, 4.735242996601741, 4.644491885420085, 4.559737061707351,
+    4.480211746528422, 4.405287693473573, 4.334443680317273, 4.267242480277366,
+    4.203313713735184, 4.1423408656640515, 4.084051310408298, 4.028208544647937,
+    3.974606066673789, 3.9230625001354897, 3.873417670399509, 3.8255294185223367,
+    3.779270992411668, 3.7345288940397974, 3.691201090237419, 3.6491955157608538,
+    3.6084288131289095, 3.568825265648337, 3.5303158891293434, 3.4928376547740596,
+    3.45633282113276, 3.42074835725112, 3.386035442460301, 3.3521490309001094,
+    3.319047470970748, 3.2866921715990687, 3.25504730857045, 3.224079565286264,
+    3.1937579032122403, 3.164053358025973, 3.1349388580844404, 3.1063890623398245,
+    3.0783802152540902, 3.050890016615455, 3.0238975044556766, 2.9973829495161306,
+    2.9713277599210897, 2.9457143948950457, 2.920526286512741, 2.895747768600142,
+    2.8713640120155364, 2.847360965635189, 2.8237253024500353, 2.800444370250738,
+    2.7775061464397566, 2.7548991965623446, 2.7326126361947, 2.7106360958679288,
+    2.6889596887418037, 2.6675739807732666, 2.646469963151809, 2.6256390267977885,
+    2.6050729387408356, 2.5847638202141408, 2.5647041263169053, 2.54488662711187,
+    2.525304390037828, 2.505950763528594, 2.4868193617402095, 2.467904050297365,
+    2.4491989329782498, 2.4306983392644197, 2.4123968126888706, 2.394289099921458,
+    2.3763701405361406, 2.3586350574093373, 2.3410791477030344, 2.3236978743901964,
+    2.30648685828358, 2.2894418705322694, 2.272558825553155, 2.255833774367219,
+    2.239262898312909, 2.222842503111037, 2.206569013257664, 2.19043896672322,
+    2.1744490099377747, 2.158595893043886, 2.142876465399842, 2.1272876713173683,
+    2.111826546019042, 2.096490211801715, 2.081275874393225, 2.0661808194905755,
+    2.051202409468585, 2.0363380802487696, 2.021585338318926, 2.0069417578945186,
+    1.9924049782135766, 1.9779727009573604, 1.9636426877895483, 1.949412758007185,
+    1.9352807862970514, 1.921244700591528, 1.9073024800183875, 1.8934521529393082,
+    1.8796917950722112, 1.866019527692828, 1.8524335159111756, 1.83893196701888,
+    1.8255131289035198, 1.8121752885263906, 1.7989167704602909, 1.785735935484126,
+    1.7726311792313056, 1.7596009308890748, 1.7466436519460744, 1.7337578349855716,
+    1.7209420025219353, 1.7081947058780578, 1.695514524101538, 1.682900062917554,
+    1.6703499537164521, 1.6578628525741728, 1.6454374393037237, 1.6330724165359913,
+    1.620766508828258, 1.6085184617988584, 1.5963270412864834, 1.584191032532689,
+    1.5721092393862297, 1.560080483527888, 1.5481036037145135, 1.536177455041032,
+    1.5243009082192263, 1.512472848872117, 1.5006921768428167, 1.488957805516746,
+    1.4772686611561339, 1.4656236822457454, 1.4540218188487934, 1.4424620319720125,
+    1.4309432929388797, 1.4194645827699832, 1.4080248915695357, 1.3966232179170421,
+    1.3852585682631222, 1.3739299563284908, 1.362636402505087, 1.3513769332583354,
+    1.340150580529505, 1.328956381137117, 1.3177933761763252, 1.3066606104151746,
+    1.2955571316866015, 1.284481990275013, 1.2734342382962416, 1.2624129290696158,
+    1.251417116480853, 1.240445854334407, 1.2294981956938498, 1.218573192208791,
+    1.2076698934267622, 1.196787346088404, 1.185924593404203, 1.1750806743109123,
+    1.1642546227056796, 1.1534454666557754, 1.1426522275816735, 1.1318739194110792,
+    1.121109547701331, 1.110358108727412, 1.0996185885325982, 1.088889961938548,
+    1.0781711915113732, 1.0674612264799688, 1.0567590016025523, 1.046063435977045,
+    1.0353734317905294, 1.0246878730026183, 1.0140056239570978, 1.003325527915698,
+    0.9926464055072772, 0.9819670530850639, 0.9712862409839048, 0.960602711668668,
+    0.9499151777640774, 0.9392223199552638, 0.928522784747212, 0.9178151820700458,
+    0.9070980827156918, 0.8963700155898915, 0.8856294647617531, 0.8748748662910267,
+    0.864104604811006, 0.8533170098423749, 0.84251035181037, 0.8316828377342746,
+    0.8208326065544134, 0.80995772405742, 0.7990561773554887, 0.7881258688694941,
+    0.7771646097591313, 0.7661701127354362, 0.7551399841819838, 0.7440717155005095,
+    0.732962673584367, 0.7218100903087578, 0.7106110509096565, 0.6993624811032334,
+    0.6880611327737494, 0.6767035680295241, 0.6652861413926794, 0.6538049798476665,
+    0.6422559604245379, 0.630634684933492, 0.6189364513948777, 0.6071562216203017,
+    0.5952885842915044, 0.5833277127487712, 0.5712673165325899, 0.5591005855115422,
+    0.5468201251633121, 0.534417881237167, 0.5218850515921366, 0.509211982443656,
+    0.4963880455186726, 0.4834014916534633, 0.47023927508217045, 0.4568868409314218,
+    0.4433278660735541, 0.4295439402254126, 0.41551416960035825, 0.4012146788962796,
+    0.3866179779411214, 0.3716921453299192, 0.3563997602583957, 0.3406964810648512,
+    0.32452911701691145, 0.30783295467493427, 0.2905279554912326, 0.27251318547846703,
+    0.25365836338591446, 0.23379048305967726, 0.21267151063096923, 0.18995868962243467,
+    0.16512762256419042, 0.13730498094001628, 0.10483850756582322, 0.0638521638150076,
+    0.0,
+};
+static const f64 random__exp_f[257] = {
+    0.00016706669230796367, 0.0004541343538414966, 0.0009672692823271743, 0.0015362997803015726,
+    0.002145967743718907, 0.0027887987935740757, 0.003460264777836904, 0.004157295120833797,
+    0.004877655983542396, 0.005619642207205489, 0.006381905937319183, 0.007163353183634991,
+    0.007963077438017043, 0.008780314985808977, 0.009614413642502212, 0.01046481018102998,
+    0.0113310135978346, 0.012212592426255378, 0.013109164931254991, 0.014020391403181943,
+    0.014945968011691148, 0.015885621839973156, 0.01683910682603994, 0.017806200410911355,
+    0.018786700744696024, 0.01978042433800974, 0.020787204072578114, 0.02180688750428358,
+    0.02283933540638524, 0.023884420511558174, 0.024942026419731787, 0.02601204664513422,
+    0.027094383780955803, 0.028188948763978646, 0.02929566022463741, 0.03041444391046662,
+    0.03154523217289362, 0.032687963508959555, 0.03384258215087436, 0.03500903769739743,
+    0.03618728478193144, 0.03737728277295938, 0.03857899550307487, 0.03979239102337414,
+    0.04101744138041484, 0.042254122413316254, 0.0435024135688882, 0.04476229773294329,
+    0.046033761076175184, 0.04731679291318156, 0.048611385573379504, 0.04991753428270638,
+    0.05123523705512628, 0.052564494593071685, 0.05390531019604608, 0.05525768967669703,
+    0.05662164128374287, 0.05799717563120066, 0.05938430563342028, 0.06078304644547966,
+    0.062193415408541036, 0.06361543199980738, 0.0650491177867538, 0.06649449638533982,
+    0.06795159342193664, 0.06942043649872878, 0.07090105516237184, 0.07239348087570875,
+    0.07389774699236475, 0.07541388873405841, 0.07694194317048052, 0.07848194920160644,
+    0.0800339475423199, 0.08159798070923742, 0.0831740930096324, 0.08476233053236815,
+    0.08636274114075693, 0.08797537446727023, 0.08960028191003289, 0.0912375166310402,
+    0.09288713355604357, 0.09454918937605587, 0.09622374255043283, 0.09791085331149221,
+    0.09961058367063713, 0.10132299742595363, 0.1030481601712577, 0.10478613930657016,
+    0.10653700405000163, 0.10830082545103376, 0.11007767640518536, 0.11186763167005628,
+    0.11367076788274429, 0.1154871635786335, 0.11731689921155553, 0.11916005717532764,
+    0.12101672182667479, 0.12288697950954511, 0.12477091858083093, 0.12666862943751067,
+    0.1285802045452282, 0.13050573846833077, 0.1324453279013875, 0.1343990717022136,
+    0.13636707092642883, 0.13834942886358018, 0.1403462510748624, 0.14235764543247215,
+    0.14438372216063472, 0.1464245938783449, 0.14848037564386674, 0.15055118500103984,
+    0.1526371420274428, 0.15473836938446803, 0.15685499236936515, 0.15898713896931413,
+    0.16113493991759195, 0.16329852875190173, 0.16547804187493592, 0.16767361861725008,
+    0.16988540130252755, 0.17211353531531998, 0.1743581691713534, 0.17661945459049483,
+    0.17889754657247828, 0.18119260347549626, 0.18350478709776744, 0.18583426276219708,
+    0.18818119940425426, 0.19054576966319536, 0.1929281499767713, 0.1953285206795632,
+    0.19774706610509882, 0.2001839746919112, 0.20263943909370896, 0.20511365629383765,
+    0.20760682772422198, 0.21011915938898823, 0.21265086199297822, 0.21520215107537863,
+    0.21777324714870047, 0.22036437584335944, 0.2229757680581201, 0.22560766011668396,
+    0.22826029393071662, 0.23093391716962736, 0.2336287834374333, 0.23634515245705956,
+    0.2390832902624491, 0.24184346939887713, 0.24462596913189202, 0.24743107566532754,
+    0.2502590823688622, 0.25311029001562935, 0.25598500703041527, 0.25888354974901606,
+    0.2618062426893628, 0.26475341883506204, 0.26772541993204463, 0.27072259679905986,
+    0.2737453096528028, 0.2767939284485172, 0.27986883323697276, 0.28297041453878063,
+    0.2860990737370767, 0.2892552234896776, 0.2924392881618924, 0.295651704281261,
+    0.2988929210155815, 0.3021634006756933, 0.30546361924459003, 0.30879406693455996,
+    0.3121552487741794, 0.3155476852271287, 0.318971912844957, 0.322428484956089,
+    0.325917972393556, 0.32944096426413616, 0.33299806876180876, 0.3365899140286774,
+    0.34021714906677986, 0.34388044470450224, 0.3475804946216368, 0.35131801643748317,
+    0.3550937528667873, 0.35890847294874956, 0.3627629733548175, 0.3666580797815139,
+    0.3705946484351457, 0.3745735676159019, 0.3785957594095805, 0.3826621814960095,
+    0.3867738290841374, 0.3909317369847968, 0.3951369818332898, 0.39939068447523074,
+    0.40369401253052994, 0.40804818315203206, 0.41245446599716085, 0.41691418643300254,
+    0.42142872899761624, 0.425999541143034, 0.4306281372884585, 0.43531610321563624,
+    0.4400651008423535, 0.4448768734145481, 0.4497532511627546, 0.4546961574746151,
+    0.4597076156421373, 0.4647897562504258, 0.4699448252839596, 0.475175193037377,
+    0.4804833639304538, 0.4858719873418845, 0.49134386959403215, 0.49690198724154916,
+    0.5025495018413473, 0.5082897764106424, 0.5141263938147481, 0.5200631773682332,
+    0.5261042139836193, 0.5322538802630428, 0.5385168720028614, 0.5448982376724392,
+    0.5514034165406408, 0.558038282262587, 0.5648091929123997, 0.5717230486648253,
+    0.5787873586028445, 0.5860103184772675, 0.5934009016917329, 0.6009689663652317,
+    0.6087253820796215, 0.616682180915207, 0.6248527387036653, 0.6332519942143654,
+    0.6418967164272653, 0.6508058334145702, 0.6600008410789989, 0.669506316731924,
+    0.6793505722647646, 0.6895664961170771, 0.7001926550827873, 0.711274760805075,
+    0.722867659593571, 0.7350380924314225, 0.747868621985194, 0.7614633888498951,
+    0.7759568520401143, 0.7915276369724943, 0.8084216515230069, 0.8269932966430488,
+    0.8477855006239878, 0.8717043323812015, 0.9004699299257437, 0.9381436808621708,
+    1.0,
+};
+
+function f64 random__normal_slow(Random_Xoshiro *it, u64 bits)
 {
-    it->state = state;
-    it->selector = (selector << 1) | 1;
+    for (;;)
+    {
+        i64 i = bits & 0xff;
+        f64 u = random__unit_f64(bits);
+        f64 x = u * random__normal_x[i];
+        f64 sign = (bits & 0x100) ? -1.0 : 1.0;
+
+        if (x < random__normal_x[i + 1]) return sign * x;
+
+        if (i == 0)
+        {
+            // NOTE(nick): the tail past R, Marsaglia's method
+            f64 r = random__normal_x[1];
+            f64 a, b;
+            do
+            {
+                a = -random__log(1.0 - random_xoshiro_f64(it)) / r;
+                b = -random__log(1.0 - random_xoshiro_f64(it));
+            } while (b + b < a * a);
+            return sign * (r + a);
+        }
+
+        f64 y = random__normal_f[i + 1] + (random__normal_f[i] - random__normal_f[i + 1]) * random_xoshiro_f64(it);
+        if (y < random__exp(-0.5 * x * x)) return sign * x;
+
+        bits = random_xoshiro_u64(it);
+    }
 }
 
-function u32 random_pcg_u32(Random_PCG *it)
+function f64 random__exponential_slow(Random_Xoshiro *it, u64 bits)
 {
-    u64 state = it->state;
-    state = state * 6364136223846793005ULL + it->selector;
-    it->state = state;
+    for (;;)
+    {
+        i64 i = bits & 0xff;
+        f64 u = random__unit_f64(bits);
+        f64 x = u * random__exp_x[i];
 
-    u32 pre_rotate = (u32)((state ^ (state >> 18)) >> 27);
-    u32 result = rotate_right_u32(pre_rotate, (i32)(state >> 59));
+        if (x < random__exp_x[i + 1]) return x;
 
-    return result;
+        // NOTE(nick): the tail is memoryless, so it's just another exponential shifted by R
+        if (i == 0) return random__exp_x[1] - random__log(1.0 - random_xoshiro_f64(it));
+
+        f64 y = random__exp_f[i + 1] + (random__exp_f[i] - random__exp_f[i + 1]) * random_xoshiro_f64(it);
+        if (y < random__exp(-x)) return x;
+
+        bits = random_xoshiro_u64(it);
+    }
 }
 
-function f32 random_pcg_f32(Random_PCG *it) 
+force_inline function f64 random__normal(Random_Xoshiro *it, u64 bits)
 {
-    f32 divisor = 1.0f / (f32)U32_MAX;
-    return divisor * (f32)random_pcg_u32(it);
+    i64 i = bits & 0xff;
+    f64 x = random__unit_f64(bits) * random__normal_x[i];
+    if (x < random__normal_x[i + 1])
+    {
+        // NOTE(nick): bit 8 is the sign, moved straight into the sign bit so there's no branch on it
+        u64 x_bits;
+        MemoryCopy(&x_bits, &x, sizeof(x_bits));
+        x_bits ^= (bits & 0x100) << 55;
+        MemoryCopy(&x, &x_bits, sizeof(x));
+        return x;
+    }
+    return random__normal_slow(it, bits);
 }
 
-function f32 random_pcg_between_f32(Random_PCG *it, f32 min, f32 max) {
-    return min + (max - min) * random_pcg_f32(it);
+force_inline function f64 random__exponential(Random_Xoshiro *it, u64 bits)
+{
+    i64 i = bits & 0xff;
+    f64 x = random__unit_f64(bits) * random__exp_x[i];
+    if (x < random__exp_x[i + 1]) return x;
+    return random__exponential_slow(it, bits);
 }
 
-function i32 random_pcg_between_i32(Random_PCG *it, i32 min, i32 max) {
-    assert(max >= min);
-    return min + (i32)(random_pcg_u32(it) % (max - min + 1));
+function void random_xoshiro_fill_normal_f32(Random_Xoshiro *it, f32 *dest, i64 count, f32 mean, f32 stddev)
+{
+    random__xoshiro_fill_block(it, dest, count, mean + stddev * (f32)random__normal(it, block[i]));
 }
 
-function void random_pcg_shuffle(Random_PCG *it, void *base, u64 count, u64 size) {
-    u8 *at = cast(u8 *)base + (count-1) * size;
-    for (i64 i = count; i > 1; i--)
-    {
-        i64 j = random_pcg_u32(it) % i;
-        memory_swap(at, (u8 *)base + j*size, size);
-        at -= size;
-    }
+function void random_xoshiro_fill_normal_f64(Random_Xoshiro *it, f64 *dest, i64 count, f64 mean, f64 stddev)
+{
+    random__xoshiro_fill_block(it, dest, count, mean + stddev * random__normal(it, block[i]));
+}
+
+function void random_xoshiro_fill_exponential_f32(Random_Xoshiro *it, f32 *dest, i64 count, f32 rate)
+{
+    f32 scale = 1.0f / rate;
+    random__xoshiro_fill_block(it, dest, count, scale * (f32)random__exponential(it, block[i]));
+}
+
+function void random_xoshiro_fill_exponential_f64(Random_Xoshiro *it, f64 *dest, i64 count, f64 rate)
+{
+    f64 scale = 1.0 / rate;
+    random__xoshiro_fill_block(it, dest, count, scale * random__exponential(it, block[i]));
 }
 
 static Random_PCG g_random = {0x4d595df4d0f33173, 6364136223846793005u};
@@ -4944,73 +11922,377 @@ static const u8 base64__pr2six[256] = {
     64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
 };
 
-static const char base64__std_mapping[]  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-static const char base64__url_mapping[]  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+static const char base64__std_mapping[]  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char base64__url_mapping[]  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+//
+// NOTE(nick): the AVX2 and NEON paths work on whole blocks and hand the rest to the scalar
+// loops. Sextets are mapped to and from ASCII with range compares rather than byte shuffles
+// so the same code takes both alphabets.
+//
+
+force_inline function Simd_U8 base64__simd_encode_chars(Simd_U8 x, const char *map)
+{
+    // NOTE(nick): offsets are relative to 'A', which is where 0..25 land
+    Simd_U8 offset = simd__and(simd__in_range(x, 26, 51), simd__set1('a' - 26 - 'A'));
+    offset = simd__or(offset, simd__and(simd__in_range(x, 52, 61), simd__set1((u8)('0' - 52 - 'A'))));
+    offset = simd__or(offset, simd__and(simd__eq(x, simd__set1(62)), simd__set1((u8)(map[62] - 62 - 'A'))));
+    offset = simd__or(offset, simd__and(simd__eq(x, simd__set1(63)), simd__set1((u8)(map[63] - 63 - 'A'))));
+    return simd__add(x, simd__add(offset, simd__set1('A')));
+}
+
+// NOTE(nick): takes both alphabets like base64__pr2six, *valid is set in the lanes that were in one
+force_inline function Simd_U8 base64__simd_decode_chars(Simd_U8 x, Simd_U8 *valid)
+{
+    Simd_U8 upper = simd__in_range(x, 'A', 'Z');
+    Simd_U8 lower = simd__in_range(x, 'a', 'z');
+    Simd_U8 digit = simd__in_range(x, '0', '9');
+    Simd_U8 plus  = simd__eq(x, simd__set1('+'));
+    Simd_U8 minus = simd__eq(x, simd__set1('-'));
+    Simd_U8 slash = simd__eq(x, simd__set1('/'));
+    Simd_U8 under = simd__eq(x, simd__set1('_'));
+
+    Simd_U8 offset = simd__and(upper, simd__set1((u8)-'A'));
+    offset = simd__or(offset, simd__and(lower, simd__set1((u8)(26 - 'a'))));
+    offset = simd__or(offset, simd__and(digit, simd__set1((u8)(52 - '0'))));
+    offset = simd__or(offset, simd__and(plus,  simd__set1((u8)(62 - '+'))));
+    offset = simd__or(offset, simd__and(minus, simd__set1((u8)(62 - '-'))));
+    offset = simd__or(offset, simd__and(slash, simd__set1((u8)(63 - '/'))));
+    offset = simd__or(offset, simd__and(under, simd__set1((u8)(63 - '_'))));
+
+    *valid = simd__or(simd__or(simd__or(upper, lower), simd__or(digit, plus)), simd__or(minus, simd__or(slash, under)));
+    return simd__add(x, offset);
+}
+
+// NOTE(nick): returns how many input bytes were encoded, always a multiple of 3
+function i64 base64__encode_blocks(u8 *dest, u8 const *src, i64 count, const char *map)
+{
+    i64 i = 0;
+
+    #if ARCH_AVX2
+    // NOTE(nick): each 128-bit lane gets 12 input bytes, spread out so every 32-bit word
+    // holds one 3 byte group, then the multiplies shift each sextet into its own byte
+    const __m256i spread = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+    for (; i + 28 <= count; i += 24)
+    {
+        __m128i lo = _mm_loadu_si128((__m128i *)(src + i));
+        __m128i hi = _mm_loadu_si128((__m128i *)(src + i + 12));
+        __m256i in = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), spread);
+
+        __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+
+        simd__store(dest + i / 3 * 4, base64__simd_encode_chars(_mm256_or_si256(t0, t1), map));
+    }
+    #elif ARCH_NEON
+    for (; i + 48 <= count; i += 48)
+    {
+        uint8x16x3_t in = vld3q_u8(src + i);
+        uint8x16_t mask = vdupq_n_u8(63);
+
+        uint8x16x4_t out;
+        out.val[0] = vshrq_n_u8(in.val[0], 2);
+        out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+        out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+        out.val[3] = vandq_u8(in.val[2], mask);
+
+        for (int j = 0; j < 4; j += 1) out.val[j] = base64__simd_encode_chars(out.val[j], map);
+        vst4q_u8(dest + i / 3 * 4, out);
+    }
+    #endif
+
+    return i;
+}
+
+// NOTE(nick): returns how many input bytes were decoded, always a multiple of 4. Stops in front
+// of the first block that has anything outside the alphabet and never writes past the output.
+function i64 base64__decode_blocks(u8 *dest, u8 const *src, i64 count)
+{
+    i64 i = 0;
+
+    #if ARCH_AVX2
+    for (; i + 32 <= count; i += 32)
+    {
+        Simd_U8 valid;
+        __m256i sextets = base64__simd_decode_chars(simd__load((u8 *)src + i), &valid);
+        if (simd__mask(valid) != SIMD_MASK_ALL) break;
+
+        // NOTE(nick): pairs of sextets into 12 bits, pairs of those into 24, then pack the 3 byte groups
+        __m256i merged = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+        merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+        u8 *out = dest + i / 4 * 3;
+        _mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(merged));
+        _mm_storel_epi64((__m128i *)(out + 16), _mm256_extracti128_si256(merged, 1));
+    }
+    #elif ARCH_NEON
+    for (; i + 64 <= count; i += 64)
+    {
+        uint8x16x4_t in = vld4q_u8(src + i);
+        Simd_U8 all_valid = vdupq_n_u8(0xff);
+        for (int j = 0; j < 4; j += 1)
+        {
+            Simd_U8 valid;
+            in.val[j] = base64__simd_decode_chars(in.val[j], &valid);
+            all_valid = vandq_u8(all_valid, valid);
+        }
+        if (simd__mask(all_valid) != SIMD_MASK_ALL) break;
+
+        uint8x16x3_t out;
+        out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+        vst3q_u8(dest + i / 4 * 3, out);
+    }
+    #endif
+
+    return i;
+}
+
+force_inline function void base64__encode_group(u8 *dest, u8 const *src, const char *map)
+{
+    dest[0] = map[(src[0] >> 2) & 0x3F];
+    dest[1] = map[((src[0] & 0x3) << 4) | ((src[1] & 0xF0) >> 4)];
+    dest[2] = map[((src[1] & 0xF) << 2) | ((src[2] & 0xC0) >> 6)];
+    dest[3] = map[src[2] & 0x3F];
+}
+
+// NOTE(nick): the last 1 or 2 bytes, url-safe omits padding; standard adds '=' to reach a multiple of 4
+function i64 base64__encode_tail(u8 *dest, u8 const *src, i64 count, bool url_safe)
+{
+    const char *map = url_safe ? base64__url_mapping : base64__std_mapping;
+    u8 *p = dest;
+
+    if (count > 0) {
+        *p++ = map[(src[0] >> 2) & 0x3F];
+        if (count == 1) {
+            *p++ = map[(src[0] & 0x3) << 4];
+            if (!url_safe) { *p++ = '='; *p++ = '='; }
+        } else {
+            *p++ = map[((src[0] & 0x3) << 4) | ((src[1] & 0xF0) >> 4)];
+            *p++ = map[(src[1] & 0xF) << 2];
+            if (!url_safe) { *p++ = '='; }
+        }
+    }
+
+    return p - dest;
+}
+
+function i64 base64_encoded_size(i64 count, bool url_safe)
+{
+    if (url_safe) return (count / 3) * 4 + (count % 3 ? count % 3 + 1 : 0);
+    return (count + 2) / 3 * 4;
+}
+
+function i64 base64_write_encoded(u8 *dest, String input, bool url_safe)
+{
+    const char *map = url_safe ? base64__url_mapping : base64__std_mapping;
+
+    i64 i = base64__encode_blocks(dest, input.data, input.count, map);
+    u8 *p = dest + i / 3 * 4;
+
+    for (; i + 3 <= input.count; i += 3, p += 4) {
+        base64__encode_group(p, input.data + i, map);
+    }
+
+    p += base64__encode_tail(p, input.data + i, input.count - i, url_safe);
+    return p - dest;
+}
+
+function String base64_encode(Arena *arena, String input, bool url_safe)
+{
+    i64 out_len = base64_encoded_size(input.count, url_safe) + 1;
+    u8 *out = PushArrayNoZero(arena, u8, out_len);
+
+    i64 count = base64_write_encoded(out, input, url_safe);
+    out[count] = '\0';
+    return string_make(out, count);
+}
+
+// NOTE(nick): decoding stops at the first byte outside the alphabet, '=' included.
+// A lone trailing sextet can't make a byte and is dropped.
+function i64 base64_decoded_size(String input, bool skip_whitespace)
+{
+    i64 digits = 0;
+    i64 i = 0;
+
+    if (!skip_whitespace) {
+        for (; i + SIMD_WIDTH <= input.count; i += SIMD_WIDTH) {
+            Simd_U8 valid;
+            base64__simd_decode_chars(simd__load(input.data + i), &valid);
+            if (simd__mask(valid) != SIMD_MASK_ALL) break;
+        }
+        digits = i;
+    }
+
+    for (; i < input.count; i += 1) {
+        u8 c = input.data[i];
+        if (base64__pr2six[c] <= 63) digits += 1;
+        else if (!(skip_whitespace && char_is_whitespace(c))) break;
+    }
+
+    return (digits / 4) * 3 + (digits % 4 ? digits % 4 - 1 : 0);
+}
+
+function i64 base64_write_decoded(u8 *dest, String input, bool skip_whitespace)
+{
+    Base64_Decoder it = base64_decoder_make(skip_whitespace);
+    i64 count = base64_decoder_push(&it, input, dest);
+    count += base64_decoder_finish(&it, dest + count);
+    return count;
+}
+
+function String base64__decode(Arena *arena, String input, bool skip_whitespace)
+{
+    // NOTE(nick): sized for the whole input up front, the unused tail is given back
+    i64 out_len = (input.count + 3) / 4 * 3 + 1;
+    u8 *out = PushArrayNoZero(arena, u8, out_len);
+
+    i64 count = base64_write_decoded(out, input, skip_whitespace);
+    out[count] = '\0';
+    arena_pop(arena, out_len - (count + 1));
+    return string_make(out, count);
+}
+
+function String base64_decode(Arena *arena, String input)
+{
+    return base64__decode(arena, input, false);
+}
+
+function String base64_decode_skip_whitespace(Arena *arena, String input)
+{
+    return base64__decode(arena, input, true);
+}
+
+//
+// NOTE(nick): streaming versions for chunked input. base64_encoder_push writes at most
+// (input.count + 2) / 3 * 4 bytes and base64_decoder_push at most (input.count + 3) / 4 * 3,
+// the _finish calls at most 4 and 2.
+//
 
-String base64_encode(Arena *arena, String input, bool url_safe)
+function Base64_Encoder base64_encoder_make(bool url_safe)
 {
-    const char *map = url_safe ? base64__url_mapping : base64__std_mapping;
+    Base64_Encoder result = {0};
+    result.url_safe = url_safe;
+    return result;
+}
+
+function i64 base64_encoder_push(Base64_Encoder *it, String input, u8 *dest)
+{
+    const char *map = it->url_safe ? base64__url_mapping : base64__std_mapping;
+    u8 *p = dest;
 
-    // url-safe omits padding; standard adds '=' to reach multiple of 4
-    i64 raw_len = (input.count + 2) / 3 * 4;
-    i64 out_len = raw_len + 1;
-    u8 *out = PushArray(arena, u8, out_len);
-    u8 *p = out;
+    if (it->pending_count > 0) {
+        i64 take = Min(3 - it->pending_count, input.count);
+        MemoryCopy(it->pending + it->pending_count, input.data, take);
+        it->pending_count += (i32)take;
+        input = string_skip(input, take);
 
-    const u8 *s = input.data;
-    i64 len = input.count;
-    i64 i = 0;
+        if (it->pending_count < 3) return 0;
 
-    for (; i < len - 2; i += 3) {
-        *p++ = map[(s[i] >> 2) & 0x3F];
-        *p++ = map[((s[i] & 0x3) << 4) | ((s[i+1] & 0xF0) >> 4)];
-        *p++ = map[((s[i+1] & 0xF) << 2) | ((s[i+2] & 0xC0) >> 6)];
-        *p++ = map[s[i+2] & 0x3F];
+        base64__encode_group(p, it->pending, map);
+        p += 4;
+        it->pending_count = 0;
     }
 
-    if (i < len) {
-        *p++ = map[(s[i] >> 2) & 0x3F];
-        if (i == len - 1) {
-            *p++ = map[(s[i] & 0x3) << 4];
-            if (!url_safe) { *p++ = '='; *p++ = '='; }
-        } else {
-            *p++ = map[((s[i] & 0x3) << 4) | ((s[i+1] & 0xF0) >> 4)];
-            *p++ = map[(s[i+1] & 0xF) << 2];
-            if (!url_safe) { *p++ = '='; }
-        }
+    i64 i = base64__encode_blocks(p, input.data, input.count, map);
+    p += i / 3 * 4;
+
+    for (; i + 3 <= input.count; i += 3, p += 4) {
+        base64__encode_group(p, input.data + i, map);
     }
 
-    *p = '\0';
-    return string_make(out, p - out);
+    it->pending_count = (i32)(input.count - i);
+    MemoryCopy(it->pending, input.data + i, it->pending_count);
+    return p - dest;
+}
+
+function i64 base64_encoder_finish(Base64_Encoder *it, u8 *dest)
+{
+    i64 result = base64__encode_tail(dest, it->pending, it->pending_count, it->url_safe);
+    it->pending_count = 0;
+    return result;
+}
+
+function Base64_Decoder base64_decoder_make(bool skip_whitespace)
+{
+    Base64_Decoder result = {0};
+    result.skip_whitespace = skip_whitespace;
+    return result;
 }
 
-String base64_decode(Arena *arena, String input)
+function i64 base64_decoder_push(Base64_Decoder *it, String input, u8 *dest)
 {
-    const u8 *bufin = input.data;
-    while (base64__pr2six[*bufin] <= 63) bufin++;
-    i64 nprbytes = bufin - input.data;
+    u8 *p = dest;
+    u8 const *at = input.data;
+    u8 const *end = input.data + input.count;
 
-    i64 out_len = ((nprbytes + 3) / 4) * 3 + 1;
-    u8 *out = PushArray(arena, u8, out_len);
-    u8 *p = out;
+    while (at < end && !it->done) {
+        if (it->pending_count == 0) {
+            i64 count = base64__decode_blocks(p, at, end - at);
+            at += count;
+            p += count / 4 * 3;
 
-    bufin = input.data;
-    while (nprbytes > 4) {
-        *p++ = (base64__pr2six[bufin[0]] << 2) | (base64__pr2six[bufin[1]] >> 4);
-        *p++ = (base64__pr2six[bufin[1]] << 4) | (base64__pr2six[bufin[2]] >> 2);
-        *p++ = (base64__pr2six[bufin[2]] << 6) |  base64__pr2six[bufin[3]];
-        bufin += 4;
-        nprbytes -= 4;
-    }
+            for (; end - at >= 4; at += 4, p += 3) {
+                u32 a = base64__pr2six[at[0]], b = base64__pr2six[at[1]];
+                u32 c = base64__pr2six[at[2]], d = base64__pr2six[at[3]];
+                if ((a | b | c | d) > 63) break;
 
-    if (nprbytes > 1) *p++ = (base64__pr2six[bufin[0]] << 2) | (base64__pr2six[bufin[1]] >> 4);
-    if (nprbytes > 2) *p++ = (base64__pr2six[bufin[1]] << 4) | (base64__pr2six[bufin[2]] >> 2);
-    if (nprbytes > 3) *p++ = (base64__pr2six[bufin[2]] << 6) |  base64__pr2six[bufin[3]];
+                u32 bits = (a << 18) | (b << 12) | (c << 6) | d;
+                p[0] = (u8)(bits >> 16);
+                p[1] = (u8)(bits >> 8);
+                p[2] = (u8)bits;
+            }
+            if (at >= end) break;
+        }
+
+        u8 sextet = base64__pr2six[*at];
+        if (sextet <= 63) {
+            it->bits = (it->bits << 6) | sextet;
+            it->pending_count += 1;
+
+            if (it->pending_count == 4) {
+                *p++ = (u8)(it->bits >> 16);
+                *p++ = (u8)(it->bits >> 8);
+                *p++ = (u8)(it->bits);
+                it->bits = 0;
+                it->pending_count = 0;
+            }
+        } else if (!(it->skip_whitespace && char_is_whitespace(*at))) {
+            it->done = true;
+        }
+
+        at += 1;
+    }
 
-    *p = '\0';
-    return string_make(out, p - out);
+    return p - dest;
 }
 
+function i64 base64_decoder_finish(Base64_Decoder *it, u8 *dest)
+{
+    i64 result = 0;
+
+    if (it->pending_count == 2) {
+        dest[0] = (u8)(it->bits >> 4);
+        result = 1;
+    } else if (it->pending_count == 3) {
+        dest[0] = (u8)(it->bits >> 10);
+        dest[1] = (u8)(it->bits >> 2);
+        result = 2;
+    }
+
+    it->bits = 0;
+    it->pending_count = 0;
+    it->done = true;
+    return result;
+}
 
 //
 // Platform-Specific:
@@ -5269,6 +12551,7 @@ typedef struct _FILE_NOTIFY_INFORMATION {
 #define MEM_DECOMMIT              0x00004000
 #define MEM_RELEASE               0x00008000
 #define PAGE_READWRITE            0x04
+#define FILE_MAP_ALL_ACCESS       0x000F001F
 
 // ============================================================
 // Synchronization
@@ -5357,6 +12640,9 @@ __int64       __cdecl _InterlockedExchange64(__int64 volatile *dest, __int64 val
 __int64       __cdecl _InterlockedExchangeAdd64(__int64 volatile *dest, __int64 value);
 unsigned __int64 __cdecl __readgsqword(unsigned long offset);
 unsigned __int64 __cdecl __rdtsc(void);
+unsigned char __cdecl _BitScanForward(unsigned long *index, unsigned long mask);
+unsigned char __cdecl _BitScanForward64(unsigned long *index, unsigned __int64 mask);
+unsigned char __cdecl _BitScanReverse64(unsigned long *index, unsigned __int64 mask);
 
 // ============================================================
 // Kernel32 — memory
@@ -5365,6 +12651,9 @@ unsigned __int64 __cdecl __rdtsc(void);
 WINBASEAPI PVOID  WINAPI VirtualAlloc(LPVOID lpAddress, SIZE_T dwSize, DWORD flAllocationType, DWORD flProtect);
 WINBASEAPI BOOL   WINAPI VirtualFree(LPVOID lpAddress, SIZE_T dwSize, DWORD dwFreeType);
 WINBASEAPI VOID   WINAPI GetSystemInfo(SYSTEM_INFO *lpSystemInfo);
+WINBASEAPI HANDLE WINAPI CreateFileMappingA(HANDLE hFile, LPSECURITY_ATTRIBUTES lpFileMappingAttributes, DWORD flProtect, DWORD dwMaximumSizeHigh, DWORD dwMaximumSizeLow, LPCSTR lpName);
+WINBASEAPI LPVOID WINAPI MapViewOfFileEx(HANDLE hFileMappingObject, DWORD dwDesiredAccess, DWORD dwFileOffsetHigh, DWORD dwFileOffsetLow, SIZE_T dwNumberOfBytesToMap, LPVOID lpBaseAddress);
+WINBASEAPI BOOL   WINAPI UnmapViewOfFile(LPCVOID lpBaseAddress);
 
 // ============================================================
 // Kernel32 — timing / sleep
@@ -5681,7 +12970,6 @@ function bool os_init()
     if (os_was_initted) return true;
 
     // NOTE(nick): calling these functions initializes their state
-    GetScratch(0, 0);
     os_time();
     os_sleep(0);
 
@@ -5906,6 +13194,11 @@ function void *os_memory_reserve(u64 size) {
     return VirtualAlloc(0, size, MEM_RESERVE, PAGE_READWRITE);
 }
 
+function void *os_memory_reserve_at(void *address, u64 size) {
+    // NOTE(nick): fails instead of picking another address if the range is taken
+    return VirtualAlloc(address, size, MEM_RESERVE, PAGE_READWRITE);
+}
+
 function bool os_memory_commit(void *ptr, u64 size) {
     u64 page_size = os_memory_page_size();
 
@@ -5924,6 +13217,71 @@ function bool os_memory_release(void *ptr, u64 size) {
     return VirtualFree(ptr, 0, MEM_RELEASE) != 0;
 }
 
+function u64 os_memory_large_page_size() {
+    static u64 win32_large_page_size = 0;
+
+    if (!win32_large_page_size)
+    {
+        // NOTE(nick): 0 when the CPU doesn't support large pages
+        u64 result = (u64)GetLargePageMinimum();
+        if (!result || !IsPow2(result)) result = Megabytes(2);
+        win32_large_page_size = result;
+    }
+
+    return win32_large_page_size;
+}
+
+function void *os_memory_reserve_large(u64 size) {
+    // NOTE(nick): MEM_LARGE_PAGES needs SeLockMemoryPrivilege and can't be committed
+    // incrementally, so we just reserve normally and let callers commit in big steps.
+    return VirtualAlloc(0, size, MEM_RESERVE, PAGE_READWRITE);
+}
+
+function void os_memory_prefault(void *ptr, u64 size) {
+    u64 page_size = os_memory_page_size();
+    volatile u8 *at = (volatile u8 *)ptr;
+    for (u64 i = 0; i < size; i += page_size) {
+        at[i] = at[i];
+    }
+}
+
+function void *os_memory_mirror_alloc(u64 size) {
+    // NOTE(nick): size must be a multiple of the allocation granularity (64K)
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)(size >> 32), (DWORD)(size & 0xffffffff), NULL);
+    if (!mapping) return NULL;
+
+    u8 *result = NULL;
+
+    // NOTE(nick): find a free range, give it back and map both views into it. Another
+    // thread can grab the range in between, so retry a few times.
+    for (i32 attempt = 0; attempt < 16 && !result; attempt += 1) {
+        u8 *base = (u8 *)VirtualAlloc(0, size * 2, MEM_RESERVE, PAGE_READWRITE);
+        if (!base) break;
+        VirtualFree(base, 0, MEM_RELEASE);
+
+        u8 *lo = (u8 *)MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size, base);
+        u8 *hi = (u8 *)MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size, base + size);
+
+        if (lo == base && hi == base + size) {
+            result = base;
+        } else {
+            if (lo) UnmapViewOfFile(lo);
+            if (hi) UnmapViewOfFile(hi);
+        }
+    }
+
+    // NOTE(nick): the views keep the mapping alive
+    CloseHandle(mapping);
+    return result;
+}
+
+function void os_memory_mirror_release(void *ptr, u64 size) {
+    if (ptr) {
+        UnmapViewOfFile(ptr);
+        UnmapViewOfFile((u8 *)ptr + size);
+    }
+}
+
 function void *os_alloc(u64 size) {
     // NOTE(nick): Memory allocated by this function is automatically initialized to zero.
     return VirtualAlloc(0, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
@@ -6536,6 +13894,11 @@ function u32 atomic_compare_exchange_u32(u32 volatile *value, u32 New, u32 Expec
     return (result);
 }
 
+function u64 atomic_compare_exchange_u64(u64 volatile *value, u64 New, u64 Expected) {
+    u64 result = _InterlockedCompareExchange64((__int64 volatile *)value, New, Expected);
+    return (result);
+}
+
 function u64 atomic_exchange_u64(u64 volatile *value, u64 New) {
     u64 result = _InterlockedExchange64((__int64 volatile *)value, New);
     return (result);
@@ -6554,14 +13917,14 @@ function u64 atomic_add_u64(u64 volatile *value, u64 Addend) {
 DWORD WINAPI win32_thread_proc(LPVOID lpParameter) {
     Win32_Thread_Params *params = (Win32_Thread_Params *)lpParameter;
 
-    // NOTE(nick): initialize scratch memory
-    GetScratch(0, 0);
     os_init();
 
     assert(params->proc);
     u32 result = params->proc(params->data);
 
     os_free(params);
+    arena_release_thread_scratch();
+    heap_release_thread_cache();
 
     return result;
 }
@@ -6704,7 +14067,6 @@ function void os_mutex_destroy(Mutex *mutex) {
 function bool os_init()
 {
     // NOTE(nick): calling these functions initializes their state
-    GetScratch(0, 0);
     os_time();
     return true;
 }
@@ -7051,7 +14413,6 @@ function void os_mutex_destroy(Mutex *mutex) {
 function bool os_init()
 {
     // NOTE(nick): calling these functions initializes their state
-    GetScratch(0, 0);
     os_time();
     return true;
 }
@@ -7305,6 +14666,11 @@ function u32 atomic_compare_exchange_u32(volatile u32 *value, u32 new_value, u32
     return expected;
 }
 
+function u64 atomic_compare_exchange_u64(volatile u64 *value, u64 new_value, u64 expected) {
+    atomic_compare_exchange_strong((_Atomic u64 *)value, &expected, new_value);
+    return expected;
+}
+
 function u64 atomic_exchange_u64(volatile u64 *value, u64 new_value) {
     return atomic_exchange((_Atomic u64 *)value, new_value);
 }
@@ -7355,6 +14721,30 @@ function void *os_memory_reserve(u64 size)
     return result;
 }
 
+function void *os_memory_reserve_at(void *address, u64 size)
+{
+    int flags = MAP_ANONYMOUS | MAP_PRIVATE;
+    #if defined(MAP_FIXED_NOREPLACE)
+    flags |= MAP_FIXED_NOREPLACE;
+    #endif
+
+    void *result = mmap(address, size, PROT_NONE, flags, -1, 0);
+    if (result == (void*)-1)
+    {
+        result = NULL;
+    }
+
+    // NOTE(nick): without MAP_FIXED_NOREPLACE the address is only a hint
+    if (result && result != address)
+    {
+        munmap(result, size);
+        result = NULL;
+    }
+
+    AsanPoisonMemoryRegion(result, size);
+    return result;
+}
+
 function bool os_memory_commit(void *ptr, u64 size)
 {
     // NOTE(nick): ptr must be aligned to a page boundary.
@@ -7375,10 +14765,133 @@ function bool os_memory_decommit(void *ptr, u64 size)
 
 function bool os_memory_release(void *ptr, u64 size)
 {
-    AsanPoisonMemoryRegion(ptr, size);
+    // NOTE(nick): unpoison, the next mapping at this address could be anything
+    AsanUnpoisonMemoryRegion(ptr, size);
     return munmap(ptr, size) == 0;
 }
 
+function u64 os_memory_large_page_size()
+{
+    static u64 unix_large_page_size = 0;
+
+    if (!unix_large_page_size)
+    {
+        u64 result = 0;
+
+        #if OS_LINUX
+        FILE *file = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+        if (file)
+        {
+            unsigned long long value = 0;
+            if (fscanf(file, "%llu", &value) == 1) result = (u64)value;
+            fclose(file);
+        }
+        #endif
+
+        // NOTE(nick): 2MB is the PMD size on x64 and on arm64 with 4K pages
+        if (!result || !IsPow2(result)) result = Megabytes(2);
+        unix_large_page_size = result;
+    }
+
+    return unix_large_page_size;
+}
+
+function void *os_memory_reserve_large(u64 size)
+{
+    // NOTE(nick): transparent huge pages only kick in for huge page aligned ranges,
+    // so over-reserve and trim the ends off to get an aligned reservation.
+    u64 large_page_size = os_memory_large_page_size();
+    size = AlignUpPow2(size, large_page_size);
+
+    u8 *base = (u8 *)mmap(NULL, size + large_page_size, PROT_NONE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (base == (void *)-1)
+    {
+        return NULL;
+    }
+
+    u8 *result = (u8 *)AlignUpPow2((u64)base, large_page_size);
+    u64 head = result - base;
+    u64 tail = large_page_size - head;
+    if (head > 0) munmap(base, head);
+    if (tail > 0) munmap(result + size, tail);
+
+    #if defined(MADV_HUGEPAGE)
+    madvise(result, size, MADV_HUGEPAGE);
+    #endif
+
+    AsanPoisonMemoryRegion(result, size);
+    return result;
+}
+
+function void os_memory_prefault(void *ptr, u64 size)
+{
+    #if defined(MADV_POPULATE_WRITE)
+    if (madvise(ptr, size, MADV_POPULATE_WRITE) == 0) return;
+    #endif
+
+    u64 page_size = os_memory_page_size();
+    volatile u8 *at = (volatile u8 *)ptr;
+    for (u64 i = 0; i < size; i += page_size)
+    {
+        at[i] = at[i];
+    }
+}
+
+#include <fcntl.h>
+#if OS_LINUX
+#include <sys/syscall.h>
+#endif
+
+function void *os_memory_mirror_alloc(u64 size)
+{
+    // NOTE(nick): size must be a multiple of the page size
+    int fd = -1;
+
+    #if OS_LINUX
+    fd = (int)syscall(SYS_memfd_create, "ring_buffer", 0);
+    #else
+    static u64 volatile unix_mirror_counter = 0;
+    char name[64];
+    snprintf(name, sizeof(name), "/ring_buffer.%d.%llu", (int)getpid(), (unsigned long long)atomic_add_u64(&unix_mirror_counter, 1));
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) shm_unlink(name);
+    #endif
+
+    if (fd < 0) return NULL;
+
+    u8 *result = NULL;
+    if (ftruncate(fd, (off_t)size) == 0)
+    {
+        u8 *base = (u8 *)mmap(0, size * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base != MAP_FAILED)
+        {
+            void *lo = mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+            void *hi = mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+
+            if (lo == base && hi == base + size)
+            {
+                result = base;
+            }
+            else
+            {
+                munmap(base, size * 2);
+            }
+        }
+    }
+
+    // NOTE(nick): the mappings keep the pages alive
+    close(fd);
+    return result;
+}
+
+function void os_memory_mirror_release(void *ptr, u64 size)
+{
+    if (ptr)
+    {
+        munmap(ptr, size * 2);
+    }
+}
+
 function void *os_alloc(u64 size) {
     return calloc(size, 1);
 }
@@ -7749,13 +15262,12 @@ struct Unix_Thread_Params
 void *unix_thread_proc(void *data) {
     Unix_Thread_Params *params = (Unix_Thread_Params *)data;
 
-    // NOTE(nick): initialize scratch memory
-    GetScratch(0, 0);
-
     assert(params->proc);
     u64 result = (u64)params->proc(params->data);
 
     os_free(params);
+    arena_release_thread_scratch();
+    heap_release_thread_cache();
 
     return (void *)result;
 }
@@ -7794,7 +15306,7 @@ function u32 os_thread_await(Thread thread) {
     pthread_t tid = (pthread_t)thread.handle;
     void *result = 0;
     pthread_join(tid, &result);
-    return *(u32 *)result;
+    return (u32)(usize)result;
 }
 
 //
@@ -7995,6 +15507,7 @@ function File_List os_scan_entire_directory(Arena *arena, String path)
         os_file_iter_end(it);
     }
 
+    ReleaseScratch(scratch);
     return result;
 }
 
@@ -8221,6 +15734,100 @@ function void work_queue_add_entry(Work_Queue *queue, Worker_Proc *callback, voi
     os_semaphore_signal(&queue->semaphore);
 }
 
+//
+// Ring Buffer
+//
+
+function Ring_Buffer ring_buffer_alloc(u64 min_capacity)
+{
+    Ring_Buffer result = {0};
+
+    // NOTE(nick): 64K covers the page size / mapping granularity on every platform we support
+    u64 capacity = u64_next_power_of_two(Max(min_capacity, Kilobytes(64)));
+
+    result.data = (u8 *)os_memory_mirror_alloc(capacity);
+    if (result.data)
+    {
+        result.capacity = capacity;
+    }
+
+    return result;
+}
+
+function void ring_buffer_release(Ring_Buffer *ring)
+{
+    os_memory_mirror_release(ring->data, ring->capacity);
+    MemoryZeroStruct(ring);
+}
+
+function void ring_buffer_reset(Ring_Buffer *ring)
+{
+    ring->read_pos  = 0;
+    ring->write_pos = 0;
+}
+
+function u64 ring_buffer_count(Ring_Buffer *ring)
+{
+    return ring->write_pos - ring->read_pos;
+}
+
+function u64 ring_buffer_space(Ring_Buffer *ring)
+{
+    return ring->capacity - ring_buffer_count(ring);
+}
+
+function String ring_buffer_readable(Ring_Buffer *ring)
+{
+    String result = {0};
+    if (ring->data)
+    {
+        result.data  = ring->data + (ring->read_pos & (ring->capacity - 1));
+        result.count = ring_buffer_count(ring);
+    }
+    return result;
+}
+
+function String ring_buffer_writable(Ring_Buffer *ring)
+{
+    String result = {0};
+    if (ring->data)
+    {
+        result.data  = ring->data + (ring->write_pos & (ring->capacity - 1));
+        result.count = ring_buffer_space(ring);
+    }
+    return result;
+}
+
+function void ring_buffer_consume(Ring_Buffer *ring, u64 size)
+{
+    assert(size <= ring_buffer_count(ring));
+    ring->read_pos += Min(size, ring_buffer_count(ring));
+}
+
+function void ring_buffer_commit(Ring_Buffer *ring, u64 size)
+{
+    assert(size <= ring_buffer_space(ring));
+    ring->write_pos += Min(size, ring_buffer_space(ring));
+}
+
+function u64 ring_buffer_write(Ring_Buffer *ring, String data)
+{
+    String dest = ring_buffer_writable(ring);
+    u64 size = Min((u64)data.count, (u64)dest.count);
+    MemoryCopy(dest.data, data.data, size);
+    ring->write_pos += size;
+    return size;
+}
+
+function u64 ring_buffer_read(Ring_Buffer *ring, u8 *data, u64 size)
+{
+    String src = ring_buffer_readable(ring);
+    size = Min(size, (u64)src.count);
+    MemoryCopy(data, src.data, size);
+    ring->read_pos += size;
+    return size;
+}
+
 
 //
 // NOTE(nick): Your array must define data
@@ -8430,7 +16037,23 @@ function void array__remove_ordered(Raw_Array *it, u64 item_size, i64 index, i64
 function void array__sort(Raw_Array *it, u64 item_size, Compare_Func cmp)
 {
     assert(item_size > 0);
-    QuickSort(it->data, it->count, item_size, cmp);
+
+    // NOTE(nick): the stock comparators only look at the key, so those can go to the radix sorts
+    if (cmp == compare_u32 && item_size == sizeof(u32)) radix_sort_u32((u32 *)it->data, it->count);
+    else if (cmp == compare_i32 && item_size == sizeof(i32)) radix_sort_i32((i32 *)it->data, it->count);
+    else if (cmp == compare_f32 && item_size == sizeof(f32)) radix_sort_f32((f32 *)it->data, it->count);
+    else if (cmp == compare_u64 && item_size == sizeof(u64)) radix_sort_u64((u64 *)it->data, it->count);
+    else if (cmp == compare_i64 && item_size == sizeof(i64)) radix_sort_i64((i64 *)it->data, it->count);
+    else if (cmp == compare_f64 && item_size == sizeof(f64)) radix_sort_f64((f64 *)it->data, it->count);
+    else if (cmp == compare_string && item_size == sizeof(String))
+    {
+        String_Array array = {it->count, it->count, (String *)it->data};
+        string_array_sort(&array);
+    }
+    else
+    {
+        QuickSort(it->data, it->count, item_size, cmp);
+    }
 }
 
 function i64 array__search(Raw_Array *it, u64 item_size, void *key, Compare_Func cmp)
@@ -8556,6 +16179,101 @@ function String Array_f64_to_string(Array_f64 a)
     return sprint("Array_f64[%d] {\n%.*s\n}", a.count, LIT(items));
 }
 
+//
+// NOTE(nick): parse every number in str, fields are split on any of the delimiter bytes and
+// can have whitespace around them (so a run of whitespace delimiters is one split). Every field
+// pushes one value, an empty field or one that isn't exactly a number pushes 0 and counts
+// towards bad_fields, which can be NULL.
+//
+
+force_inline function u8 *array__skip_whitespace(u8 *at, u8 *end)
+{
+    while (at < end && char_is_whitespace(*at)) at += 1;
+    return at;
+}
+
+// NOTE(nick): at is just past the number, returns just past the field's delimiter
+function u8 *array__end_field(u8 *at, u8 *end, b8 *is_delimiter, i64 used, b32 *bad)
+{
+    while (at < end && !is_delimiter[*at] && char_is_whitespace(*at)) at += 1;
+
+    if (used == 0 || (at < end && !is_delimiter[*at]))
+    {
+        *bad = true;
+        while (at < end && !is_delimiter[*at]) at += 1;
+    }
+
+    if (at < end) at += 1;
+    return at;
+}
+
+function Array_i64 array_i64_from_string(Arena *arena, String str, String delimiters, i64 *bad_fields)
+{
+    Array_i64 result = {0};
+    i64 bad_count = 0;
+
+    b8 is_delimiter[256] = {0};
+    for (i64 i = 0; i < delimiters.count; i += 1) is_delimiter[delimiters.data[i]] = true;
+
+    // NOTE(nick): just a starting guess, the array grows in place from there
+    array_reserve(arena, &result, str.count / 8 + 16);
+
+    u8 *end = str.data + str.count;
+    u8 *at = array__skip_whitespace(str.data, end);
+    while (at < end)
+    {
+        i64 value = 0;
+        i64 used = string_parse_i64(Str8(at, end - at), &value);
+
+        b32 bad = false;
+        at = array__end_field(at + used, end, is_delimiter, used, &bad);
+        if (bad)
+        {
+            value = 0;
+            bad_count += 1;
+        }
+        array_push(arena, &result, value);
+
+        at = array__skip_whitespace(at, end);
+    }
+
+    if (bad_fields) *bad_fields = bad_count;
+    return result;
+}
+
+function Array_f64 array_f64_from_string(Arena *arena, String str, String delimiters, i64 *bad_fields)
+{
+    Array_f64 result = {0};
+    i64 bad_count = 0;
+
+    b8 is_delimiter[256] = {0};
+    for (i64 i = 0; i < delimiters.count; i += 1) is_delimiter[delimiters.data[i]] = true;
+
+    array_reserve(arena, &result, str.count / 8 + 16);
+
+    u8 *end = str.data + str.count;
+    u8 *at = array__skip_whitespace(str.data, end);
+    while (at < end)
+    {
+        f64 value = 0;
+        i64 used = string_parse_f64(Str8(at, end - at), &value);
+
+        b32 bad = false;
+        at = array__end_field(at + used, end, is_delimiter, used, &bad);
+        if (bad)
+        {
+            value = 0;
+            bad_count += 1;
+        }
+        array_push(arena, &result, value);
+
+        at = array__skip_whitespace(at, end);
+    }
+
+    if (bad_fields) *bad_fields = bad_count;
+    return result;
+}
+
 #if LANG_CPP
 
 function String to_string(Array_i32 a) { return Array_i32_to_string(a); }
@@ -178,6 +178,7 @@ function Http http_delete(String url);
 function void http_process(Http *http);
 
 function Http_Header_Array http_parse_headers(Arena *arena, String headers);
+function String http_find_header(Http_Header_Array headers, String key);
 function Http_Request http_parse_request(String request);
 function String http_status_name_from_code(i32 status_code);
 function String http_content_type_from_extension(String ext);
@@ -893,17 +894,17 @@ function Http_Header_Array http_parse_headers(Arena *arena, String headers)
 {
     Http_Header_Array results = {0};
 
-    String_List lines = string_split(arena, headers, S("\r\n"));
+    String_Array lines = string_split(arena, headers, S("\r\n"));
 
     results.count = 0;
-    results.capacity = lines.node_count;
-    results.data = PushArray(arena, Http_Header, lines.node_count);
+    results.capacity = lines.count;
+    results.data = PushArray(arena, Http_Header, lines.count);
 
-    for (String_Node *node = lines.first; node != NULL; node = node->next)
+    for (i64 line_index = 0; line_index < lines.count; line_index += 1)
     {
-        String line = node->string;
+        String line = lines.data[line_index];
 
-        i64 index = string_find(line, S(":"), 0, 0);
+        i64 index = string_find_byte(line, ':', 0, 0);
         if (index < line.count)
         {
             Http_Header *it = &results.data[results.count];
@@ -916,6 +917,20 @@ function Http_Header_Array http_parse_headers(Arena *arena, String headers)
     return results;
 }
 
+// NOTE(nick): header names are case-insensitive, returns an empty string if it's missing
+function String http_find_header(Http_Header_Array headers, String key)
+{
+    for (i64 index = 0; index < headers.count; index += 1)
+    {
+        Http_Header *it = &headers.data[index];
+        if (string_match(it->key, key, MatchFlag_IgnoreCase))
+        {
+            return it->value;
+        }
+    }
+    return S("");
+}
+
 function Http_Request http_parse_request(String request)
 {
     Http_Request result = {0};
@@ -1034,17 +1049,8 @@ function void http_process(Http *http)
 
         if (http->response_headers.count)
         {
-            i64 content_type_index = string_find(http->response_headers, S("Content-Type:"), 0, MatchFlag_IgnoreCase);
-            content_type_index += S("Content-Type:").count;
-            i64 content_type_end_index = string_find(http->response_headers, S("\r\n"), content_type_index, 0);
-
-            if (
-                content_type_index < http->response_headers.count &&
-                content_type_end_index < http->response_headers.count
-            )
-            {
-                http->content_type = string_trim_whitespace(string_slice(http->response_headers, content_type_index, content_type_end_index));
-            }
+            Http_Header_Array headers = http_parse_headers(arena, http->response_headers);
+            http->content_type = http_find_header(headers, S("Content-Type"));
         }
 
         http->status = HttpStatus_Completed;
@@ -1217,22 +1223,28 @@ THREAD_PROC(http_responder_thread)
     if (!response.status_code) response.status_code = (response.body.count > 0) ? 200 : 500;
     if (!response.content_type.count) response.content_type = S("text/plain");
 
-    u32 capacity = 16 + response.headers.count;
-    String *array = PushArray(arena, String, capacity);
-    u32 count = 0;
-
     String status_name = http_status_name_from_code(response.status_code);
 
-    array[count++] = sprint("HTTP/1.0 %d %S\r\n", response.status_code, status_name);
+    String_Builder sb = sb_begin(arena, 256);
+
+    sb_push(arena, &sb, S("HTTP/1.0 "));
+    sb_push_i64(arena, &sb, response.status_code);
+    sb_push_byte(arena, &sb, ' ');
+    sb_push(arena, &sb, status_name);
+    sb_push(arena, &sb, S("\r\n"));
 
     if (response.content_type.count)
     {
-        array[count++] = sprint("Content-Type: %S\r\n", response.content_type);
+        sb_push(arena, &sb, S("Content-Type: "));
+        sb_push(arena, &sb, response.content_type);
+        sb_push(arena, &sb, S("\r\n"));
     }
 
     if (response.body.count)
     {
-        array[count++] = sprint("Content-Length: %d\r\n", response.body.count);
+        sb_push(arena, &sb, S("Content-Length: "));
+        sb_push_i64(arena, &sb, response.body.count);
+        sb_push(arena, &sb, S("\r\n"));
     }
 
     if (response.headers.count > 0)
@@ -1240,13 +1252,16 @@ THREAD_PROC(http_responder_thread)
         for (i64 index = 0; index < response.headers.count; index += 1)
         {
             Http_Header it = response.headers.data[index];
-            array[count++] = sprint("%S: %S\r\n", it.key, it.value);
+            sb_push(arena, &sb, it.key);
+            sb_push(arena, &sb, S(": "));
+            sb_push(arena, &sb, it.value);
+            sb_push(arena, &sb, S("\r\n"));
         }
     }
 
-    array[count++] = S("\r\n");
+    sb_push(arena, &sb, S("\r\n"));
 
-    String response_data = string_concat_array(arena, array, count);
+    String response_data = sb_to_string(arena, sb);
 
     socket_send(client, {}, response_data);
 
@@ -0,0 +1,380 @@
+#define impl
+#include "../na.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+// NOTE(nick): every benchmark runs BENCH_RUNS times and reports the fastest run, inputs come
+// from fixed seeds so numbers from different machines or commits compare
+#define BENCH_RUNS 5
+
+//
+// Arenas
+//
+
+function f64 bench_arena_fill(Arena_Flags flags, u64 size, u64 *checksum)
+{
+    f64 start = os_time();
+
+    Arena *arena = arena_alloc_with_flags(size + Megabytes(64), flags);
+    u64 chunk_size = Kilobytes(64);
+    u64 chunk_count = size / chunk_size;
+    u8 **chunks = (u8 **)malloc(chunk_count * sizeof(u8 *));
+    for (u64 i = 0; i < chunk_count; i += 1)
+    {
+        chunks[i] = PushArrayNoZero(arena, u8, chunk_size);
+        MemorySet(chunks[i], (u8)i, chunk_size);
+    }
+
+    // NOTE(nick): scattered reads afterwards, this is where fewer TLB misses show up
+    Random_Xoshiro rng = {0};
+    random_xoshiro_set_seed(&rng, 3);
+    for (u64 i = 0; i < Megabytes(4); i += 1)
+    {
+        u64 chunk = random_xoshiro_below(&rng, chunk_count);
+        *checksum += chunks[chunk][random_xoshiro_below(&rng, chunk_size)];
+    }
+
+    f64 result = os_time() - start;
+    free(chunks);
+    arena_free(arena);
+    return result;
+}
+
+function void bench_arenas(void)
+{
+    struct { char *name; Arena_Flags flags; } kinds[] = {
+        {"plain",      0},
+        {"prefault",   ArenaFlag_Prefault},
+        {"largepages", ArenaFlag_LargePages},
+        {"both",       ArenaFlag_LargePages|ArenaFlag_Prefault},
+    };
+
+    u64 size = Megabytes(256);
+    u64 checksum = 0;
+
+    print("arena fill 256MB + 4M random reads:");
+    for (u64 i = 0; i < ArrayCount(kinds); i += 1)
+    {
+        f64 best = F64_MAX;
+        for (i64 run = 0; run < BENCH_RUNS; run += 1)
+        {
+            best = Min(best, bench_arena_fill(kinds[i].flags, size, &checksum));
+        }
+        print(" %s %.1fms", kinds[i].name, best * 1000.0);
+    }
+    print(" (%llu)\n", (unsigned long long)checksum);
+}
+
+//
+// Strings
+//
+
+function void bench_string_find(void)
+{
+    Random_Xoshiro rng = {0};
+    random_xoshiro_set_seed(&rng, 11);
+
+    i64 count = Megabytes(16);
+    u8 *data = (u8 *)malloc(count);
+    for (i64 i = 0; i < count; i += 1) data[i] = 'a' + (u8)random_xoshiro_below(&rng, 26);
+    String text = Str8(data, count);
+
+    String patterns[] = {S("qzxjkvw"), S("thequickbrownfoxjumpsovers")};
+    for (u64 i = 0; i < ArrayCount(patterns); i += 1)
+    {
+        for (i64 ignore_case = 0; ignore_case < 2; ignore_case += 1)
+        {
+            Match_Flags flags = ignore_case ? MatchFlag_IgnoreCase : 0;
+            f64 best_find = F64_MAX;
+            f64 best_slow = F64_MAX;
+            i64 found = 0;
+            for (i64 run = 0; run < BENCH_RUNS; run += 1)
+            {
+                f64 start = os_time();
+                found += string_find(text, patterns[i], 0, flags);
+                f64 middle = os_time();
+                found += string__find_slow(text, patterns[i], 0, flags);
+                best_find = Min(best_find, middle - start);
+                best_slow = Min(best_slow, os_time() - middle);
+            }
+            print("string_find 16MB %d-byte%s: find %.2fms slow %.2fms (%d)\n",
+                (int)patterns[i].count, ignore_case ? " icase" : "", best_find * 1000.0, best_slow * 1000.0, (int)found);
+        }
+    }
+
+    free(data);
+}
+
+function void bench_string_find_any(void)
+{
+    Random_Xoshiro rng = {0};
+    random_xoshiro_set_seed(&rng, 12);
+
+    // NOTE(nick): text without any of the set's bytes, so every call scans all of it
+    i64 count = Megabytes(16);
+    u8 *data = (u8 *)malloc(count);
+    for (i64 i = 0; i < count; i += 1) data[i] = 'a' + (u8)random_xoshiro_below(&rng, 26);
+    String text = Str8(data, count);
+
+    String sets[] = {S("<>&"), S("<>&\""), S("<>&\"'=\\/"), S("<>&\"'=\\/\t\r\n;"), S("0123456789ABCDEF<>&\"'=\\/\t\r\n;")};
+    for (u64 i = 0; i < ArrayCount(sets); i += 1)
+    {
+        f64 best = F64_MAX;
+        i64 found = 0;
+        for (i64 run = 0; run < BENCH_RUNS; run += 1)
+        {
+            f64 start = os_time();
+            found += string_find_any(text, sets[i], 0, 0);
+            best = Min(best, os_time() - start);
+        }
+        print("string_find_any 16MB %d-byte set: %.2fms (%d)\n", (int)sets[i].count, best * 1000.0, (int)found);
+    }
+
+    free(data);
+}
+
+//
+// Formatting
+//
+
+#define BENCH_FORMAT_COUNT 1000000
+
+// NOTE(nick): ns per call, the arena is rewound every 1024 calls so it stays in cache
+#define BenchFormat(name, expr) do { \
+    f64 best = F64_MAX; \
+    for (i64 run = 0; run < BENCH_RUNS; run += 1) \
+    { \
+        f64 start = os_time(); \
+        for (i64 i = 0; i < BENCH_FORMAT_COUNT; i += 1) \
+        { \
+            String x = (expr); \
+            total += x.count; \
+            if ((i & 1023) == 0) arena_end_temp(temp); \
+        } \
+        best = Min(best, os_time() - start); \
+    } \
+    print("%-32s %.0fns\n", name, best * 1e9 / BENCH_FORMAT_COUNT); \
+} while (0)
+
+function void bench_format(void)
+{
+    Arena *arena = temp_arena();
+    M_Temp temp = arena_begin_temp(arena);
+    u64 total = 0;
+
+    BenchFormat("string_format i64 + f64", string_format(arena, "{} took {}ms", fmt_i64(i), fmt_f64(i * 0.25)));
+    BenchFormat("sprint %d %g", sprint("%d took %gms", (int)i, i * 0.25));
+    BenchFormat("string_format u64 + str", string_format(arena, "id={} name={}", fmt_u64(i), fmt_str(S("widget"))));
+    BenchFormat("sprint %u %.*s", sprint("id=%u name=%.*s", (u32)i, 6, "widget"));
+    BenchFormat("string_from_f64 (shortest)", string_from_f64(arena, (f64)i * 1.0000001e-3));
+    BenchFormat("sprint %.17g", sprint("%.17g", (f64)i * 1.0000001e-3));
+
+    arena_end_temp(temp);
+    print("(%llu)\n", (unsigned long long)total);
+}
+
+//
+// Parsing
+//
+
+function void bench_parse(void)
+{
+    Random_Xoshiro rng = {0};
+    random_xoshiro_set_seed(&rng, 17);
+
+    i64 count = 4000000;
+    Arena *arena = arena_alloc(Gigabytes(1));
+    char *ints = (char *)malloc(count * 24);
+    char *floats = (char *)malloc(count * 32);
+    i64 ints_size = 0;
+    i64 floats_size = 0;
+    for (i64 i = 0; i < count; i += 1)
+    {
+        i64 value = (i64)random_xoshiro_u64(&rng) >> random_xoshiro_below(&rng, 60);
+        ints_size += sprintf(ints + ints_size, "%lld,", (long long)value);
+        f64 x = (f64)(i64)random_xoshiro_u64(&rng) * 1e-12;
+        floats_size += sprintf(floats + floats_size, "%.*g,", 1 + (int)random_xoshiro_below(&rng, 17), x);
+    }
+
+    f64 best[4] = {F64_MAX, F64_MAX, F64_MAX, F64_MAX};
+    i64 total = 0;
+    for (i64 run = 0; run < BENCH_RUNS; run += 1)
+    {
+        M_Temp temp = arena_begin_temp(arena);
+
+        f64 start = os_time();
+        total += array_i64_from_string(arena, Str8(ints, ints_size), S(","), NULL).count;
+        best[0] = Min(best[0], os_time() - start);
+
+        start = os_time();
+        for (char *at = ints; at < ints + ints_size; at += 1) total += strtoll(at, &at, 10);
+        best[1] = Min(best[1], os_time() - start);
+
+        start = os_time();
+        total += array_f64_from_string(arena, Str8(floats, floats_size), S(","), NULL).count;
+        best[2] = Min(best[2], os_time() - start);
+
+        start = os_time();
+        f64 sum = 0;
+        for (char *at = floats; at < floats + floats_size; at += 1) sum += strtod(at, &at);
+        total += (i64)sum;
+        best[3] = Min(best[3], os_time() - start);
+
+        arena_end_temp(temp);
+    }
+
+    print("parse 4M ints: array_i64_from_string %.0f MB/s, strtoll loop %.0f MB/s\n",
+        ints_size / 1e6 / best[0], ints_size / 1e6 / best[1]);
+    print("parse 4M floats: array_f64_from_string %.0f MB/s, strtod loop %.0f MB/s (%lld)\n",
+        floats_size / 1e6 / best[2], floats_size / 1e6 / best[3], (long long)total);
+
+    free(ints);
+    free(floats);
+    arena_free(arena);
+}
+
+//
+// Hashing
+//
+
+typedef u64 Bench_Hash_Proc(void const *data, i64 len);
+
+function void bench_hash(void)
+{
+    Random_Xoshiro rng = {0};
+    random_xoshiro_set_seed(&rng, 21);
+
+    i64 size = Megabytes(1);
+    u8 *data = (u8 *)malloc(size);
+    for (i64 i = 0; i < size; i += 1) data[i] = (u8)random_xoshiro_u64(&rng);
+
+    u8 keys[4096 * 24];
+    i64 key_counts[4096];
+    for (i64 i = 0; i < 4096; i += 1) key_counts[i] = 5 + (i64)random_xoshiro_below(&rng, 16);
+    for (u64 i = 0; i < ArrayCount(keys); i += 1) keys[i] = (u8)random_xoshiro_u64(&rng);
+
+    struct { char *name; Bench_Hash_Proc *proc; i64 repeat; } hashes[] = {
+        {"hash64",   hash64,   2000},
+        {"murmur64", murmur64, 500},
+        {"fnv64a",   fnv64a,   100},
+    };
+
+    u64 total = 0;
+    for (u64 h = 0; h < ArrayCount(hashes); h += 1)
+    {
+        f64 best_bulk = F64_MAX;
+        f64 best_keys = F64_MAX;
+        i64 key_repeat = 10000000;
+        for (i64 run = 0; run < BENCH_RUNS; run += 1)
+        {
+            f64 start = os_time();
+            for (i64 i = 0; i < hashes[h].repeat; i += 1) total += hashes[h].proc(data, size);
+            best_bulk = Min(best_bulk, os_time() - start);
+
+            start = os_time();
+            for (i64 i = 0; i < key_repeat; i += 1)
+            {
+                i64 key = i & 4095;
+                total ^= hashes[h].proc(keys + key * 24, key_counts[key]);
+            }
+            best_keys = Min(best_keys, os_time() - start);
+        }
+
+        print("%-8s 1MB %.2f GB/s, 5-20 byte keys %.1fns\n", hashes[h].name,
+            (f64)size * hashes[h].repeat / 1e9 / best_bulk, best_keys * 1e9 / key_repeat);
+    }
+    print("(%llu)\n", (unsigned long long)total);
+
+    free(data);
+}
+
+//
+// Sorting
+//
+
+function i32 bench_compare_u64(void *a, void *b) { return compare_u64(a, b); }
+function i32 bench_compare_u32(void *a, void *b) { return compare_u32(a, b); }
+function i32 bench_compare_f64(void *a, void *b) { return compare_f64(a, b); }
+function i32 bench_compare_string(void *a, void *b) { return compare_string(a, b); }
+
+#define BenchSort(name, input, work, count, sort_call, radix_call) do { \
+    f64 best_sort = F64_MAX; \
+    f64 best_radix = F64_MAX; \
+    for (i64 run = 0; run < BENCH_RUNS; run += 1) \
+    { \
+        MemoryCopy((work), (input), (count) * sizeof(*(work))); \
+        f64 start = os_time(); \
+        sort_call; \
+        best_sort = Min(best_sort, os_time() - start); \
+        MemoryCopy((work), (input), (count) * sizeof(*(work))); \
+        start = os_time(); \
+        radix_call; \
+        best_radix = Min(best_radix, os_time() - start); \
+    } \
+    print("%-12s memory_sort %.0fms, radix %.0fms\n", name, best_sort * 1000.0, best_radix * 1000.0); \
+} while (0)
+
+function void bench_sort(void)
+{
+    Random_Xoshiro rng = {0};
+    random_xoshiro_set_seed(&rng, 25);
+
+    i64 count = 4000000;
+    u64 *input = (u64 *)malloc(count * sizeof(u64));
+    u64 *work = (u64 *)malloc(count * sizeof(u64));
+
+    random_xoshiro_fill_u64(&rng, input, count);
+    BenchSort("4M u64", input, work, count,
+        memory_sort(work, count, sizeof(u64), bench_compare_u64),
+        radix_sort_u64(work, count));
+
+    f64 *input_f64 = (f64 *)input;
+    f64 *work_f64 = (f64 *)work;
+    for (i64 i = 0; i < count; i += 1) input_f64[i] = (f64)(i64)random_xoshiro_u64(&rng) * 1e-10;
+    BenchSort("4M f64", input_f64, work_f64, count,
+        memory_sort(work_f64, count, sizeof(f64), bench_compare_f64),
+        radix_sort_f64(work_f64, count));
+
+    u32 *input_u32 = (u32 *)input;
+    u32 *work_u32 = (u32 *)work;
+    for (i64 i = 0; i < count; i += 1) input_u32[i] = random_xoshiro_u32(&rng);
+    BenchSort("4M u32", input_u32, work_u32, count,
+        memory_sort(work_u32, count, sizeof(u32), bench_compare_u32),
+        radix_sort_u32(work_u32, count));
+
+    i64 string_count = 1000000;
+    Arena *arena = arena_alloc(Megabytes(64));
+    String *strings = PushArrayNoZero(arena, String, string_count);
+    String *work_strings = PushArrayNoZero(arena, String, string_count);
+    for (i64 i = 0; i < string_count; i += 1)
+    {
+        i64 length = 8 + (i64)random_xoshiro_below(&rng, 25);
+        u8 *data = PushArrayNoZero(arena, u8, length);
+        for (i64 j = 0; j < length; j += 1) data[j] = 'a' + (u8)random_xoshiro_below(&rng, 26);
+        strings[i] = Str8(data, length);
+    }
+    String_Array array = {string_count, string_count, work_strings};
+    BenchSort("1M strings", strings, work_strings, string_count,
+        memory_sort(work_strings, string_count, sizeof(String), bench_compare_string),
+        string_array_sort(&array));
+
+    arena_free(arena);
+    free(input);
+    free(work);
+}
+
+int main()
+{
+    os_init();
+
+    bench_arenas();
+    bench_string_find();
+    bench_string_find_any();
+    bench_format();
+    bench_parse();
+    bench_hash();
+    bench_sort();
+
+    return 0;
+}
@@ -4,6 +4,106 @@
 // #include "../na_net.h"
 
 #include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+
+typedef struct Heap_Test_Items Heap_Test_Items;
+struct Heap_Test_Items
+{
+    void **data;
+    i64 count;
+};
+
+function THREAD_PROC(heap_test_free_proc)
+{
+    Heap_Test_Items *items = (Heap_Test_Items *)data;
+    for (i64 i = 0; i < items->count; i += 1) heap_free(items->data[i]);
+    return 0;
+}
+
+typedef struct Shared_Arena_Test Shared_Arena_Test;
+struct Shared_Arena_Test
+{
+    Arena *arena;
+    u8 id;
+    b32 ok;
+    u64 most_used;
+};
+
+function THREAD_PROC(shared_arena_test_proc)
+{
+    Shared_Arena_Test *test = (Shared_Arena_Test *)data;
+    test->ok = true;
+
+    u8 *pushed[1000];
+    u64 sizes[1000];
+    for (u64 i = 0; i < ArrayCount(pushed); i += 1)
+    {
+        u64 align = (u64)1 << (i % 7);
+        sizes[i] = 1 + (i * 7 + test->id) % 61;
+        test->most_used += sizes[i] + align - 1;
+        pushed[i] = (u8 *)arena_push(test->arena, sizes[i], align, false);
+        if (!pushed[i] || ((usize)pushed[i] & (align - 1)) != 0)
+        {
+            test->ok = false;
+            return 0;
+        }
+        MemorySet(pushed[i], test->id, sizes[i]);
+    }
+
+    for (u64 i = 0; i < ArrayCount(pushed); i += 1)
+    {
+        for (u64 j = 0; j < sizes[i]; j += 1)
+        {
+            if (pushed[i][j] != test->id) test->ok = false;
+        }
+    }
+    return 0;
+}
+
+function b32 split_test_matches(String_Split_Iter it, String *expected, i64 expected_count)
+{
+    i64 count = 0;
+    String piece;
+    while (string_split_next(&it, &piece))
+    {
+        if (count >= expected_count || !string_equals(piece, expected[count])) return false;
+        count += 1;
+    }
+    return count == expected_count;
+}
+
+// NOTE(nick): reference orders for the radix sort test, written out separately from na.h's own
+// key mapping: 0 unsigned, 1 signed, 2 float bits (negatives reversed, below positives)
+static i32 radix_test_mode = 0;
+
+function u64 radix_test_key_u64(u64 bits)
+{
+    if (radix_test_mode == 1) return bits ^ 0x8000000000000000ull;
+    if (radix_test_mode == 2) return (bits >> 63) ? ~bits : (bits | 0x8000000000000000ull);
+    return bits;
+}
+
+function u32 radix_test_key_u32(u32 bits)
+{
+    if (radix_test_mode == 1) return bits ^ 0x80000000u;
+    if (radix_test_mode == 2) return (bits >> 31) ? ~bits : (bits | 0x80000000u);
+    return bits;
+}
+
+function int radix_test_compare_u64(const void *a, const void *b)
+{
+    u64 x = radix_test_key_u64(*(u64 *)a);
+    u64 y = radix_test_key_u64(*(u64 *)b);
+    return (x > y) - (x < y);
+}
+
+function int radix_test_compare_u32(const void *a, const void *b)
+{
+    u32 x = radix_test_key_u32(*(u32 *)a);
+    u32 y = radix_test_key_u32(*(u32 *)b);
+    return (x > y) - (x < y);
+}
 
 int main()
 {
@@ -11,6 +111,973 @@ int main()
 
     print("Init time: %fs\n", os_time());
     print("Hello, Sailor!\n");
+
+    // NOTE(nick): debug arenas (what ARENA_DEBUG gives every unshared arena) can't be snapshotted
+    {
+        Arena *arena = arena_alloc_with_flags(Megabytes(1), ArenaFlag_Debug);
+        u8 *data = PushArray(arena, u8, 100);
+        data[99] = 1;
+        arena_pop(arena, 100);
+        assert(!arena_save_snapshot(arena, S("snapshot.bin")));
+        arena_free(arena);
+
+        arena = arena_alloc_with_flags(Megabytes(1), 0);
+        data = PushArray(arena, u8, 100);
+        data[99] = 1;
+        b32 saved = arena_save_snapshot(arena, S("snapshot.bin"));
+        assert(saved == !ARENA_DEBUG);
+        arena_free(arena);
+
+        if (saved)
+        {
+            Arena *loaded = arena_load_snapshot(S("snapshot.bin"), 0, NULL);
+            assert(loaded && loaded->pos == 100 && loaded->data[99] == 1);
+            arena_free(loaded);
+            os_delete_file(S("snapshot.bin"));
+        }
+    }
+
+    // NOTE(nick): string_find against the byte-at-a-time search, with every flag combination,
+    // start offsets, patterns cut from the text (some with the case flipped) and long texts
+    // that cross several vector blocks
+    {
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 11);
+
+        u8 text[4096];
+        u8 pattern[80];
+        String alphabets[] = {S("ab"), S("aAbB"), S("abc/\\"), Str8((u8 *)"\x00\xff\x80 zZ", 6)};
+        for (i64 trial = 0; trial < 40000; trial += 1)
+        {
+            String alphabet = alphabets[trial % ArrayCount(alphabets)];
+            i64 text_count = (i64)random_xoshiro_below(&rng, (trial % 50 == 0) ? sizeof(text) : 200);
+            i64 pattern_count = (i64)random_xoshiro_below(&rng, (trial % 7 == 0) ? 70 : 9);
+            for (i64 i = 0; i < text_count; i += 1)
+            {
+                text[i] = alphabet.data[random_xoshiro_below(&rng, alphabet.count)];
+            }
+
+            if (pattern_count && pattern_count <= text_count && random_xoshiro_below(&rng, 2))
+            {
+                i64 offset = (i64)random_xoshiro_below(&rng, text_count - pattern_count + 1);
+                MemoryCopy(pattern, text + offset, pattern_count);
+                if (random_xoshiro_below(&rng, 2)) pattern[random_xoshiro_below(&rng, pattern_count)] ^= 0x20;
+            }
+            else
+            {
+                for (i64 i = 0; i < pattern_count; i += 1)
+                {
+                    pattern[i] = alphabet.data[random_xoshiro_below(&rng, alphabet.count)];
+                }
+            }
+
+            i64 start = text_count ? (i64)random_xoshiro_below(&rng, text_count + 1) : 0;
+            if (random_xoshiro_below(&rng, 2)) start = 0;
+            Match_Flags flags = (Match_Flags)random_xoshiro_below(&rng, 16);
+
+            String str = Str8(text, text_count);
+            String search = Str8(pattern, pattern_count);
+            assert(string_find(str, search, start, flags) == string__find_slow(str, search, start, flags));
+        }
+    }
+
+    // NOTE(nick): string_find_any against a plain loop, with sets small enough for the compare
+    // chain and big enough for the lookup table, bytes from all 256 values, both directions
+    {
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 12);
+
+        u8 text[300];
+        u8 set[40];
+        for (i64 trial = 0; trial < 20000; trial += 1)
+        {
+            i64 text_count = (i64)random_xoshiro_below(&rng, sizeof(text));
+            i64 set_count = 1 + (i64)random_xoshiro_below(&rng, sizeof(set));
+            for (i64 i = 0; i < set_count; i += 1) set[i] = (u8)random_xoshiro_below(&rng, 256);
+            for (i64 i = 0; i < text_count; i += 1) text[i] = (u8)random_xoshiro_below(&rng, 256);
+
+            b8 in_set[256] = {0};
+            for (i64 i = 0; i < set_count; i += 1) in_set[set[i]] = true;
+
+            i64 start = (i64)random_xoshiro_below(&rng, text_count + 1);
+            i64 first = text_count;
+            i64 last = text_count;
+            for (i64 i = start; i < text_count; i += 1)
+            {
+                if (in_set[text[i]])
+                {
+                    if (first == text_count) first = i;
+                    last = i;
+                }
+            }
+
+            String str = Str8(text, text_count);
+            String bytes = Str8(set, set_count);
+            assert(string_find_any(str, bytes, start, 0) == first);
+            assert(string_find_any(str, bytes, start, MatchFlag_FindLast) == last);
+        }
+    }
+
+    // NOTE(nick): split iterators keep empty fields unless told not to, and lines drop the '\r' of "\r\n"
+    {
+        String lines[] = {S("a"), S("b"), S(""), S("c\rd"), S("")};
+        assert(split_test_matches(string_split_lines(S("a\r\nb\n\r\nc\rd\n\r\n"), 0), lines, 5));
+        String lines_skip[] = {S("a"), S("b"), S("c\rd")};
+        assert(split_test_matches(string_split_lines(S("a\r\nb\n\r\nc\rd\n\r\n"), SplitFlag_SkipEmpty), lines_skip, 3));
+        String last_line[] = {S("x")};
+        assert(split_test_matches(string_split_lines(S("x"), 0), last_line, 1));
+        assert(split_test_matches(string_split_lines(S(""), 0), NULL, 0));
+
+        String fields[] = {S(""), S("a"), S(""), S("b"), S("")};
+        assert(split_test_matches(string_split_by(S(",a,,b,"), S(","), 0), fields, 5));
+        String fields_skip[] = {S("a"), S("b")};
+        assert(split_test_matches(string_split_by(S(",a,,b,"), S(","), SplitFlag_SkipEmpty), fields_skip, 2));
+        assert(split_test_matches(string_split_by(S(""), S(","), 0), NULL, 0));
+
+        String words[] = {S("a"), S("b"), S("")};
+        assert(split_test_matches(string_split_by(S("a::b::"), S("::"), 0), words, 3));
+        String any[] = {S("a"), S(""), S("b"), S("c")};
+        assert(split_test_matches(string_split_by_any(S("a; b,c"), S(";, "), 0), any, 4));
+    }
+
+    // NOTE(nick): tokenizer words, delimiters, quotes with escapes, doubled quotes and an unclosed quote
+    {
+        String_Tokenizer_Options options = {0};
+        options.whitespace = S(" \t");
+        options.delimiters = S("=,");
+        options.quotes = S("\"'");
+        options.escape = '\\';
+
+        String_Tokenizer it = string_tokenizer_make(S("key = \"va\\\"l ue\",'x''y'\tz \"open"), options);
+        String_Token token;
+        Token_Kind kinds[] = {Token_Word, Token_Delimiter, Token_Quoted, Token_Delimiter, Token_Quoted, Token_Quoted, Token_Word, Token_Quoted};
+        String texts[] = {S("key"), S("="), S("va\\\"l ue"), S(","), S("x"), S("y"), S("z"), S("open")};
+        i64 indexes[] = {0, 4, 6, 16, 17, 20, 24, 26};
+        for (u64 i = 0; i < ArrayCount(kinds); i += 1)
+        {
+            assert(string_tokenizer_next(&it, &token));
+            assert(token.kind == kinds[i] && string_equals(token.text, texts[i]) && token.index == indexes[i]);
+            assert(token.has_escapes == (i == 2));
+        }
+        assert(!string_tokenizer_next(&it, &token));
+
+        // NOTE(nick): CSV style, the quote escapes itself
+        options.delimiters = S(",");
+        options.quotes = S("\"");
+        options.escape = '"';
+        it = string_tokenizer_make(S("\"a\"\"b\",c"), options);
+        assert(string_tokenizer_next(&it, &token) && token.kind == Token_Quoted && token.has_escapes);
+        assert(string_equals(token.text, S("a\"\"b")));
+        assert(string_equals(string_unescape(temp_arena(), token.text, '"'), S("a\"b")));
+        assert(string_tokenizer_next(&it, &token) && token.kind == Token_Delimiter);
+        assert(string_tokenizer_next(&it, &token) && token.kind == Token_Word && string_equals(token.text, S("c")));
+        assert(!string_tokenizer_next(&it, &token));
+    }
+
+    // NOTE(nick): String_Matcher with every byte value in its patterns, plus a duplicate
+    {
+        Arena *arena = arena_alloc(Megabytes(1));
+
+        u8 bytes[256];
+        for (u32 i = 0; i < 256; i += 1) bytes[i] = (u8)i;
+
+        String_Array patterns = {0};
+        patterns.count = 258;
+        patterns.data = PushArray(arena, String, patterns.count);
+        for (u32 i = 0; i < 256; i += 1) patterns.data[i] = Str8(bytes + i, 1);
+        patterns.data[256] = Str8(bytes + 254, 2);
+        patterns.data[257] = Str8(bytes + 255, 1);
+
+        String_Matcher *matcher = string_matcher_make(arena, patterns, 0);
+        String_Match_Array matches = string_matcher_find_all(arena, matcher, Str8(bytes, 256));
+
+        // NOTE(nick): the last byte ends the pair, then its own pattern and the duplicate
+        assert(matches.count == 258);
+        for (i64 i = 0; i < 255; i += 1)
+        {
+            assert(matches.data[i].index == i && matches.data[i].pattern == i);
+        }
+        assert(matches.data[255].index == 254 && matches.data[255].pattern == 256);
+        assert(matches.data[256].index == 255 && matches.data[256].pattern == 255);
+        assert(matches.data[257].index == 255 && matches.data[257].pattern == 257);
+
+        arena_free(arena);
+    }
+
+    // NOTE(nick): String_Matcher against a brute force search, with overlapping matches,
+    // duplicate and case-folded patterns and empty patterns (which never match)
+    {
+        Arena *arena = arena_alloc(Megabytes(16));
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 13);
+
+        u8 alphabet[] = {'a', 'b', 'A', 'B', 0, 0xff};
+        for (i64 trial = 0; trial < 500; trial += 1)
+        {
+            M_Temp temp = arena_begin_temp(arena);
+
+            Match_Flags flags = (trial & 1) ? MatchFlag_IgnoreCase : 0;
+            u64 alphabet_count = (trial % 3 == 0) ? 6 : 4;
+
+            String_Array patterns = {0};
+            patterns.count = 1 + random_xoshiro_below(&rng, 12);
+            patterns.data = PushArray(arena, String, patterns.count);
+            for (i64 i = 0; i < patterns.count; i += 1)
+            {
+                u64 choice = random_xoshiro_below(&rng, 4);
+                if (i > 0 && choice == 0)
+                {
+                    // NOTE(nick): an exact duplicate or a copy with the case flipped
+                    String copy = patterns.data[random_xoshiro_below(&rng, i)];
+                    u8 *data = PushArray(arena, u8, copy.count);
+                    for (i64 j = 0; j < copy.count; j += 1)
+                    {
+                        data[j] = (random_xoshiro_below(&rng, 2) && char_is_alpha(copy.data[j])) ? copy.data[j] ^ 0x20 : copy.data[j];
+                    }
+                    patterns.data[i] = Str8(data, copy.count);
+                }
+                else
+                {
+                    i64 count = random_xoshiro_below(&rng, 5);
+                    u8 *data = PushArray(arena, u8, count);
+                    for (i64 j = 0; j < count; j += 1) data[j] = alphabet[random_xoshiro_below(&rng, alphabet_count)];
+                    patterns.data[i] = Str8(data, count);
+                }
+            }
+
+            i64 text_count = random_xoshiro_below(&rng, 200);
+            u8 *text_data = PushArray(arena, u8, text_count);
+            for (i64 i = 0; i < text_count; i += 1) text_data[i] = alphabet[random_xoshiro_below(&rng, alphabet_count)];
+            String text = Str8(text_data, text_count);
+
+            String_Matcher *matcher = string_matcher_make(arena, patterns, flags);
+            String_Match_Array matches = string_matcher_find_all(arena, matcher, text);
+            assert(((usize)matches.data & (AlignOf(String_Match) - 1)) == 0);
+
+            b8 *expected = PushArray(arena, b8, text_count * patterns.count + 1);
+            i64 expected_count = 0;
+            for (i64 at = 0; at < text_count; at += 1)
+            {
+                for (i64 i = 0; i < patterns.count; i += 1)
+                {
+                    String pattern = patterns.data[i];
+                    if (pattern.count > 0 && string_match(string_slice(text, at, at + pattern.count), pattern, flags))
+                    {
+                        expected[at * patterns.count + i] = true;
+                        expected_count += 1;
+                    }
+                }
+            }
+
+            assert(matches.count == expected_count);
+            for (i64 i = 0; i < matches.count; i += 1)
+            {
+                String_Match match = matches.data[i];
+                b8 *slot = &expected[match.index * patterns.count + match.pattern];
+                assert(*slot);
+                *slot = false;
+            }
+
+            arena_end_temp(temp);
+        }
+
+        arena_free(arena);
+    }
+
+    // NOTE(nick): shared arena pushes from several threads never overlap, and a push that
+    // doesn't fit leaves the arena as it was
+    {
+        Arena *arena = arena_alloc_with_flags(Megabytes(4), ArenaFlag_Shared);
+
+        Shared_Arena_Test tests[4];
+        Thread threads[4];
+        for (u64 i = 0; i < ArrayCount(threads); i += 1)
+        {
+            tests[i].arena = arena;
+            tests[i].id = (u8)(i + 1);
+            tests[i].most_used = 0;
+            threads[i] = os_thread_create(shared_arena_test_proc, &tests[i], 0);
+        }
+        // NOTE(nick): padding is the only overhead, retried pushes don't leave gaps behind
+        u64 most_used = 0;
+        for (u64 i = 0; i < ArrayCount(threads); i += 1)
+        {
+            os_thread_await(threads[i]);
+            assert(tests[i].ok);
+            most_used += tests[i].most_used;
+        }
+        assert(arena->pos <= most_used);
+
+        u64 pos = arena->pos;
+        assert(arena_push(arena, Megabytes(8), 8, false) == NULL);
+        assert(arena->pos == pos);
+        assert(arena_push(arena, 16, 8, false) != NULL);
+
+        arena_free(arena);
+    }
+
+    // NOTE(nick): heap size classes, large and aligned blocks, page reuse and frees from another thread
+    {
+        for (u64 size = 1; size <= Kilobytes(100); size += size / 8 + 1)
+        {
+            u8 *data = (u8 *)heap_alloc(size);
+            assert(data && ((usize)data & 15) == 0);
+            assert(heap_size_of(data) >= size);
+            MemorySet(data, 0xab, heap_size_of(data));
+            heap_free(data);
+        }
+
+        u8 *large = (u8 *)heap_alloc(40000);
+        MemorySet(large, 1, heap_size_of(large));
+        large = (u8 *)heap_realloc(large, 300000);
+        assert(large[39999] == 1);
+        MemorySet(large, 2, heap_size_of(large));
+        heap_free(large);
+
+        u32 alignments[] = {32, 256, Kilobytes(4), Kilobytes(64), Megabytes(1)};
+        for (u64 i = 0; i < ArrayCount(alignments); i += 1)
+        {
+            u32 alignment = alignments[i];
+            u8 *data = (u8 *)heap_alloc_aligned(100, alignment);
+            assert(((usize)data & (alignment - 1)) == 0);
+            MemorySet(data, 3, 100);
+
+            data = (u8 *)allocator_realloc_aligned(heap_allocator(), data, 5000, 100, alignment);
+            assert(((usize)data & (alignment - 1)) == 0);
+            assert(data[99] == 3 && data[100] == 0 && data[4999] == 0);
+
+            data = (u8 *)heap_realloc_aligned(data, Kilobytes(200), alignment);
+            assert(((usize)data & (alignment - 1)) == 0);
+            assert(data[99] == 3);
+            MemorySet(data, 4, heap_size_of(data));
+            heap_free(data);
+        }
+
+        // NOTE(nick): a second round of the same allocations has to come out of the same pages
+        Heap_Test_Items items = {0};
+        items.count = 20000;
+        items.data = (void **)heap_alloc(items.count * sizeof(void *));
+
+        u64 page_counts[3] = {0};
+        for (i64 round = 0; round < 3; round += 1)
+        {
+            for (i64 i = 0; i < items.count; i += 1)
+            {
+                items.data[i] = heap_alloc(48);
+                *(i64 *)items.data[i] = i;
+            }
+            for (i64 i = 0; i < items.count; i += 1)
+            {
+                assert(*(i64 *)items.data[i] == i);
+            }
+
+            // NOTE(nick): the last round is freed by another thread, those go back through the remote list
+            if (round < 2)
+            {
+                for (i64 i = 0; i < items.count; i += 1) heap_free(items.data[i]);
+            }
+            else
+            {
+                os_thread_await(os_thread_create(heap_test_free_proc, &items, 0));
+            }
+
+            page_counts[round] = heap__state.next_page;
+        }
+        assert(page_counts[1] == page_counts[0]);
+
+        for (i64 i = 0; i < items.count; i += 1) items.data[i] = heap_alloc(48);
+        assert(heap__state.next_page == page_counts[2]);
+        for (i64 i = 0; i < items.count; i += 1) heap_free(items.data[i]);
+
+        heap_free(items.data);
+    }
+
+    // NOTE(nick): pool slots are aligned and zeroed, freed slots come back first and a reset
+    // reuses the same slabs without growing the arena
+    {
+        Arena *arena = arena_alloc(Megabytes(1));
+        Pool pool = {0};
+        pool_init(&pool, arena, 24, 64, 16);
+
+        u8 *items[100];
+        for (u64 i = 0; i < ArrayCount(items); i += 1)
+        {
+            items[i] = (u8 *)pool_alloc(&pool, true);
+            assert(items[i] && ((usize)items[i] & 63) == 0);
+            for (u64 j = 0; j < 24; j += 1) assert(items[i][j] == 0);
+            MemorySet(items[i], (u8)i, 24);
+        }
+        assert(pool.count == ArrayCount(items));
+
+        for (u64 i = 0; i < ArrayCount(items); i += 2) pool_free(&pool, items[i]);
+        assert(pool.count == ArrayCount(items) / 2);
+        for (u64 i = 1; i < ArrayCount(items); i += 2)
+        {
+            for (u64 j = 0; j < 24; j += 1) assert(items[i][j] == (u8)i);
+        }
+
+        for (u64 i = 0; i < ArrayCount(items) / 2; i += 1)
+        {
+            u8 *again = (u8 *)pool_alloc(&pool, false);
+            b32 was_freed = false;
+            for (u64 j = 0; j < ArrayCount(items); j += 2) was_freed |= (again == items[j]);
+            assert(was_freed);
+        }
+
+        u64 arena_pos = arena->pos;
+        pool_reset(&pool);
+        assert(pool.count == 0);
+        for (u64 i = 0; i < ArrayCount(items); i += 1)
+        {
+            assert(pool_alloc(&pool, true) == items[i]);
+        }
+        assert(arena->pos == arena_pos);
+
+        arena_free(arena);
+    }
+
+    // NOTE(nick): hash64 fed in random chunks (including empty ones) matches the one-shot hash,
+    // for every length up to a few blocks and from unaligned starts
+    {
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 21);
+
+        u8 data[4096];
+        for (u64 i = 0; i < ArrayCount(data); i += 1) data[i] = (u8)random_xoshiro_u64(&rng);
+
+        for (i64 trial = 0; trial < 5000; trial += 1)
+        {
+            i64 count = trial < 600 ? trial : (i64)random_xoshiro_below(&rng, sizeof(data) - 8);
+            u8 *at = data + random_xoshiro_below(&rng, 8);
+            u64 seed = (trial & 1) ? random_xoshiro_u64(&rng) : 0;
+
+            u64 expected = hash64_seed(at, count, seed);
+            if (!seed) assert(hash64(at, count) == expected);
+
+            Hash64_State state = hash64_begin(seed);
+            i64 done = 0;
+            while (done < count)
+            {
+                i64 step = random_xoshiro_below(&rng, 4) == 0 ? 0 : 1 + (i64)random_xoshiro_below(&rng, (trial & 2) ? 17 : 200);
+                step = Min(step, count - done);
+                hash64_update(&state, at + done, step);
+                done += step;
+            }
+            assert(hash64_end(&state) == expected);
+        }
+    }
+
+    // NOTE(nick): flipping any input bit flips each output bit about half the time. With 1000
+    // trials noise alone gets the worst of the ~100K (input, output) pairs to about 0.07.
+    {
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 22);
+
+        i64 trials = 1000;
+        i64 counts[] = {3, 8, 16, 17, 48, 100};
+        f64 worst = 0;
+        for (u64 c = 0; c < ArrayCount(counts); c += 1)
+        {
+            i64 count = counts[c];
+            static u32 flips[800][64];
+            MemoryZero(flips, sizeof(flips));
+
+            for (i64 trial = 0; trial < trials; trial += 1)
+            {
+                u8 key[100];
+                for (i64 i = 0; i < count; i += 1) key[i] = (u8)random_xoshiro_u64(&rng);
+                u64 hash = hash64(key, count);
+
+                for (i64 bit = 0; bit < count * 8; bit += 1)
+                {
+                    key[bit / 8] ^= (u8)(1 << (bit % 8));
+                    u64 diff = hash ^ hash64(key, count);
+                    key[bit / 8] ^= (u8)(1 << (bit % 8));
+                    for (i64 out = 0; out < 64; out += 1) flips[bit][out] += (diff >> out) & 1;
+                }
+            }
+
+            for (i64 bit = 0; bit < count * 8; bit += 1)
+            {
+                for (i64 out = 0; out < 64; out += 1)
+                {
+                    f64 bias = abs_f64(flips[bit][out] / (f64)trials - 0.5);
+                    worst = Max(worst, bias);
+                }
+            }
+        }
+        assert(worst < 0.1);
+    }
+
+    // NOTE(nick): checksum check values, then random data against bit-at-a-time versions, in one
+    // call and in chunks (Adler-32 past the 5552 bytes it can sum before reducing)
+    {
+        String check = S("123456789");
+        assert(crc32_from_string(check) == 0xCBF43926);
+        assert(crc32c_from_string(check) == 0xE3069283);
+        assert(adler32_from_string(check) == 0x091E01DE);
+        assert(crc32(NULL, 0) == 0 && crc32c(NULL, 0) == 0 && adler32(NULL, 0) == 1);
+
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 22);
+
+        static u8 data[20000];
+        for (u64 i = 0; i < ArrayCount(data); i += 1) data[i] = (u8)random_xoshiro_u64(&rng);
+
+        for (i64 trial = 0; trial < 200; trial += 1)
+        {
+            i64 count = trial < 100 ? trial : (i64)random_xoshiro_below(&rng, sizeof(data) - 8);
+            u8 *at = data + random_xoshiro_below(&rng, 8);
+
+            u32 expected_crc32 = 0xffffffff;
+            u32 expected_crc32c = 0xffffffff;
+            u32 a = 1;
+            u32 b = 0;
+            for (i64 i = 0; i < count; i += 1)
+            {
+                expected_crc32 ^= at[i];
+                expected_crc32c ^= at[i];
+                for (i64 bit = 0; bit < 8; bit += 1)
+                {
+                    expected_crc32 = (expected_crc32 >> 1) ^ (0xEDB88320 & (0 - (expected_crc32 & 1)));
+                    expected_crc32c = (expected_crc32c >> 1) ^ (0x82F63B78 & (0 - (expected_crc32c & 1)));
+                }
+                a = (a + at[i]) % 65521;
+                b = (b + a) % 65521;
+            }
+            expected_crc32 = ~expected_crc32;
+            expected_crc32c = ~expected_crc32c;
+            u32 expected_adler32 = (b << 16) | a;
+
+            assert(crc32(at, count) == expected_crc32);
+            assert(crc32c(at, count) == expected_crc32c);
+            assert(adler32(at, count) == expected_adler32);
+
+            u32 chunked_crc32 = 0;
+            u32 chunked_crc32c = 0;
+            u32 chunked_adler32 = 1;
+            i64 done = 0;
+            while (done < count)
+            {
+                i64 step = (i64)random_xoshiro_below(&rng, 7000);
+                step = Min(step, count - done);
+                chunked_crc32 = crc32_update(chunked_crc32, at + done, step);
+                chunked_crc32c = crc32c_update(chunked_crc32c, at + done, step);
+                chunked_adler32 = adler32_update(chunked_adler32, at + done, step);
+                done += step;
+            }
+            assert(chunked_crc32 == expected_crc32);
+            assert(chunked_crc32c == expected_crc32c);
+            assert(chunked_adler32 == expected_adler32);
+        }
+    }
+
+    // NOTE(nick): base64 test vectors (RFC 4648), random round trips long enough for the vector
+    // paths, and the streaming codecs fed in random chunks with line breaks to skip
+    {
+        Arena *arena = arena_alloc(Megabytes(4));
+
+        String plain[] = {S(""), S("f"), S("fo"), S("foo"), S("foob"), S("fooba"), S("foobar")};
+        String encoded[] = {S(""), S("Zg=="), S("Zm8="), S("Zm9v"), S("Zm9vYg=="), S("Zm9vYmE="), S("Zm9vYmFy")};
+        for (u64 i = 0; i < ArrayCount(plain); i += 1)
+        {
+            assert(string_equals(base64_encode(arena, plain[i], false), encoded[i]));
+            assert(string_equals(base64_decode(arena, encoded[i]), plain[i]));
+        }
+        assert(string_equals(base64_encode(arena, S("\xfb\xff"), false), S("+/8=")));
+        assert(string_equals(base64_encode(arena, S("\xfb\xff"), true), S("-_8")));
+        assert(string_equals(base64_decode(arena, S("Zm9v!Zm9v")), S("foo")));
+        assert(string_equals(base64_decode_skip_whitespace(arena, S("Zm9v\r\nYmFy")), S("foobar")));
+
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 23);
+
+        u8 data[1000];
+        u8 text[2000];
+        u8 out[2000];
+        for (i64 trial = 0; trial < 1000; trial += 1)
+        {
+            M_Temp temp = arena_begin_temp(arena);
+
+            i64 count = (i64)random_xoshiro_below(&rng, sizeof(data));
+            for (i64 i = 0; i < count; i += 1) data[i] = (u8)random_xoshiro_u64(&rng);
+            String input = Str8(data, count);
+            bool url_safe = trial & 1;
+
+            String expected = base64_encode(arena, input, url_safe);
+            assert(expected.count == base64_encoded_size(count, url_safe));
+            assert(base64_decoded_size(expected, false) == count);
+            assert(string_equals(base64_decode(arena, expected), input));
+
+            Base64_Encoder encoder = base64_encoder_make(url_safe);
+            i64 text_count = 0;
+            for (i64 done = 0; done < count;)
+            {
+                i64 step = (i64)random_xoshiro_below(&rng, 100);
+                step = Min(step, count - done);
+                text_count += base64_encoder_push(&encoder, Str8(data + done, step), text + text_count);
+                done += step;
+            }
+            text_count += base64_encoder_finish(&encoder, text + text_count);
+            assert(string_equals(Str8(text, text_count), expected));
+
+            // NOTE(nick): MIME style line breaks
+            u8 wrapped[2200];
+            i64 wrapped_count = 0;
+            for (i64 i = 0; i < text_count; i += 1)
+            {
+                if (i && i % 76 == 0)
+                {
+                    wrapped[wrapped_count++] = '\r';
+                    wrapped[wrapped_count++] = '\n';
+                }
+                wrapped[wrapped_count++] = text[i];
+            }
+
+            Base64_Decoder decoder = base64_decoder_make(true);
+            i64 out_count = 0;
+            for (i64 done = 0; done < wrapped_count;)
+            {
+                i64 step = (i64)random_xoshiro_below(&rng, 100);
+                step = Min(step, wrapped_count - done);
+                out_count += base64_decoder_push(&decoder, Str8(wrapped + done, step), out + out_count);
+                done += step;
+            }
+            out_count += base64_decoder_finish(&decoder, out + out_count);
+            assert(string_equals(Str8(out, out_count), input));
+
+            arena_end_temp(temp);
+        }
+
+        arena_free(arena);
+    }
+
+    // NOTE(nick): every Random_Xoshiro lane is a plain xoshiro256+ stream (whichever vector path
+    // runs them), lane 0 is seeded by splitmix64, and the jumps commute with stepping
+    {
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 24);
+
+        u64 seed = 24;
+        for (i64 i = 0; i < 4; i += 1)
+        {
+            u64 z = (seed += 0x9e3779b97f4a7c15);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+            assert(rng.s[i][0] == (z ^ (z >> 31)));
+        }
+
+        Random_Xoshiro start = rng;
+        u64 rows[100 * RANDOM_XOSHIRO_LANES];
+        random_xoshiro_fill_u64(&rng, rows, ArrayCount(rows));
+        for (i64 lane = 0; lane < RANDOM_XOSHIRO_LANES; lane += 1)
+        {
+            u64 state[4] = {start.s[0][lane], start.s[1][lane], start.s[2][lane], start.s[3][lane]};
+            for (u64 row = 0; row < ArrayCount(rows) / RANDOM_XOSHIRO_LANES; row += 1)
+            {
+                assert(rows[row * RANDOM_XOSHIRO_LANES + lane] == random__xoshiro_next(state));
+            }
+            for (i64 i = 0; i < 4; i += 1) assert(rng.s[i][lane] == state[i]);
+        }
+
+        // NOTE(nick): lane n is lane 0 after n jumps of 2^128
+        Random_Xoshiro lanes = start;
+        random__xoshiro_jump(&lanes, random__xoshiro_jump_128);
+        for (i64 lane = 0; lane + 1 < RANDOM_XOSHIRO_LANES; lane += 1)
+        {
+            for (i64 i = 0; i < 4; i += 1) assert(lanes.s[i][lane] == start.s[i][lane + 1]);
+        }
+
+        // NOTE(nick): a jump is a power of the step, so stepping first or jumping first agree
+        Random_Xoshiro step_then_jump = start;
+        Random_Xoshiro jump_then_step = start;
+        u64 scratch[3 * RANDOM_XOSHIRO_LANES];
+        random_xoshiro_fill_u64(&step_then_jump, scratch, ArrayCount(scratch));
+        random_xoshiro_long_jump(&step_then_jump);
+        random_xoshiro_long_jump(&jump_then_step);
+        random_xoshiro_fill_u64(&jump_then_step, scratch, ArrayCount(scratch));
+        assert(MemoryEquals(step_then_jump.s, jump_then_step.s, sizeof(start.s)));
+        assert(!MemoryEquals(start.s, jump_then_step.s, sizeof(start.s)));
+
+        Random_Xoshiro parent = start;
+        Random_Xoshiro child = random_xoshiro_split(&parent);
+        Random_Xoshiro long_jumped = start;
+        random_xoshiro_long_jump(&long_jumped);
+        assert(MemoryEquals(child.s, start.s, sizeof(start.s)));
+        assert(MemoryEquals(parent.s, long_jumped.s, sizeof(start.s)));
+
+        i64 counts[3] = {0};
+        for (i64 i = 0; i < 30000; i += 1)
+        {
+            u64 value = random_xoshiro_below(&rng, 3);
+            assert(value < 3);
+            counts[value] += 1;
+        }
+        for (i64 i = 0; i < 3; i += 1) assert(counts[i] > 9500 && counts[i] < 10500);
+
+        f64 unit[1000];
+        random_xoshiro_fill_f64(&rng, unit, ArrayCount(unit));
+        for (u64 i = 0; i < ArrayCount(unit); i += 1) assert(unit[i] >= 0 && unit[i] < 1);
+    }
+
+    // NOTE(nick): the number parsers against strtoll/strtoull/strtod, how many bytes they take
+    // and the exact value (bit for bit for floats), with signs, leading zeros, overflow, long
+    // mantissas, huge and tiny exponents and junk after the number
+    {
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 17);
+
+        char buffer[128];
+        for (i64 trial = 0; trial < 50000; trial += 1)
+        {
+            int count = 0;
+            u64 sign = random_xoshiro_below(&rng, 4);
+            if (sign == 1) buffer[count++] = '-';
+            if (sign == 2) buffer[count++] = '+';
+            if (random_xoshiro_below(&rng, 8) == 0) buffer[count++] = '0';
+            int digits = 1 + (int)random_xoshiro_below(&rng, 21);
+            for (int i = 0; i < digits; i += 1) buffer[count++] = '0' + (char)random_xoshiro_below(&rng, 10);
+            if (random_xoshiro_below(&rng, 2)) buffer[count++] = "x ,9-"[random_xoshiro_below(&rng, 5)];
+            buffer[count] = 0;
+
+            char *expected_end;
+            errno = 0;
+            long long expected = strtoll(buffer, &expected_end, 10);
+            i64 value = 0;
+            i64 used = string_parse_i64(Str8(buffer, count), &value);
+            if (errno == 0)
+            {
+                assert(used == expected_end - buffer && value == expected);
+            }
+            else
+            {
+                assert(used == 0);
+            }
+
+            if (sign == 0)
+            {
+                errno = 0;
+                unsigned long long expected_u = strtoull(buffer, &expected_end, 10);
+                u64 value_u = 0;
+                used = string_parse_u64(Str8(buffer, count), &value_u);
+                if (errno == 0)
+                {
+                    assert(used == expected_end - buffer && value_u == expected_u);
+                }
+                else
+                {
+                    assert(used == 0);
+                }
+            }
+        }
+
+        for (i64 trial = 0; trial < 100000; trial += 1)
+        {
+            int count = 0;
+            u64 mode = trial % 3;
+            if (mode == 0)
+            {
+                u64 bits = random_xoshiro_u64(&rng);
+                f64 x;
+                MemoryCopy(&x, &bits, sizeof(x));
+                if (x != x) continue;
+                count = snprintf(buffer, sizeof(buffer), "%.*g", 1 + (int)random_xoshiro_below(&rng, 17), x);
+            }
+            else
+            {
+                if (random_xoshiro_below(&rng, 2)) buffer[count++] = "-+"[random_xoshiro_below(&rng, 2)];
+                int digits = (int)random_xoshiro_below(&rng, mode == 1 ? 20 : 30);
+                for (int i = 0; i < digits; i += 1) buffer[count++] = '0' + (char)random_xoshiro_below(&rng, 10);
+                if (random_xoshiro_below(&rng, 2))
+                {
+                    buffer[count++] = '.';
+                    int fraction = (int)random_xoshiro_below(&rng, mode == 1 ? 10 : 25);
+                    for (int i = 0; i < fraction; i += 1) buffer[count++] = '0' + (char)random_xoshiro_below(&rng, 10);
+                }
+                if (random_xoshiro_below(&rng, 2))
+                {
+                    buffer[count++] = "eE"[random_xoshiro_below(&rng, 2)];
+                    if (random_xoshiro_below(&rng, 2)) buffer[count++] = "-+"[random_xoshiro_below(&rng, 2)];
+                    count += snprintf(buffer + count, sizeof(buffer) - count, "%d", (int)random_xoshiro_below(&rng, mode == 1 ? 30 : 400));
+                }
+                if (random_xoshiro_below(&rng, 4) == 0) buffer[count++] = "x ,."[random_xoshiro_below(&rng, 4)];
+                buffer[count] = 0;
+            }
+
+            char *expected_end;
+            f64 expected = strtod(buffer, &expected_end);
+            f64 value = 0;
+            i64 used = string_parse_f64(Str8(buffer, count), &value);
+            if (expected_end == buffer)
+            {
+                assert(used == 0);
+            }
+            else
+            {
+                assert(used == expected_end - buffer && MemoryEquals(&value, &expected, sizeof(value)));
+            }
+        }
+    }
+
+    // NOTE(nick): bulk parsing keeps one value per field and counts the fields that aren't numbers
+    {
+        Arena *arena = arena_alloc(Megabytes(1));
+        i64 bad_fields = -1;
+
+        Array_i64 ints = array_i64_from_string(arena, S(" 1, -2 ,,x,4 5, 6\n7,"), S(",\n"), &bad_fields);
+        i64 expected_ints[] = {1, -2, 0, 0, 0, 6, 7};
+        assert(ints.count == ArrayCount(expected_ints) && bad_fields == 3);
+        for (u64 i = 0; i < ArrayCount(expected_ints); i += 1) assert(ints.data[i] == expected_ints[i]);
+
+        Array_f64 floats = array_f64_from_string(arena, S("0.5\t1e3  -2.25\n\n99999999999999999999 nan?"), S(" \t\n"), &bad_fields);
+        f64 expected_floats[] = {0.5, 1e3, -2.25, 1e20, 0};
+        assert(floats.count == ArrayCount(expected_floats) && bad_fields == 1);
+        for (u64 i = 0; i < ArrayCount(expected_floats); i += 1) assert(floats.data[i] == expected_floats[i]);
+
+        ints = array_i64_from_string(arena, S("12 34"), S(" "), NULL);
+        assert(ints.count == 2 && ints.data[0] == 12 && ints.data[1] == 34);
+
+        arena_free(arena);
+    }
+
+    // NOTE(nick): radix sorts against qsort for every key kind, on random, narrow, constant and
+    // float special-value inputs, with the values checking that equal keys keep their order.
+    // Sizes straddle the insertion sort cutoff and the skipped-digit passes.
+    {
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 25);
+
+        i64 sizes[] = {0, 1, 2, 17, 64, 65, 200, 1000, 5000};
+        u64 special_64[] = {0, 0x8000000000000000ull, 0x7ff8000000000000ull, 0xfff8000000000001ull, 0x7ff0000000000000ull, 0xfff0000000000000ull, 1, 0x3ff0000000000000ull};
+        u32 special_32[] = {0, 0x80000000u, 0x7fc00000u, 0xffc00001u, 0x7f800000u, 0xff800000u, 1, 0x3f800000u};
+
+        static u64 keys[5000], original[5000], expected[5000], values[5000];
+        static u32 keys_32[5000], original_32[5000], expected_32[5000], values_32[5000];
+
+        for (u64 size_index = 0; size_index < ArrayCount(sizes); size_index += 1)
+        {
+            i64 count = sizes[size_index];
+            for (i32 input = 0; input < 4; input += 1)
+            {
+                for (radix_test_mode = 0; radix_test_mode < 3; radix_test_mode += 1)
+                {
+                    for (i64 i = 0; i < count; i += 1)
+                    {
+                        u64 bits = random_xoshiro_u64(&rng);
+                        if (input == 1) bits &= 7;
+                        if (input == 2) bits = 42;
+                        if (input == 3 && (bits & 1)) bits = special_64[(bits >> 1) & 7];
+                        original[i] = bits;
+
+                        u32 bits_32 = (u32)(bits >> 32);
+                        if (input == 1) bits_32 = (u32)bits;
+                        if (input == 2) bits_32 = 42;
+                        if (input == 3 && (bits & 1)) bits_32 = special_32[(bits >> 1) & 7];
+                        original_32[i] = bits_32;
+
+                        values[i] = i;
+                        values_32[i] = (u32)i;
+                    }
+
+                    MemoryCopy(expected, original, count * sizeof(u64));
+                    MemoryCopy(expected_32, original_32, count * sizeof(u32));
+                    qsort(expected, count, sizeof(u64), radix_test_compare_u64);
+                    qsort(expected_32, count, sizeof(u32), radix_test_compare_u32);
+
+                    MemoryCopy(keys, original, count * sizeof(u64));
+                    MemoryCopy(keys_32, original_32, count * sizeof(u32));
+                    if (radix_test_mode == 0) radix_sort_u64(keys, count);
+                    if (radix_test_mode == 1) radix_sort_i64((i64 *)keys, count);
+                    if (radix_test_mode == 2) radix_sort_f64((f64 *)keys, count);
+                    if (radix_test_mode == 0) radix_sort_u32(keys_32, count);
+                    if (radix_test_mode == 1) radix_sort_i32((i32 *)keys_32, count);
+                    if (radix_test_mode == 2) radix_sort_f32((f32 *)keys_32, count);
+                    assert(count == 0 || MemoryEquals(keys, expected, count * sizeof(u64)));
+                    assert(count == 0 || MemoryEquals(keys_32, expected_32, count * sizeof(u32)));
+
+                    MemoryCopy(keys, original, count * sizeof(u64));
+                    MemoryCopy(keys_32, original_32, count * sizeof(u32));
+                    if (radix_test_mode == 0) radix_sort_u64_pairs(keys, values, count);
+                    if (radix_test_mode == 1) radix_sort_i64_pairs((i64 *)keys, values, count);
+                    if (radix_test_mode == 2) radix_sort_f64_pairs((f64 *)keys, values, count);
+                    if (radix_test_mode == 0) radix_sort_u32_pairs(keys_32, values_32, count);
+                    if (radix_test_mode == 1) radix_sort_i32_pairs((i32 *)keys_32, values_32, count);
+                    if (radix_test_mode == 2) radix_sort_f32_pairs((f32 *)keys_32, values_32, count);
+                    assert(count == 0 || MemoryEquals(keys, expected, count * sizeof(u64)));
+                    assert(count == 0 || MemoryEquals(keys_32, expected_32, count * sizeof(u32)));
+
+                    for (i64 i = 0; i < count; i += 1)
+                    {
+                        assert(original[values[i]] == keys[i]);
+                        assert(original_32[values_32[i]] == keys_32[i]);
+                        if (i > 0 && keys[i] == keys[i - 1]) assert(values[i] > values[i - 1]);
+                        if (i > 0 && keys_32[i] == keys_32[i - 1]) assert(values_32[i] > values_32[i - 1]);
+                    }
+                }
+            }
+        }
+
+        // NOTE(nick): strings, with shared prefixes longer than the radix passes look at
+        Arena *arena = arena_alloc(Megabytes(4));
+        for (i64 trial = 0; trial < 40; trial += 1)
+        {
+            i64 count = (trial % 10 == 0) ? 3000 : (i64)random_xoshiro_below(&rng, 300);
+            i64 kind = trial % 4;
+            String *strings = PushArray(arena, String, count);
+            String *sorted = PushArray(arena, String, count);
+            for (i64 i = 0; i < count; i += 1)
+            {
+                i64 length = kind == 0 ? (i64)random_xoshiro_below(&rng, 40) : kind == 1 ? 200 + (i64)random_xoshiro_below(&rng, 4) : (i64)random_xoshiro_below(&rng, 5);
+                u8 *data = PushArrayNoZero(arena, u8, length + 1);
+                for (i64 j = 0; j < length; j += 1)
+                {
+                    if (kind == 0) data[j] = (u8)random_xoshiro_u64(&rng);
+                    if (kind == 1) data[j] = j < 200 ? 'x' : 'a' + (u8)random_xoshiro_below(&rng, 3);
+                    if (kind == 2) data[j] = 'a' + (u8)random_xoshiro_below(&rng, 2);
+                    if (kind == 3) data[j] = (u8)random_xoshiro_below(&rng, 3);
+                }
+                strings[i] = Str8(data, length);
+                sorted[i] = strings[i];
+            }
+
+            qsort(sorted, count, sizeof(String), compare_string);
+            String_Array array = {count, count, strings};
+            string_array_sort(&array);
+            for (i64 i = 0; i < count; i += 1) assert(string_equals(strings[i], sorted[i]));
+        }
+        arena_free(arena);
+    }
+
+    // NOTE(nick): hex pads past 16 digits, floats are the shortest digits that round-trip
+    {
+        Arena *arena = arena_alloc(Megabytes(1));
+
+        assert(string_equals(string_from_hex(arena, 0xbeef, 0), S("beef")));
+        assert(string_equals(string_from_hex(arena, 0xbeef, 8), S("0000beef")));
+        assert(string_equals(string_from_hex(arena, 0xbeef, 20), S("0000000000000000beef")));
+        assert(string_from_hex(arena, U64_MAX, STRING_NUMBER_MAX_SIZE).count == STRING_NUMBER_MAX_SIZE);
+
+        assert(string_equals(string_from_f64(arena, 0.1), S("0.1")));
+        assert(string_equals(string_from_f64(arena, 35001.634231), S("35001.634231")));
+
+        Random_Xoshiro rng = {0};
+        random_xoshiro_set_seed(&rng, 16);
+        for (i64 i = 0; i < 10000; i += 1)
+        {
+            u64 bits = random_xoshiro_u64(&rng);
+            f64 value;
+            MemoryCopy(&value, &bits, sizeof(value));
+            if (((bits >> 52) & 0x7ff) == 0x7ff) continue;
+
+            u8 buffer[STRING_NUMBER_MAX_SIZE + 1];
+            i64 count = string_write_f64(buffer, value);
+            buffer[count] = 0;
+            assert(strtod((char *)buffer, NULL) == value);
+        }
+
+        arena_free(arena);
+    }
+
     print("Done! time in ms: %f\n", os_time_in_miliseconds());
     
     return 0;